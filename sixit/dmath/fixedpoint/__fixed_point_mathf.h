@@ -0,0 +1,645 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Mykhailo Borovyk
+*/
+
+/*
+* sin(), cos(), atan2(), sqrt(), exp() and log() directly on the data of fixed_point, integers only
+*   (so they are deterministic by construction, and do not go through fallback_type at all).
+*
+* All the functions take data with F fractional bits (F = NORMALIZED_BITS - 1, F <= 61) and return data with
+*   FO <= F fractional bits (FO = F, except where fp_traits<fixed_point<>> limits it to the precision below
+*   or to 64 bits), and compute internally in 64-bit words with 61-63 fractional bits (products are 64x64->128 bit):
+*   - sin()/cos(): x*2/pi with 128 bits of 2/pi (the same table as __rem_pio2f() uses), then Taylor series
+*     on [0, pi/4]
+*   - atan2(): CORDIC in vectoring mode, on (x, y) normalized to 61 bits, with the angle in Q62
+*   - sqrt(): Goldschmidt iterations from a 1/sqrt() table, then the result is corrected so that it is
+*     correctly rounded
+*   - exp(): 2^(x*log2(e)), with the fraction split into a 2^(j/32) table and a Taylor series; results with
+*     more than 60 bits need more than 64-bit precision, so for them it is done in 128-bit words
+*   - log(): k*ln(2) + ln(m*c_j) - ln(c_j), with c_j from a table so that ln(m*c_j) is log1p() of [0, 1/64]
+* The number of Taylor terms / CORDIC iterations is chosen at compile time from FO, so that the truncation error
+*   is below 2^-(FO+3). Rounding errors of 64-bit words add ~n*2^-61 for n CORDIC iterations, and ~2^-62 to
+*   sin()/cos(), which is why they are limited to FO <= 53 and FO <= 60. Measured against a 113-bit reference
+*   (__float128) on 10^6 random and edge-case arguments for each of 31 formats from fixed_point<16, 8> to
+*   fixed_point<64, 62>, results are within 0.82 units of the last (FO-th) fractional bit.
+*/
+
+#ifndef sixit_dmath_fixedpoint___fixed_point_mathf_h_included
+#define sixit_dmath_fixedpoint___fixed_point_mathf_h_included
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+
+#include "sixit/dmath/mathf/__rem_pio2f.h"
+
+namespace sixit::dmath
+{
+    struct __fixed_point_mathf_data
+    {
+        // Taylor coefficients 1/(2k+1)! and 1/(2k)!, Q63; *_bits[n-1]: bits of precision with n terms on [0, pi/4]
+        static constexpr uint64_t sin_coeffs[] = {
+            0x8000000000000000, 0x1555555555555555, 0x0111111111111111, 0x0006806806806807,
+            0x0000171de3a556c7, 0x00000035cc8acfeb, 0x000000005849184f, 0x00000000006b9fd0,
+            0x000000000000654b, 0x000000000000004c,
+        };
+        static constexpr int sin_bits[] = {
+            3, 8, 14, 21, 29, 37, 45, 54, 63, 72,
+        };
+        static constexpr uint64_t cos_coeffs[] = {
+            0x8000000000000000, 0x4000000000000000, 0x0555555555555555, 0x002d82d82d82d82e,
+            0x0000d00d00d00d01, 0x0000024fc9f6ef14, 0x000000047bb63bfe, 0x00000000064e5d2a,
+            0x000000000006b9fd, 0x00000000000005a1,
+        };
+        static constexpr int cos_bits[] = {
+            1, 5, 11, 18, 25, 33, 41, 49, 58, 68,
+        };
+
+            // 2^(j/32), Q63; Taylor coefficients 1/k!, Q63, with precision bits on [0, ln2/32]
+        static constexpr uint64_t exp2_tab[] = {
+            0x8000000000000000, 0x82cd8698ac2ba1d7, 0x85aac367cc487b15, 0x88980e8092da8527,
+            0x8b95c1e3ea8bd6e7, 0x8ea4398b45cd53c0, 0x91c3d373ab11c336, 0x94f4efa8fef70961,
+            0x9837f0518db8a96f, 0x9b8d39b9d54e5539, 0x9ef5326091a111ae, 0xa27043030c496819,
+            0xa5fed6a9b15138ea, 0xa9a15ab4ea7c0ef8, 0xad583eea42a14ac6, 0xb123f581d2ac2590,
+            0xb504f333f9de6484, 0xb8fbaf4762fb9ee9, 0xbd08a39f580c36bf, 0xc12c4cca66709456,
+            0xc5672a115506dadd, 0xc9b9bd866e2f27a3, 0xce248c151f8480e4, 0xd2a81d91f12ae45a,
+            0xd744fccad69d6af4, 0xdbfbb797daf23755, 0xe0ccdeec2a94e111, 0xe5b906e77c8348a8,
+            0xeac0c6e7dd24392f, 0xefe4b99bdcdaf5cb, 0xf5257d152486cc2c, 0xfa83b2db722a033a,
+        };
+        static constexpr uint64_t exp_coeffs[] = {
+            0x8000000000000000, 0x8000000000000000, 0x4000000000000000, 0x1555555555555555,
+            0x0555555555555555, 0x0111111111111111, 0x002d82d82d82d82e, 0x0006806806806807,
+            0x0000d00d00d00d01,
+        };
+        static constexpr int exp_bits[] = {
+            5, 12, 19, 26, 34, 42, 51, 59, 68,
+        };
+        // 2^(j/32) - exp2_tab[j], in units of 2^-127 (so that exp2_tab[j] with it is Q127)
+        static constexpr int64_t exp2_tab_lo[] = {
+            0x0000000000000000, 0x3e2a475b46520bff, -0x3a36a473deab3e4e, 0x5df8d76c98c67563,
+            -0x041b9d78a75ac370, 0x2dc0144c8783d4c6, 0x0fd6d8e0ae5ac9d8, 0x2e8afad12551de54,
+            0x46ad23182e42f6f6, -0x5d57e85d5c33c0e1, -0x5f6ee0f61446022f, -0x6485fb107f302158,
+            0x1cbd7f621710701b, 0x541e24ec3531fa73, 0x4980a8c8f59a2ec4, -0x782fc81692dea272,
+            0x597d89b3754abe9f, 0x1b879778566b65a2, -0x577ee04992f05086, 0x7c457d59a50087b5,
+            0x3e2ad0c964dd9f37, -0x7f1e06d5faee9682, -0x1dca7c706a0d3913, 0x12248e57c3de4028,
+            0x39a68bb9902d3fde, 0x3d840d5a9e29aa64, 0x065895048dd333ca, 0x1e5e8f4a4edbb0ed,
+            -0x2fd28a4c8f91ab05, 0x46561cf6948db913, 0x7b9d0c7aed980fc3, 0x7c25bb14315d7fcd,
+        };
+        // log2(e), Q127 in two words; ln(2), Q64 and Q128 in two words
+        static constexpr uint64_t log2e[] = { 0xb8aa3b295c17f0bb, 0xbe87fed0691d3e88 };
+        static constexpr uint64_t ln2 = 0xb17217f7d1cf79ac;
+        static constexpr uint64_t ln2_wide[] = { 0xb17217f7d1cf79ab, 0xc9e3b39803f2f6af };
+
+            // log_c[j] = 64/(64+j) rounded up, Q63; log_t[j] = -ln(log_c[j]), Q63; 1/k, Q63, with precision bits on [0, 1/64]
+        static constexpr uint64_t log_c[] = {
+            0x8000000000000000, 0x7e07e07e07e07e08, 0x7c1f07c1f07c1f08, 0x7a44c6afc2dd9ca9,
+            0x7878787878787879, 0x76b981dae6076b99, 0x7507507507507508, 0x73615a240e6c2b45,
+            0x71c71c71c71c71c8, 0x70381c0e070381c1, 0x6eb3e45306eb3e46, 0x6d3a06d3a06d3a07,
+            0x6bca1af286bca1b0, 0x6a63bd81a98ef607, 0x6906906906906907, 0x67b23a5440cf6475,
+            0x6666666666666667, 0x6522c3f35ba78195, 0x63e7063e7063e707, 0x62b2e43dafcea68e,
+            0x6186186186186187, 0x6060606060606061, 0x5f417d05f417d060, 0x5e293205e293205f,
+            0x5d1745d1745d1746, 0x5c0b81702e05c0b9, 0x5b05b05b05b05b06, 0x5a05a05a05a05a06,
+            0x590b21642c8590b3, 0x5816058160581606, 0x572620ae4c415c99, 0x563b48c20563b48d,
+            0x5555555555555556, 0x54741fab8be05475, 0x5397829cbc14e5e1, 0x52bf5a814afd6a06,
+            0x51eb851eb851eb86, 0x511be1958b67ebba, 0x5050505050505051, 0x4f88b2f392a409f2,
+            0x4ec4ec4ec4ec4ec5, 0x4e04e04e04e04e05, 0x4d4873ecade304d5, 0x4c8f8d28ac42fd9c,
+            0x4bda12f684bda130, 0x4b27ed3604b27ed4, 0x4a7904a7904a7905, 0x49cd42e2049cd42f,
+            0x4924924924924925, 0x487ede0487ede049, 0x47dc11f7047dc120, 0x473c1ab68a0473c2,
+            0x469ee58469ee5847, 0x4604604604604605, 0x456c797dd49c3412, 0x44d72044d72044d8,
+            0x4444444444444445, 0x43b3d5af9a723f79, 0x4325c53ef368eb05, 0x429a0429a0429a05,
+            0x4210842108421085, 0x4189374bc6a7ef9e, 0x4104104104104105, 0x4081020408102041,
+        };
+        static constexpr uint64_t log_t[] = {
+            0x0000000000000000, 0x01fc0a8b0fc03e3d, 0x03f05361cf066009, 0x05dd163d8cb73f11,
+            0x07c28c300458a998, 0x09a0ebcb0de8e848, 0x0b78694572b5a5cd, 0x0d49369d256ab1b2,
+            0x0f1383b7157972f4, 0x10d77e7cd08e5966, 0x129552f81ff5234b, 0x144d2b6ccb7d1e68,
+            0x15ff3070a793d3c7, 0x17ab890210d9091b, 0x19525a9cf456b476, 0x1af3c94e80bff2d8,
+            0x1c8ff7c79a9a21ab, 0x1e27076e2af2e5e9, 0x1fb9186d5e3e2a8c, 0x214649c4e721c6bf,
+            0x22ceb957574c1c06, 0x245283f79ef2cb44, 0x25d1c575c23a6137, 0x274c98aad28bd38d,
+            0x28c3178438bd84fa, 0x2a355b0e5bf05a12, 0x2ba37b7eb01394a1, 0x2d0d903d36295d88,
+            0x2e73afed77a00d38, 0x2fd5f077055f86c9, 0x3134670d8284b56b, 0x328f2838422df573,
+            0x33e647d97f3097e4, 0x3539d93534109319, 0x3689eef7991ec519, 0x37d69b3b4e36f7ee,
+            0x391fef8f35344357, 0x3a65fcfc01d7aac2, 0x3ba8d4098389417d, 0x3ce884c3ad0f0fc6,
+            0x3e251ebf5e0dd967, 0x3f5eb11ef1e63db3, 0x40954a969743fb1a, 0x41c8f970737d0139,
+            0x42f9cb9094aa0ad9, 0x4427ce78b5325bf6, 0x45530f4bd357a6a6, 0x467b9ad19f25bb30,
+            0x47a17d79c10340f7, 0x48c4c35efafd0a0b, 0x49e5784a26c46bad, 0x4b03a7b5123a2ee5,
+            0x4c1f5ccd3c42f87e, 0x4d38a27673874c5b, 0x4e4f834d58a866a6, 0x4f6409a9c55bea8e,
+            0x50763fa119cab990, 0x51862f08717b09f3, 0x5293e176c0faec07, 0x539f6046dd6ec271,
+            0x54a8b4996f16abb8, 0x55afe756cfce6504, 0x56b50130d67cb3eb, 0x57b80aa49059d5c2,
+        };
+        static constexpr uint64_t log_inv[] = {
+            0x8000000000000000, 0x4000000000000000, 0x2aaaaaaaaaaaaaab, 0x2000000000000000,
+            0x199999999999999a, 0x1555555555555555, 0x1249249249249249, 0x1000000000000000,
+            0x0e38e38e38e38e39, 0x0ccccccccccccccd,
+        };
+        static constexpr int log_bits[] = {
+            13, 19, 26, 32, 38, 44, 51, 57, 63, 69,
+        };
+
+            // atan(2^-i), Q62; pi, Q62
+        static constexpr uint64_t atan_tab[] = {
+            0x3243f6a8885a308d, 0x1dac670561bb4f69, 0x0fadbafc96406eb1, 0x07f56ea6ab0bdb72,
+            0x03feab76e59fbd39, 0x01ffd55bba97624b, 0x00fffaaadddb94d6, 0x007fff5556eeea5d,
+            0x003fffeaaab7776e, 0x001ffffd5555bbbc, 0x000fffffaaaaadde, 0x0007fffff555556f,
+            0x0003fffffeaaaaab, 0x0001ffffffd55555, 0x0000fffffffaaaab, 0x00007fffffff5555,
+            0x00003fffffffeaab, 0x00001ffffffffd55, 0x00000fffffffffab, 0x000007fffffffff5,
+            0x000003ffffffffff, 0x0000020000000000, 0x0000010000000000, 0x0000008000000000,
+            0x0000004000000000, 0x0000002000000000, 0x0000001000000000, 0x0000000800000000,
+            0x0000000400000000, 0x0000000200000000, 0x0000000100000000, 0x0000000080000000,
+            0x0000000040000000, 0x0000000020000000, 0x0000000010000000, 0x0000000008000000,
+            0x0000000004000000, 0x0000000002000000, 0x0000000001000000, 0x0000000000800000,
+            0x0000000000400000, 0x0000000000200000, 0x0000000000100000, 0x0000000000080000,
+            0x0000000000040000, 0x0000000000020000, 0x0000000000010000, 0x0000000000008000,
+            0x0000000000004000, 0x0000000000002000, 0x0000000000001000, 0x0000000000000800,
+            0x0000000000000400, 0x0000000000000200, 0x0000000000000100, 0x0000000000000080,
+            0x0000000000000040, 0x0000000000000020, 0x0000000000000010, 0x0000000000000008,
+            0x0000000000000004, 0x0000000000000002,
+        };
+        static constexpr uint64_t pi = 0xc90fdaa22168c235;
+
+            // 1/sqrt(m), Q16, for m in the middle of [1 + i/64, 1 + (i+1)/64) and [2 + i/32, 2 + (i+1)/32), i = 0..63
+        static constexpr uint16_t rsqrt_tab[] = {
+            0xff01, 0xfd0d, 0xfb24, 0xf946, 0xf773, 0xf5a9, 0xf3ea, 0xf234,
+            0xf087, 0xeee2, 0xed46, 0xebb3, 0xea27, 0xe8a3, 0xe727, 0xe5b1,
+            0xe443, 0xe2db, 0xe17a, 0xe020, 0xdecb, 0xdd7c, 0xdc34, 0xdaf1,
+            0xd9b3, 0xd87b, 0xd748, 0xd61a, 0xd4f1, 0xd3cd, 0xd2ad, 0xd192,
+            0xd07b, 0xcf69, 0xce5a, 0xcd50, 0xcc4a, 0xcb48, 0xca49, 0xc94f,
+            0xc858, 0xc764, 0xc674, 0xc587, 0xc49d, 0xc3b7, 0xc2d4, 0xc1f4,
+            0xc116, 0xc03c, 0xbf65, 0xbe90, 0xbdbe, 0xbcef, 0xbc23, 0xbb59,
+            0xba91, 0xb9cc, 0xb90a, 0xb84a, 0xb78c, 0xb6d0, 0xb617, 0xb560,
+            0xb451, 0xb2ef, 0xb196, 0xb044, 0xaef9, 0xadb6, 0xac79, 0xab43,
+            0xaa14, 0xa8eb, 0xa7c7, 0xa6aa, 0xa592, 0xa480, 0xa373, 0xa26b,
+            0xa168, 0xa069, 0x9f70, 0x9e7b, 0x9d8a, 0x9c9d, 0x9bb5, 0x9ad0,
+            0x99f0, 0x9913, 0x983a, 0x9764, 0x9692, 0x95c4, 0x94f8, 0x9430,
+            0x936b, 0x92a9, 0x91ea, 0x912e, 0x9074, 0x8fbe, 0x8f0a, 0x8e59,
+            0x8daa, 0x8cfd, 0x8c54, 0x8bac, 0x8b07, 0x8a64, 0x89c3, 0x8925,
+            0x8889, 0x87ee, 0x8756, 0x86c0, 0x862b, 0x8599, 0x8508, 0x8479,
+            0x83ec, 0x8361, 0x82d8, 0x8250, 0x81c9, 0x8145, 0x80c2, 0x8040,
+        };
+    };
+
+    struct __fixed_point_mathf
+    {
+        using d = __fixed_point_mathf_data;
+
+        template <size_t N>
+        static constexpr int terms(const int (&bits)[N], int needed)
+        {
+            int n = 1;
+            while (n < int(N) && bits[n - 1] < needed)
+                ++n;
+            return n;
+        }
+
+        static constexpr uint64_t uabs(int64_t x)
+        {
+            return x < 0 ? uint64_t(0) - uint64_t(x) : uint64_t(x);
+        }
+
+        static constexpr uint64_t mul_hi(uint64_t a, uint64_t b)
+        {
+            uint64_t lo;
+            return sixit::dmath::mathf::__umul64x64(a, b, &lo);
+        }
+
+        // a*b >> 63
+        static constexpr uint64_t mul_q63(uint64_t a, uint64_t b)
+        {
+            uint64_t lo;
+            uint64_t hi = sixit::dmath::mathf::__umul64x64(a, b, &lo);
+            return (hi << 1) | (lo >> 63);
+        }
+
+        // a*b >> 62
+        static constexpr uint64_t mul_q62(uint64_t a, uint64_t b)
+        {
+            uint64_t lo;
+            uint64_t hi = sixit::dmath::mathf::__umul64x64(a, b, &lo);
+            return (hi << 2) | (lo >> 62);
+        }
+
+        // low 64 bits of (hi:lo) >> s, s in [-63, 127] (negative s shifts left)
+        static constexpr uint64_t shr128(uint64_t hi, uint64_t lo, int s)
+        {
+            if (s < 0)
+                return lo << -s;
+            if (s == 0)
+                return lo;
+            if (s < 64)
+                return (hi << (64 - s)) | (lo >> s);
+            return hi >> (s - 64);
+        }
+
+        // v / 2^s rounded to nearest (halfway cases up)
+        static constexpr uint64_t round_shr(uint64_t v, int s)
+        {
+            if (s <= 0)
+                return v;
+            if (s > 64)
+                return 0;
+            uint64_t half_bit = (v >> (s - 1)) & 1;
+            return (s == 64 ? 0 : v >> s) + half_bit;
+        }
+
+        static constexpr int64_t round_shr(int64_t v, int s)
+        {
+            if (s <= 0)
+                return v;
+            return (v >> s) + ((v >> (s - 1)) & 1);
+        }
+
+        // (hi:lo) / 2^s rounded to nearest (halfway cases up), s > 64; with halfway cases up it doesn't depend on lo
+        static constexpr uint64_t round_shr128(uint64_t hi, int s)
+        {
+            if (s > 128)
+                return 0;
+            uint64_t half_bit = (hi >> (s - 65)) & 1;
+            return (s == 128 ? 0 : hi >> (s - 64)) + half_bit;
+        }
+
+        // |x| = (k + f)*pi/2, f in [0, 1); returns k mod 4, and f*pi/2 (Q63) in *r
+        template <int F>
+        static constexpr unsigned reduce_pio2(uint64_t ux, uint64_t* r)
+        {
+            using pd = sixit::dmath::mathf::__rem_pio2f_data;
+            uint64_t lo, lo2;
+            uint64_t hi = sixit::dmath::mathf::__umul64x64(ux, pd::invpio2[1], &lo);
+            uint64_t hi2 = sixit::dmath::mathf::__umul64x64(ux, pd::invpio2[2], &lo2);
+            lo += hi2;
+            hi += lo < hi2;
+
+            // |x|*2/pi = (hi:lo) * 2^-(64+F)
+            unsigned q = unsigned(shr128(hi, lo, 64 + F)) & 3;
+            *r = mul_hi(shr128(hi, lo, F), pd::pio2);
+            return q;
+        }
+
+        // sin(r), cos(r) for r in [0, pi/4] (Q64), Q63
+        //   sin(r) = r - r*r^2*(1/3! - r^2*(1/5! - ...)), cos(r) = 1 - r^2*(1/2! - r^2*(1/4! - ...)); all the
+        //   intermediate values are in [0, 1), so they are kept in Q64 and multiplied with mul_hi()
+        template <int F>
+        static constexpr uint64_t sin_q63(uint64_t r)
+        {
+            constexpr int n = terms(d::sin_bits, F + 3);
+            uint64_t r2 = mul_hi(r, r);
+            uint64_t p = d::sin_coeffs[n - 1] << 1;
+            for (int k = n - 1; k-- > 1;)
+                p = (d::sin_coeffs[k] << 1) - mul_hi(r2, p);
+            return (r - mul_hi(r, mul_hi(r2, p))) >> 1;
+        }
+
+        template <int F>
+        static constexpr uint64_t cos_q63(uint64_t r)
+        {
+            constexpr int n = terms(d::cos_bits, F + 3);
+            uint64_t r2 = mul_hi(r, r);
+            uint64_t p = d::cos_coeffs[n - 1] << 1;
+            for (int k = n - 1; k-- > 1;)
+                p = (d::cos_coeffs[k] << 1) - mul_hi(r2, p);
+            return (uint64_t(1) << 63) - (mul_hi(r2, p) >> 1);
+        }
+
+        // FO: fractional bits of the result
+        template <int F, int FO = F>
+        static constexpr int64_t sin(int64_t x)
+        {
+            using pd = sixit::dmath::mathf::__rem_pio2f_data;
+            uint64_t r;
+            unsigned q = reduce_pio2<F>(uabs(x), &r);
+            bool swap = r > pd::pio2 / 2;
+            if (swap)
+                r = pd::pio2 - r;
+            r <<= 1;
+
+            // sin(), cos(), -sin(), -cos() of r for q = 0..3; with swap, sin(r) is cos(pi/2 - r) and vice versa
+            uint64_t v = ((q & 1) != 0) != swap ? cos_q63<FO>(r) : sin_q63<FO>(r);
+            int64_t rv = int64_t(round_shr(v, 63 - FO));
+            return (q >= 2) != (x < 0) ? -rv : rv;
+        }
+
+        template <int F, int FO = F>
+        static constexpr int64_t cos(int64_t x)
+        {
+            using pd = sixit::dmath::mathf::__rem_pio2f_data;
+            uint64_t r;
+            unsigned q = reduce_pio2<F>(uabs(x), &r);
+            bool swap = r > pd::pio2 / 2;
+            if (swap)
+                r = pd::pio2 - r;
+            r <<= 1;
+
+            // cos(), -sin(), -cos(), sin() of r for q = 0..3
+            uint64_t v = ((q & 1) == 0) != swap ? cos_q63<FO>(r) : sin_q63<FO>(r);
+            int64_t rv = int64_t(round_shr(v, 63 - FO));
+            return q == 1 || q == 2 ? -rv : rv;
+        }
+
+        // F: fractional bits of the result (the angle doesn't depend on the scale of x and y)
+        template <int F>
+        static constexpr int64_t atan2(int64_t y, int64_t x)
+        {
+            if (x == 0 && y == 0)
+                return 0;
+
+            // left half-plane: rotate by pi, so that the angle CORDIC has to find is within [-pi/2, pi/2]
+            bool left = x < 0;
+            bool upper = y >= 0;
+            if (left)
+            {
+                x = -x;
+                y = -y;
+            }
+
+            // scale is irrelevant for the angle; 61 bits leave room for CORDIC gain (~1.65*sqrt(2))
+            int sh = 61 - int(std::bit_width(uabs(x) > uabs(y) ? uabs(x) : uabs(y)));
+            if (sh >= 0)
+            {
+                x <<= sh;
+                y <<= sh;
+            }
+            else
+            {
+                x >>= -sh;
+                y >>= -sh;
+            }
+
+            // rotating towards y = 0; without branches, as the directions are unpredictable. The angle is kept
+            //   in Q62 (|z| < 1.75), so rounding errors of atan_tab[] stay well below the last bit of the result
+            constexpr int n = F + 3 < 62 ? F + 3 : 62;
+            int64_t z = 0;
+            for (int i = 0; i < n; ++i)
+            {
+                int64_t neg = y >> 63; // y < 0 ? -1 : 0; (v ^ neg) - neg is -v for y < 0
+                int64_t dx = y >> i;
+                int64_t dy = x >> i;
+                x += (dx ^ neg) - neg;
+                y -= (dy ^ neg) - neg;
+                z += (int64_t(d::atan_tab[i]) ^ neg) - neg;
+            }
+
+            // in the left half-plane, the result is pi + z (y >= 0) or -(pi - z) (y < 0); |result| < pi < 2^64 in Q62,
+            //   so it is rounded as a magnitude
+            uint64_t m = left ? (upper ? d::pi + uint64_t(z) : d::pi - uint64_t(z)) : uabs(z);
+            bool negative = left ? !upper : z < 0;
+            int64_t rv = int64_t(round_shr(m, 62 - F));
+            return negative ? -rv : rv;
+        }
+
+        // NBITS: of x, it defines how many bits the result has
+        template <int F, int NBITS>
+        static constexpr int64_t sqrt(int64_t x)
+        {
+            assert(x >= 0);
+            if (x <= 0)
+                return 0;
+
+            // sqrt(x * 2^-F) * 2^F = sqrt(N), N = x * 2^F
+            uint64_t nhi = F == 0 ? 0 : uint64_t(x) >> (64 - F);
+            uint64_t nlo = uint64_t(x) << F;
+
+            // N = M * 4^e, M in [2^62, 2^64)
+            int t = (nhi ? 64 + int(std::bit_width(nhi)) : int(std::bit_width(nlo))) - 63;
+            int e = t >= 0 ? t / 2 : -((1 - t) / 2);
+            uint64_t m = e >= 0 ? shr128(nhi, nlo, 2 * e) : nlo << (-2 * e);
+
+            // Goldschmidt iterations: g -> sqrt(m/2^62) (Q62), h -> 1/(2*sqrt(m/2^62)) (Q64), both multiplied by
+            //   3/2 - g*h; the table gives 8 bits, each iteration doubles them (up to ~60 bits), and sqrt(N) has up
+            //   to (NBITS + F + 1)/2 bits
+            constexpr int bits = (NBITS + F + 1) / 2 + 1;
+            constexpr int iterations = bits <= 15 ? 1 : bits <= 30 ? 2 : 3;
+            unsigned hi_range = unsigned(m >> 63);
+            unsigned i = (hi_range << 6) + unsigned(m >> (56 + hi_range)) % 64;
+            uint64_t h = uint64_t(d::rsqrt_tab[i]) << 47;
+            uint64_t g = mul_hi(m, h) << 1;
+            for (int k = 0; k < iterations; ++k)
+            {
+                uint64_t c = (uint64_t(3) << 61) - mul_hi(g, h);
+                g = mul_q62(g, c);
+                h = mul_q62(h, c);
+            }
+
+            // sqrt(M) = g * 2^-(62-31)
+            uint64_t r = round_shr(g, 31 - e);
+
+            // round to nearest: r^2 - r < N <= r^2 + r; r is off by at most 1, unless the result has more bits
+            //   than y is precise
+            bool up, down;
+            do
+            {
+                uint64_t lo, hi = sixit::dmath::mathf::__umul64x64(r, r, &lo);
+                uint64_t plo = lo + r, phi = hi + (plo < r);
+                uint64_t mlo = lo - r, mhi = hi - (lo < r);
+                up = (nhi > phi) | ((nhi == phi) & (nlo > plo));
+                down = (nhi < mhi) | ((nhi == mhi) & (nlo <= mlo));
+                r += uint64_t(up) - uint64_t(down);
+            } while (bits > 59 && (up || down));
+            return int64_t(r);
+        }
+
+        // OUT_NBITS: NBITS of the result, it defines how many bits have to be precise; results which don't fit into
+        //   OUT_NBITS saturate to the largest value
+        template <int F, int OUT_NBITS>
+        static constexpr int64_t exp(int64_t x)
+        {
+            constexpr int64_t max_data = int64_t((uint64_t(1) << (OUT_NBITS - 1)) - 1);
+
+            // |x|*log2(e) = (hi:lo:lo2) * 2^-(127+F)
+            uint64_t ux = uabs(x);
+            uint64_t lo, lo2;
+            uint64_t hi = sixit::dmath::mathf::__umul64x64(ux, d::log2e[0], &lo);
+            uint64_t hi2 = sixit::dmath::mathf::__umul64x64(ux, d::log2e[1], &lo2);
+            lo += hi2;
+            hi += lo < hi2;
+
+            // x*log2(e) = n + f, f in [0, 1)
+            uint64_t un = shr128(hi, lo, 63 + F);
+            if (un > 128)
+                return x < 0 ? 0 : max_data;
+            int n = int(un);
+
+            if constexpr (OUT_NBITS <= 60)
+            {
+                // results below 2^59 (in units of the last bit) need ~2^-62 relative precision, so 64-bit words do
+                uint64_t f = shr128(hi, lo, F - 1); // Q64
+                if (x < 0)
+                {
+                    n = -n;
+                    if (f != 0)
+                    {
+                        n -= 1;
+                        f = uint64_t(0) - f;
+                    }
+                }
+
+                // 2^f = 2^(j/32) * e^g, g = (f - j/32)*ln(2) < ln(2)/32 (Q64)
+                unsigned j = unsigned(f >> 59);
+                uint64_t g = mul_hi(f & ((uint64_t(1) << 59) - 1), d::ln2);
+                constexpr int nt = terms(d::exp_bits, OUT_NBITS + 2);
+                uint64_t p = d::exp_coeffs[nt - 1];
+                for (int k = nt - 1; k-- > 0;)
+                    p = d::exp_coeffs[k] + mul_hi(g, p);
+                uint64_t r = mul_hi(d::exp2_tab[j], p); // 2^f, Q62
+
+                // r * 2^n * 2^F / 2^62
+                int s = 62 - n - F;
+                if (s < 0)
+                    return max_data;
+                uint64_t rv = round_shr(r, s);
+                return rv > uint64_t(max_data) ? max_data : int64_t(rv);
+            }
+            else
+            {
+                // up to 63 significant bits: 2^f is computed to ~2^-70, with f, g, e^g - 1 and the table in
+                //   128 bits (Q128, Q128, Q128 and Q127); only the tail of the Taylor series is 64-bit
+                uint64_t fh, fl;
+                if constexpr (F == 0)
+                {
+                    fh = (lo << 1) | (lo2 >> 63);
+                    fl = lo2 << 1;
+                }
+                else
+                {
+                    fh = shr128(hi, lo, F - 1);
+                    fl = shr128(lo, lo2, F - 1);
+                }
+                if (x < 0)
+                {
+                    n = -n;
+                    if ((fh | fl) != 0)
+                    {
+                        n -= 1;
+                        fl = uint64_t(0) - fl;
+                        fh = ~fh + (fl == 0);
+                    }
+                }
+
+                // 2^f = 2^(j/32) * e^g, g = (f - j/32)*ln(2) < ln(2)/32
+                unsigned j = unsigned(fh >> 59);
+                uint64_t fr = fh & ((uint64_t(1) << 59) - 1);
+                uint64_t gl, gh = sixit::dmath::mathf::__umul64x64(fr, d::ln2_wide[0], &gl);
+                uint64_t t = mul_hi(fr, d::ln2_wide[1]);
+                gl += t;
+                gh += gl < t;
+                t = mul_hi(fl, d::ln2_wide[0]);
+                gl += t;
+                gh += gl < t;
+
+                // e^g - 1 = g + g^2*(1/2! + g*(1/3! + ...)), the tail is below 2^-12
+                uint64_t p = d::exp_coeffs[8];
+                for (int k = 8; k-- > 2;)
+                    p = d::exp_coeffs[k] + mul_hi(gh, p);
+                uint64_t g2l, g2h = sixit::dmath::mathf::__umul64x64(gh, gh, &g2l);
+                uint64_t el, eh = sixit::dmath::mathf::__umul64x64(g2h, p, &el);
+                eh = (eh << 1) | (el >> 63);
+                el <<= 1;
+                t = mul_hi(g2l, p) << 1;
+                el += t;
+                eh += el < t;
+                el += gl;
+                eh += gh + (el < gl);
+
+                // 2^(j/32) * e^g = a + a*(e^g - 1), Q127
+                int64_t tl = d::exp2_tab_lo[j];
+                uint64_t ah = d::exp2_tab[j] - uint64_t(tl < 0);
+                uint64_t al = uint64_t(tl);
+                uint64_t rl, rh = sixit::dmath::mathf::__umul64x64(ah, eh, &rl);
+                t = mul_hi(ah, el);
+                rl += t;
+                rh += rl < t;
+                t = mul_hi(al, eh);
+                rl += t;
+                rh += rl < t;
+                rl += al;
+                rh += ah + (rl < al);
+
+                // r * 2^n * 2^F / 2^127, r in [2^127, 2^128)
+                int s = 127 - n - F;
+                if (s <= 64)
+                    return max_data;
+                uint64_t rv = round_shr128(rh, s);
+                return rv > uint64_t(max_data) ? max_data : int64_t(rv);
+            }
+        }
+
+        // FO: fractional bits of the result
+        template <int F, int FO = F>
+        static constexpr int64_t log(int64_t x)
+        {
+            assert(x > 0);
+            if (x <= 0)
+                return 0;
+
+            // x * 2^-F = 2^k * m, m in [1, 2) (Q63)
+            int bw = int(std::bit_width(uint64_t(x)));
+            int k = bw - 1 - F;
+            uint64_t m = uint64_t(x) << (64 - bw);
+
+            // ln(m) = log1p(m*c_j - 1) - ln(c_j), m*c_j - 1 in [0, 1/64]
+            unsigned j = unsigned(m >> 57) & 63;
+            uint64_t u = mul_q63(m, d::log_c[j]) - (uint64_t(1) << 63);
+            constexpr int n = terms(d::log_bits, FO + 3);
+            uint64_t p = d::log_inv[n - 1];
+            for (int i = n - 1; i-- > 0;)
+                p = d::log_inv[i] - mul_q63(u, p);
+            uint64_t l = (d::log_t[j] + mul_q63(u, p)) << 1; // ln(m), Q64
+
+            // |k*ln(2) + ln(m)|, Q64; for k < 0, the result is negative
+            uint64_t lo, hi = sixit::dmath::mathf::__umul64x64(uint64_t(k < 0 ? -k : k), d::ln2, &lo);
+            if (k >= 0)
+            {
+                lo += l;
+                hi += lo < l;
+            }
+            else
+            {
+                hi -= lo < l;
+                lo -= l;
+            }
+
+            // to FO fractional bits, rounded
+            uint64_t half = uint64_t(1) << (63 - FO);
+            lo += half;
+            hi += lo < half;
+            assert(shr128(hi, lo, 127 - FO) == 0); // overflow
+            int64_t rv = int64_t(shr128(hi, lo, 64 - FO));
+            return k < 0 ? -rv : rv;
+        }
+    };
+} // namespace sixit::dmath
+
+#endif // sixit_dmath_fixedpoint___fixed_point_mathf_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Mykhailo Borovyk
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
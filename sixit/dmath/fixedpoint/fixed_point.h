@@ -12,6 +12,7 @@ Contributors: Sherry Ignatchenko, Mykhailo Borovyk
 #include <type_traits>
 
 #include <sixit/dmath/traits.h>
+#include <sixit/dmath/fixedpoint/__fixed_point_mathf.h>
 #include <sixit/core/lwa.h>
 #include <sixit/core/guidelines.h>
 #include <sixit/rw/rw.h>
@@ -30,49 +31,6 @@ namespace sixit::dmath {
     template<uint8_t NBITS, uint8_t NORMALIZED_BITS, class fallback_type>
     struct fp_traits<fixed_point<NBITS, NORMALIZED_BITS, fallback_type>>;
 
-    class rational
-    {
-        template<uint8_t MBITS, uint8_t NORMALIZED_BITS, class fallback_type>
-        friend class fixed_point;
-
-    public:
-
-        //friend float operator*(const float& lhs, const rational& rhs) 
-        //{
-        //    float result = lhs * float(rhs.numerator) / float(rhs.denominator);
-        //    return result;
-        //}
-
-        int32_t numerator = 0;
-        int32_t denominator = 0;
-
-    private:
-        inline rational(int32_t _numerator, int32_t _denominator) : numerator(_numerator), denominator(_denominator) {}
-        inline rational(int64_t _numerator, int64_t _denominator)
-        {
-            int32_t n_width = std::bit_width(sixit::lwa::bit_cast<uint64_t>(_numerator >= 0 ? _numerator : -_numerator));
-            int32_t d_width = std::bit_width(sixit::lwa::bit_cast<uint64_t>(_denominator >= 0 ? _denominator : -_denominator));
-
-            int32_t shift = std::max(n_width, d_width) - 31;
-            if (shift > 0)
-            {
-                auto dd = 1 << shift;
-                numerator = sixit::guidelines::narrow_cast<int32_t>(_numerator / dd);
-                denominator = sixit::guidelines::narrow_cast<int32_t>(_denominator / dd);
-            }
-            else
-            {
-                numerator = sixit::guidelines::narrow_cast<int32_t>(_numerator);
-                denominator = sixit::guidelines::narrow_cast<int32_t>(_denominator);
-            }
-        }
-
-    public:
-        inline rational(const rational& other) = default;
-        inline rational& operator=(const rational& other) = default;
-    };
-
-
     template<uint8_t NBITS, uint8_t NORMALIZED_BITS, class fallback_type>
     class fixed_point
     {
@@ -122,6 +80,62 @@ namespace sixit::dmath {
             return mantissa_width < 0 || mantissa_width < NBITS;
         }
 
+        // results which don't fit into 64 bits: exact 128-bit a*b (or a*2^sa + b*2^sb), then shifted right by s,
+        //   rounded to nearest (ties away from zero, as in operator/)
+        static inline int64_t wide_mul_round_shr(int64_t a, int64_t b, int s)
+        {
+            assert(s >= 1 && s <= 63);
+            uint64_t lo;
+            uint64_t hi = sixit::dmath::mathf::__umul64x64(__fixed_point_mathf::uabs(a), __fixed_point_mathf::uabs(b), &lo);
+            uint64_t half = uint64_t(1) << (s - 1);
+            lo += half;
+            hi += lo < half;
+            int64_t m = sixit::lwa::bit_cast<int64_t>((hi << (64 - s)) | (lo >> s));
+            return (a ^ b) < 0 ? -m : m;
+        }
+
+        static inline int64_t wide_add_round_shr(int64_t a, int sa, int64_t b, int sb, int s)
+        {
+            assert(sa >= 0 && sa <= 63 && sb >= 0 && sb <= 63 && s >= 1 && s <= 63);
+            // two's complement 128-bit hi:lo
+            uint64_t alo = sixit::lwa::bit_cast<uint64_t>(a) << sa;
+            uint64_t ahi = sixit::lwa::bit_cast<uint64_t>(sa == 0 ? a >> 63 : a >> (64 - sa));
+            uint64_t blo = sixit::lwa::bit_cast<uint64_t>(b) << sb;
+            uint64_t bhi = sixit::lwa::bit_cast<uint64_t>(sb == 0 ? b >> 63 : b >> (64 - sb));
+            uint64_t lo = alo + blo;
+            uint64_t hi = ahi + bhi + (lo < alo);
+
+            bool negative = (hi >> 63) != 0;
+            if (negative)
+            {
+                lo = ~lo + 1;
+                hi = ~hi + (lo == 0);
+            }
+            uint64_t half = uint64_t(1) << (s - 1);
+            lo += half;
+            hi += lo < half;
+            int64_t m = sixit::lwa::bit_cast<int64_t>((hi << (64 - s)) | (lo >> s));
+            return negative ? -m : m;
+        }
+
+        // exact comparison with another NORMALIZED_BITS: a*2^d vs b is a vs b/2^d, the remainder breaking the tie
+        template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
+        inline int compare(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
+        {
+            if constexpr (NORMALIZED_BITS_OTHER == NORMALIZED_BITS)
+                return data < other.data ? -1 : (data > other.data ? 1 : 0);
+            else if constexpr (NORMALIZED_BITS_OTHER < NORMALIZED_BITS)
+                return -other.compare(*this);
+            else
+            {
+                constexpr int D = NORMALIZED_BITS_OTHER - NORMALIZED_BITS;
+                int64_t a = int64_t(data);
+                int64_t bq = int64_t(other.data) >> D;
+                bool br = (sixit::lwa::bit_cast<uint64_t>(int64_t(other.data)) & ((uint64_t(1) << D) - 1)) != 0;
+                return a < bq ? -1 : (a > bq ? 1 : (br ? -1 : 0));
+            }
+        }
+
     public:
 
         underlying_type data = 0;
@@ -198,20 +212,17 @@ namespace sixit::dmath {
         //    //data = sign ? -underlying_type(umantissa) : underlying_type(umantissa);
         //}
 
-        // from other fixed_point with another NBITS2 and NORMALIZED_BITS2
+        // from other fixed_point with another NBITS2 and NORMALIZED_BITS2; to fewer NORMALIZED_BITS it is rounded
+        //   to nearest (ties away from zero, as in operator/)
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline fixed_point(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other)
         {
-            // at the moment only conversion with the same NORMALIZED_BITS is allowed
-            // technically it's possible to convert from anonther NORMALIZED_BITS
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-
-            if constexpr (NBITS_OTHER <= NBITS)
+            if constexpr (NORMALIZED_BITS_OTHER == NORMALIZED_BITS && NBITS_OTHER <= NBITS)
             {
                 // conversion to wider type without check
                 data = other.data;
             }
-            else
+            else if constexpr (NORMALIZED_BITS_OTHER == NORMALIZED_BITS)
             {
                 //check from wider type
                 usigned_underlying_type umantissa = other.data < 0 ? usigned_underlying_type(-other.data) : usigned_underlying_type(other.data);
@@ -220,22 +231,49 @@ namespace sixit::dmath {
 
                 data = other.data;
             }
+            else if constexpr (NORMALIZED_BITS_OTHER < NORMALIZED_BITS)
+            {
+                constexpr int D = NORMALIZED_BITS - NORMALIZED_BITS_OTHER;
+                if constexpr (NBITS_OTHER + D > NBITS)
+                    assert(int(std::bit_width(__fixed_point_mathf::uabs(other.data))) + D < NBITS);
+
+                data = underlying_type(int64_t(other.data) * (int64_t(1) << D));
+            }
+            else
+            {
+                constexpr int D = NORMALIZED_BITS_OTHER - NORMALIZED_BITS;
+                int64_t m = int64_t((__fixed_point_mathf::uabs(other.data) + (uint64_t(1) << (D - 1))) >> D);
+                int64_t v = other.data < 0 ? -m : m;
+                if constexpr (NBITS_OTHER - D >= NBITS)
+                    assert(std::bit_width(__fixed_point_mathf::uabs(v)) < NBITS);
+
+                data = underlying_type(v);
+            }
         }
 
         // unary minus
         inline auto operator-() const { return fixed_point<NBITS, NORMALIZED_BITS, fallback_type>(-data); }
 
-        // addition-subtruction available between any NBITS but the same  NORMALIZED_BITS
+        // addition-subtruction available between any NBITS and NORMALIZED_BITS; the operand with fewer NORMALIZED_BITS
+        //   is shifted (exactly) to the other one
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline auto operator + (const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         {
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            constexpr uint8_t OUT_NBITS = std::max(NBITS, NBITS_OTHER) + 1;
+            constexpr uint8_t OUT_NORMALIZED_BITS = std::max(NORMALIZED_BITS, NORMALIZED_BITS_OTHER);
+            constexpr int SHIFT = OUT_NORMALIZED_BITS - NORMALIZED_BITS;
+            constexpr int SHIFT_OTHER = OUT_NORMALIZED_BITS - NORMALIZED_BITS_OTHER;
+            constexpr uint8_t OUT_NBITS = std::max(NBITS + SHIFT, NBITS_OTHER + SHIFT_OTHER) + 1;
 
             if constexpr (OUT_NBITS <= 64)
             {
                 using result_underlying_type = typename std::conditional<OUT_NBITS <= 32, int32_t, int64_t>::type;
-                return fixed_point<OUT_NBITS, NORMALIZED_BITS, fallback_type>(result_underlying_type(data) + result_underlying_type(other.data));
+                return fixed_point<OUT_NBITS, OUT_NORMALIZED_BITS, fallback_type>(result_underlying_type(data) * (result_underlying_type(1) << SHIFT) + result_underlying_type(other.data) * (result_underlying_type(1) << SHIFT_OTHER));
+            }
+            else if constexpr (OUT_NORMALIZED_BITS > OUT_NBITS - 64)
+            {
+                // renormalized to 64 bits: the extra OUT_NBITS - 64 lowest fractional bits are rounded off
+                constexpr uint8_t WIDE_SHIFT = OUT_NBITS - 64;
+                return fixed_point<64, OUT_NORMALIZED_BITS - WIDE_SHIFT, fallback_type>(wide_add_round_shr(int64_t(data), SHIFT, int64_t(other.data), SHIFT_OTHER, WIDE_SHIFT));
             }
             else
             {
@@ -247,13 +285,21 @@ namespace sixit::dmath {
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline auto operator - (const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         {
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            constexpr uint8_t OUT_NBITS = std::max(NBITS, NBITS_OTHER) + 1;
+            constexpr uint8_t OUT_NORMALIZED_BITS = std::max(NORMALIZED_BITS, NORMALIZED_BITS_OTHER);
+            constexpr int SHIFT = OUT_NORMALIZED_BITS - NORMALIZED_BITS;
+            constexpr int SHIFT_OTHER = OUT_NORMALIZED_BITS - NORMALIZED_BITS_OTHER;
+            constexpr uint8_t OUT_NBITS = std::max(NBITS + SHIFT, NBITS_OTHER + SHIFT_OTHER) + 1;
 
             if constexpr (OUT_NBITS <= 64)
             {
                 using result_underlying_type = typename std::conditional<OUT_NBITS <= 32, int32_t, int64_t>::type;
-                return fixed_point<OUT_NBITS, NORMALIZED_BITS, fallback_type>(result_underlying_type(data) - result_underlying_type(other.data));
+                return fixed_point<OUT_NBITS, OUT_NORMALIZED_BITS, fallback_type>(result_underlying_type(data) * (result_underlying_type(1) << SHIFT) - result_underlying_type(other.data) * (result_underlying_type(1) << SHIFT_OTHER));
+            }
+            else if constexpr (OUT_NORMALIZED_BITS > OUT_NBITS - 64)
+            {
+                // renormalized to 64 bits: the extra OUT_NBITS - 64 lowest fractional bits are rounded off
+                constexpr uint8_t WIDE_SHIFT = OUT_NBITS - 64;
+                return fixed_point<64, OUT_NORMALIZED_BITS - WIDE_SHIFT, fallback_type>(wide_add_round_shr(int64_t(data), SHIFT, -int64_t(other.data), SHIFT_OTHER, WIDE_SHIFT));
             }
             else
             {
@@ -267,15 +313,21 @@ namespace sixit::dmath {
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline auto operator * (const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         {
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
+            // fractional bits of the operands are added, so any NORMALIZED_BITS are fine without shifts
             constexpr uint8_t OUT_NBITS = NBITS + NBITS_OTHER - 1;
-            constexpr uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS + NORMALIZED_BITS - 1;
+            constexpr uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS + NORMALIZED_BITS_OTHER - 1;
 
             if constexpr (OUT_NORMALIZED_BITS <= 64 && OUT_NBITS <= 64)
             {
                 using result_underlying_type = typename std::conditional<OUT_NBITS <= 32, int32_t, int64_t>::type;
                 return fixed_point<OUT_NBITS, OUT_NORMALIZED_BITS, fallback_type>(result_underlying_type(data) * result_underlying_type(other.data));
             }
+            else if constexpr (OUT_NORMALIZED_BITS > OUT_NBITS - 64)
+            {
+                // renormalized to 64 bits: the extra OUT_NBITS - 64 lowest fractional bits are rounded off
+                constexpr uint8_t SHIFT = OUT_NBITS - 64;
+                return fixed_point<64, OUT_NORMALIZED_BITS - SHIFT, fallback_type>(wide_mul_round_shr(int64_t(data), int64_t(other.data), SHIFT));
+            }
             else
             {
                 fallback_type a = fallback_type(*this);
@@ -284,61 +336,71 @@ namespace sixit::dmath {
             }
         }
 
+        // division stays in fixed point, rounded to nearest (ties away from zero);
+        //   the result has NORMALIZED_BITS of *this, and the smallest non-zero divisor is 1 unit of other, so it needs
+        //   NORMALIZED_BITS_OTHER - 1 more bits than *this.
+        //   Results wider than 64 bits are renormalized to 64 by dropping the lowest fractional bits; either way
+        //   the dividend (data << fractional bits of the result) fits into 64 bits, so it is one exact 64-bit
+        //   integer division
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline auto operator / (const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         {
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return rational(data, other.data);
-        }
+            constexpr uint8_t OUT_NBITS = NBITS + NORMALIZED_BITS_OTHER - 1;
+            constexpr uint8_t SHIFT = OUT_NBITS > 64 ? OUT_NBITS - 64 : 0;
 
-        // multiplication-division with rational
-        inline auto operator * (const rational& r) const
-        {
-            fallback_type result = (fallback_type(*this) * fallback_type(r.numerator)) / fallback_type(r.denominator);
-            return result;
-        }
-        inline fallback_type operator / (const rational& r) const
-        {
-            fallback_type result = (fallback_type(*this) * fallback_type(r.denominator)) / fallback_type(r.numerator);
-            return result;
+            if constexpr (SHIFT < NORMALIZED_BITS)
+            {
+                assert(other.data != 0);
+
+                int64_t n = int64_t(data) * (int64_t(1) << (NORMALIZED_BITS_OTHER - 1 - SHIFT));
+                int64_t d = int64_t(other.data);
+                int64_t q = n / d;
+                uint64_t ur = sixit::lwa::bit_cast<uint64_t>(n % d < 0 ? -(n % d) : n % d);
+                uint64_t ud = sixit::lwa::bit_cast<uint64_t>(d < 0 ? -d : d);
+                if (ur >= ud - ur)
+                    q += (n ^ d) < 0 ? -1 : 1;
+
+                using result_underlying_type = typename std::conditional<OUT_NBITS - SHIFT <= 32, int32_t, int64_t>::type;
+                return fixed_point<OUT_NBITS - SHIFT, NORMALIZED_BITS - SHIFT, fallback_type>(sixit::guidelines::narrow_cast<result_underlying_type>(q));
+            }
+            else
+            {
+                fallback_type a = fallback_type(*this);
+                fallback_type b = fallback_type(other);
+                return fallback_type(a / b);
+            }
         }
 
-        // comparison: we can compare with ANY other fixed_point_xx, but the same NORMALIZED_BITS
+        // comparison: we can compare with ANY other fixed_point_xx, exactly
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline bool operator<(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         {
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return data < other.data; 
+            return compare(other) < 0;
         }
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline bool operator>(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         { 
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return data > other.data; 
+            return compare(other) > 0;
         }
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline bool operator<=(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         { 
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return data <= other.data;
+            return compare(other) <= 0;
         };
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline bool operator>=(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         { 
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return data >= other.data;
+            return compare(other) >= 0;
         };
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline bool operator==(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         { 
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return data == other.data; 
+            return compare(other) == 0;
         }
         template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
         inline bool operator!=(const fixed_point<NBITS_OTHER, NORMALIZED_BITS_OTHER, fallback_type_other>& other) const
         { 
-            static_assert(NORMALIZED_BITS_OTHER == NORMALIZED_BITS);
-            return data != other.data;
+            return compare(other) != 0;
         }
     };
 
@@ -365,34 +427,74 @@ namespace sixit::dmath {
             return fallback_type(val);
         }
 
-        static auto multiply_by_coefficient(const fixed_point_type& fp, const rational& r)
+        // native mathf::recip(): 1 / x as fixed_point division (see operator / above), so it stays in fixed point
+        //   and is rounded to nearest, instead of going through fallback_type
+        static auto mathf_recip(const fixed_point_type& x) requires(NORMALIZED_BITS < 64)
         {
-            assert(r.denominator != 0);
+            constexpr uint8_t ONE_NBITS = std::max<uint8_t>(16, NORMALIZED_BITS + 1);
+            using one_underlying_type = typename std::conditional<ONE_NBITS <= 32, int32_t, int64_t>::type;
+            constexpr one_underlying_type one_data = one_underlying_type(1) << (NORMALIZED_BITS - 1);
+            return fixed_point<ONE_NBITS, NORMALIZED_BITS, fallback_type>(one_data) / x;
+        }
 
-            int64_t tmp_data = int64_t(fp.data) * int64_t(r.numerator) * 2;
-            tmp_data /= r.denominator;
-            bool is_last_bit = tmp_data & 1;
-            int64_t last_bit_offset = is_last_bit ? (tmp_data > 0 ? 1 : -1) : 0;
-            tmp_data = tmp_data / 2 + last_bit_offset;
+        // native mathf::sin() etc. (see __fixed_point_mathf.h): integers only, no conversions to fallback_type;
+        //   results have the same NORMALIZED_BITS, and NBITS wide enough for their range. Exceptions: with 64-bit
+        //   internal words, sin()/cos() are precise to 60 fractional bits and atan2() to 53, so their results
+        //   have at most that many; log() results which would need more than 64 bits are renormalized to 64 by
+        //   dropping the lowest fractional bits; exp() results which don't fit saturate to the largest value
+        static auto mathf_sin(const fixed_point_type& x) requires(NORMALIZED_BITS <= 62)
+        {
+            constexpr uint8_t OUT_NORMALIZED_BITS = std::min<uint8_t>(NORMALIZED_BITS, 61);
+            constexpr uint8_t OUT_NBITS = std::max<uint8_t>(NBITS, OUT_NORMALIZED_BITS + 1);
+            return from_data<OUT_NBITS, OUT_NORMALIZED_BITS>(__fixed_point_mathf::sin<NORMALIZED_BITS - 1, OUT_NORMALIZED_BITS - 1>(x.data));
+        }
 
-            // realtime narrow cast
-            int32_t data32 = sixit::guidelines::narrow_cast<int32_t>(tmp_data);
-            return fixed_point_type(data32);
+        static auto mathf_cos(const fixed_point_type& x) requires(NORMALIZED_BITS <= 62)
+        {
+            constexpr uint8_t OUT_NORMALIZED_BITS = std::min<uint8_t>(NORMALIZED_BITS, 61);
+            constexpr uint8_t OUT_NBITS = std::max<uint8_t>(NBITS, OUT_NORMALIZED_BITS + 1);
+            return from_data<OUT_NBITS, OUT_NORMALIZED_BITS>(__fixed_point_mathf::cos<NORMALIZED_BITS - 1, OUT_NORMALIZED_BITS - 1>(x.data));
         }
 
-        static auto divide_by_coefficient(const fixed_point_type& fp, const rational& r)
+        static auto mathf_atan2(const fixed_point_type& y, const fixed_point_type& x) requires(NORMALIZED_BITS <= 62)
         {
-            assert(r.numerator != 0);
+            constexpr uint8_t OUT_NORMALIZED_BITS = std::min<uint8_t>(NORMALIZED_BITS, 54);
+            constexpr uint8_t OUT_NBITS = std::max<uint8_t>(NBITS, OUT_NORMALIZED_BITS + 2);
+            return from_data<OUT_NBITS, OUT_NORMALIZED_BITS>(__fixed_point_mathf::atan2<OUT_NORMALIZED_BITS - 1>(y.data, x.data));
+        }
 
-            int64_t tmp_data = int64_t(fp.data) * int64_t(r.denominator) * 2;
-            tmp_data /= r.numerator;
-            bool is_last_bit = tmp_data & 1;
-            int64_t last_bit_offset = is_last_bit ? (tmp_data > 0 ? 1 : -1) : 0;
-            tmp_data = tmp_data / 2 + last_bit_offset;
+        static auto mathf_sqrt(const fixed_point_type& x) requires(NORMALIZED_BITS <= 62)
+        {
+            return from_data<NBITS>(__fixed_point_mathf::sqrt<NORMALIZED_BITS - 1, NBITS>(x.data));
+        }
 
-            // realtime narrow cast
-            int32_t data32 = sixit::guidelines::narrow_cast<int32_t>(tmp_data);
-            return fixed_point_type(data32);
+        static auto mathf_exp(const fixed_point_type& x) requires(NORMALIZED_BITS <= 62)
+        {
+            // |x| < 2^(NBITS - NORMALIZED_BITS), so exp(x) < 2^(2^(NBITS - NORMALIZED_BITS) * log2(e)); capped at 64 bits
+            constexpr double max_log2 = double(uint64_t(1) << (NBITS - NORMALIZED_BITS)) * 1.4426950408889634;
+            constexpr uint64_t int_bits = max_log2 < 64 ? uint64_t(max_log2) + 1 : 64;
+            constexpr uint8_t OUT_NBITS = uint8_t(std::min<uint64_t>(64, std::max<uint64_t>(NBITS, NORMALIZED_BITS + int_bits)));
+            return from_data<OUT_NBITS>(__fixed_point_mathf::exp<NORMALIZED_BITS - 1, OUT_NBITS>(x.data));
+        }
+
+        static auto mathf_log(const fixed_point_type& x) requires(NORMALIZED_BITS <= 62)
+        {
+            // |log(x)| <= max(NORMALIZED_BITS - 1, NBITS - NORMALIZED_BITS) * ln(2)
+            constexpr double max_abs = double(std::max(NORMALIZED_BITS - 1, NBITS - NORMALIZED_BITS)) * 0.6931471805599453;
+            constexpr int int_bits = std::bit_width(uint64_t(max_abs) + 1);
+            constexpr int WANT_NBITS = std::max(int(NBITS), NORMALIZED_BITS + int_bits);
+            constexpr uint8_t SHIFT = uint8_t(WANT_NBITS > 64 ? WANT_NBITS - 64 : 0);
+            constexpr uint8_t OUT_NBITS = uint8_t(WANT_NBITS - SHIFT);
+            constexpr uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS - SHIFT;
+            return from_data<OUT_NBITS, OUT_NORMALIZED_BITS>(__fixed_point_mathf::log<NORMALIZED_BITS - 1, OUT_NORMALIZED_BITS - 1>(x.data));
+        }
+
+    private:
+        template<uint8_t OUT_NBITS, uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS>
+        static auto from_data(int64_t data)
+        {
+            using result_underlying_type = typename std::conditional<OUT_NBITS <= 32, int32_t, int64_t>::type;
+            return fixed_point<OUT_NBITS, OUT_NORMALIZED_BITS, fallback_type>(sixit::guidelines::narrow_cast<result_underlying_type>(data));
         }
     };
 
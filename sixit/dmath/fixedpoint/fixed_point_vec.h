@@ -0,0 +1,474 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Mykhailo Borovyk
+*/
+
+/*
+* fixed_point_vec<NBITS, NORMALIZED_BITS, N>: N lanes of fixed_point<NBITS, NORMALIZED_BITS>, processed together.
+*
+* Result types are the same as for the scalar operators of fixed_point (e.g. fx32 * fx32 lanes are
+* fixed_point<61, 59> lanes), and as it is all integer arithmetic, every lane is bit-identical to the scalar
+* operation whatever instructions are used. With GCC/Clang, lanes are processed as generic vectors
+* (`__attribute__((vector_size))`, as in softfloat_lanes.h), so add/sub/compare become paddd/psubd/pcmpgtd
+* (NEON add/sub/cmgt); compilers don't recognize a widening multiplication of generic vectors, so the
+* 32x32->64 one (e.g. fx32 * fx32) is explicitly pmuldq (_mm_mul_epi32(), SSE4.1; vpmuldq with AVX2) or
+* smull (vmull_s32(), ARM64). Everywhere else it is plain loops over lanes.
+*
+* Only the same NORMALIZED_BITS and the same N can be mixed, and only results fitting into 64 bits are
+* supported (no renormalization as in the scalar operators); converting constructor (lane by lane, with
+* the scalar conversion) changes NBITS and NORMALIZED_BITS.
+*/
+
+#ifndef SIXIT_FIXED_POINT_VEC_H
+#define SIXIT_FIXED_POINT_VEC_H
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+#include <type_traits>
+
+#include <sixit/dmath/fixedpoint/fixed_point.h>
+#include <sixit/dmath/gamefloat/simd_float.h>
+
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__))
+#define SIXIT_FIXED_POINT_VEC_VECTOR_EXTENSIONS
+#if defined(__AVX512F__)
+#define SIXIT_FIXED_POINT_VEC_NATIVE_BYTES 64
+#elif defined(__AVX__)
+#define SIXIT_FIXED_POINT_VEC_NATIVE_BYTES 32
+#else
+#define SIXIT_FIXED_POINT_VEC_NATIVE_BYTES 16
+#endif
+// loops over chunks must be unrolled for lanes to stay in registers, and -O2 doesn't do it
+#define SIXIT_FIXED_POINT_VEC_UNROLL _Pragma("GCC unroll 16")
+#else
+#define SIXIT_FIXED_POINT_VEC_UNROLL
+#endif
+
+namespace sixit::dmath {
+
+    template<uint8_t NBITS, uint8_t NORMALIZED_BITS, size_t N, class fallback_type = float>
+    class fixed_point_vec
+    {
+        template<uint8_t NBITS2, uint8_t NORMALIZED_BITS2, size_t N2, class fallback_type2>
+        friend class fixed_point_vec;
+
+        static_assert(N > 0);
+        using lane_type = fixed_point<NBITS, NORMALIZED_BITS, fallback_type>;
+        using underlying_type = typename std::conditional<NBITS <= 32, int32_t, int64_t>::type;
+
+#ifdef SIXIT_FIXED_POINT_VEC_VECTOR_EXTENSIONS
+        // lanes of R are processed in chunks of at most one native register; vector_size must be a power of 2,
+        //   so other N go lane by lane
+        template<typename R>
+        static constexpr size_t chunk = std::min(N, size_t(SIXIT_FIXED_POINT_VEC_NATIVE_BYTES) / sizeof(R));
+
+        static constexpr bool use_vectors = std::has_single_bit(N);
+
+        template<typename T, size_t C>
+        struct vector_of
+        {
+            // NB: alias templates lose vector_size attribute in GCC, hence the struct
+            typedef T type __attribute__((vector_size(C * sizeof(T))));
+        };
+
+        template<typename R, size_t C, typename T>
+        static inline typename vector_of<R, C>::type load_as(const T* src)
+        {
+            typename vector_of<T, C>::type v;
+            memcpy(&v, src, sizeof(v));
+            return __builtin_convertvector(v, typename vector_of<R, C>::type);
+        }
+
+        // b of the operations below is either lanes (a pointer), or a scalar, the same for all the lanes; as for
+        //   scalars `vector op scalar` works on generic vectors too, broadcasting never goes through memory
+        template<typename R, size_t C, typename B>
+        static inline auto operand_as(B b, size_t i)
+        {
+            if constexpr (std::is_pointer_v<B>)
+                return load_as<R, C>(b + i);
+            else
+                return R(b);
+        }
+#endif
+
+        template<typename R, typename B>
+        static inline R lane_as(B b, size_t i)
+        {
+            if constexpr (std::is_pointer_v<B>)
+                return R(b[i]);
+            else
+                return R(b);
+        }
+
+        // rv[i] = f(R(a[i]), R(b[i])); f is called either on vectors, or on scalars
+        template<typename R, typename A, typename B, typename F>
+        static inline void lanewise(const A* a, B b, R* rv, F f)
+        {
+#ifdef SIXIT_FIXED_POINT_VEC_VECTOR_EXTENSIONS
+            if constexpr (use_vectors)
+            {
+                constexpr size_t C = chunk<R>;
+                SIXIT_FIXED_POINT_VEC_UNROLL
+                for (size_t i = 0; i < N; i += C)
+                {
+                    typename vector_of<R, C>::type v = f(load_as<R, C>(a + i), operand_as<R, C>(b, i));
+                    memcpy(rv + i, &v, sizeof(v));
+                }
+                return;
+            }
+#endif
+            for (size_t i = 0; i < N; ++i)
+                rv[i] = f(R(a[i]), lane_as<R>(b, i));
+        }
+
+        // all-ones or all-zeros lanes of R where pred(R(a[i]), R(b[i])), as simd_mask
+        template<typename R, typename A, typename B, typename F>
+        static inline simd_mask<N> lanewise_mask(const A* a, B b, F pred)
+        {
+            simd_mask<N> rv;
+#ifdef SIXIT_FIXED_POINT_VEC_VECTOR_EXTENSIONS
+            if constexpr (use_vectors)
+            {
+                constexpr size_t C = chunk<R>;
+                SIXIT_FIXED_POINT_VEC_UNROLL
+                for (size_t i = 0; i < N; i += C)
+                {
+                    auto m = __builtin_convertvector(pred(load_as<R, C>(a + i), operand_as<R, C>(b, i)), typename vector_of<int32_t, C>::type);
+                    memcpy(rv.data() + i, &m, sizeof(m));
+                }
+                return rv;
+            }
+#endif
+            for (size_t i = 0; i < N; ++i)
+                rv[i] = pred(R(a[i]), lane_as<R>(b, i)) ? UINT32_C(0xffff'ffff) : 0;
+            return rv;
+        }
+
+        // rv[i] = R(a[i]) * R(b[i])
+        template<typename R, typename A, typename B>
+        static inline void multiply(const A* a, B b, R* rv)
+        {
+            constexpr bool b_is_int32 = std::is_same_v<B, const int32_t*> || std::is_same_v<B, int32_t>;
+            if constexpr (std::is_same_v<A, int32_t> && b_is_int32 && std::is_same_v<R, int64_t>)
+            {
+#if defined(__AVX2__)
+                if constexpr (N % 4 == 0)
+                {
+                    SIXIT_FIXED_POINT_VEC_UNROLL
+                    for (size_t i = 0; i < N; i += 4)
+                    {
+                        __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+                        __m256i y;
+                        if constexpr (std::is_pointer_v<B>)
+                            y = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+                        else
+                            y = _mm256_set1_epi64x(b);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(rv + i), _mm256_mul_epi32(x, y));
+                    }
+                    return;
+                }
+#endif
+#if defined(__SSE4_1__) || defined(__AVX2__)
+                if constexpr (N % 2 == 0)
+                {
+                    SIXIT_FIXED_POINT_VEC_UNROLL
+                    for (size_t i = 0; i < N; i += 2)
+                    {
+                        __m128i x = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + i)));
+                        __m128i y;
+                        if constexpr (std::is_pointer_v<B>)
+                            y = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + i)));
+                        else
+                            y = _mm_set1_epi64x(b);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(rv + i), _mm_mul_epi32(x, y));
+                    }
+                    return;
+                }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+                if constexpr (N % 2 == 0)
+                {
+                    SIXIT_FIXED_POINT_VEC_UNROLL
+                    for (size_t i = 0; i < N; i += 2)
+                    {
+                        if constexpr (std::is_pointer_v<B>)
+                            vst1q_s64(rv + i, vmull_s32(vld1_s32(a + i), vld1_s32(b + i)));
+                        else
+                            vst1q_s64(rv + i, vmull_n_s32(vld1_s32(a + i), b));
+                    }
+                    return;
+                }
+#endif
+            }
+            lanewise(a, b, rv, [](auto x, auto y) { return x * y; });
+        }
+
+        // two's complement 128-bit hi:lo shifted right by s, rounded to nearest (ties away from zero, as in
+        //   fixed_point<> operations)
+        static inline int64_t wide_round_shr(uint64_t hi, uint64_t lo, int s)
+        {
+            assert(s >= 1 && s <= 63);
+            bool negative = (hi >> 63) != 0;
+            if (negative)
+            {
+                lo = ~lo + 1;
+                hi = ~hi + (lo == 0);
+            }
+            uint64_t half = uint64_t(1) << (s - 1);
+            lo += half;
+            hi += lo < half;
+            int64_t m = sixit::lwa::bit_cast<int64_t>((hi << (64 - s)) | (lo >> s));
+            return negative ? -m : m;
+        }
+
+        template<uint8_t OUT_NBITS>
+        using out_underlying_type = typename std::conditional<OUT_NBITS <= 32, int32_t, int64_t>::type;
+
+    public:
+
+        alignas(32) underlying_type data[N] = {};
+
+        static constexpr size_t lanes = N;
+
+        constexpr fixed_point_vec() = default;
+        inline fixed_point_vec(const fixed_point_vec& other) = default;
+        inline fixed_point_vec& operator=(const fixed_point_vec& other) = default;
+
+        // broadcast
+        inline explicit fixed_point_vec(const lane_type& val)
+        {
+            for (size_t i = 0; i < N; ++i)
+                data[i] = val.data;
+        }
+
+        // from other fixed_point_vec, lane by lane as scalar conversions (range-checked and/or rounded)
+        template<uint8_t NBITS_OTHER, uint8_t NORMALIZED_BITS_OTHER, class fallback_type_other>
+        inline explicit fixed_point_vec(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS_OTHER, N, fallback_type_other>& other)
+        {
+            for (size_t i = 0; i < N; ++i)
+                data[i] = lane_type(other[i]).data;
+        }
+
+        // fixed_point is nothing but its data, so arrays of them are copied as a whole
+        static inline fixed_point_vec load(const lane_type* src)
+        {
+            static_assert(sizeof(lane_type) == sizeof(underlying_type) && std::is_trivially_copyable_v<lane_type>);
+            fixed_point_vec rv;
+            memcpy(rv.data, src, sizeof(rv.data));
+            return rv;
+        }
+
+        inline void store(lane_type* dst) const
+        {
+            memcpy(dst, data, sizeof(data));
+        }
+
+        inline lane_type operator[](size_t i) const { return lane_type(data[i]); }
+        inline void set_lane(size_t i, const lane_type& val) { data[i] = val.data; }
+
+        // unary minus
+        inline auto operator-() const
+        {
+            fixed_point_vec rv;
+            lanewise(data, data, rv.data, [](auto x, auto) { return -x; });
+            return rv;
+        }
+
+        // addition-subtraction, multiplication: the same result types as for fixed_point lanes
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto operator + (const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            constexpr uint8_t OUT_NBITS = std::max(NBITS, NBITS_OTHER) + 1;
+            static_assert(OUT_NBITS <= 64);
+
+            fixed_point_vec<OUT_NBITS, NORMALIZED_BITS, N, fallback_type> rv;
+            lanewise(data, other.data, rv.data, [](auto x, auto y) { return x + y; });
+            return rv;
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto operator - (const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            constexpr uint8_t OUT_NBITS = std::max(NBITS, NBITS_OTHER) + 1;
+            static_assert(OUT_NBITS <= 64);
+
+            fixed_point_vec<OUT_NBITS, NORMALIZED_BITS, N, fallback_type> rv;
+            lanewise(data, other.data, rv.data, [](auto x, auto y) { return x - y; });
+            return rv;
+        }
+
+        // lanes are widened before multiplication; 32-bit lanes with a 64-bit result are one packed
+        //   32x32->64 signed multiplication (see multiply())
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto operator * (const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            constexpr uint8_t OUT_NBITS = NBITS + NBITS_OTHER - 1;
+            constexpr uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS + NORMALIZED_BITS - 1;
+            static_assert(OUT_NBITS <= 64);
+
+            fixed_point_vec<OUT_NBITS, OUT_NORMALIZED_BITS, N, fallback_type> rv;
+            multiply(data, other.data, rv.data);
+            return rv;
+        }
+
+        // with a scalar, as if it were broadcast to all the lanes
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto operator + (const fixed_point<NBITS_OTHER, NORMALIZED_BITS, fallback_type_other>& other) const
+        {
+            constexpr uint8_t OUT_NBITS = std::max(NBITS, NBITS_OTHER) + 1;
+            static_assert(OUT_NBITS <= 64);
+
+            fixed_point_vec<OUT_NBITS, NORMALIZED_BITS, N, fallback_type> rv;
+            lanewise(data, other.data, rv.data, [](auto x, auto y) { return x + y; });
+            return rv;
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto operator - (const fixed_point<NBITS_OTHER, NORMALIZED_BITS, fallback_type_other>& other) const
+        {
+            constexpr uint8_t OUT_NBITS = std::max(NBITS, NBITS_OTHER) + 1;
+            static_assert(OUT_NBITS <= 64);
+
+            fixed_point_vec<OUT_NBITS, NORMALIZED_BITS, N, fallback_type> rv;
+            lanewise(data, other.data, rv.data, [](auto x, auto y) { return x - y; });
+            return rv;
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto operator * (const fixed_point<NBITS_OTHER, NORMALIZED_BITS, fallback_type_other>& other) const
+        {
+            constexpr uint8_t OUT_NBITS = NBITS + NBITS_OTHER - 1;
+            constexpr uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS + NORMALIZED_BITS - 1;
+            static_assert(OUT_NBITS <= 64);
+
+            fixed_point_vec<OUT_NBITS, OUT_NORMALIZED_BITS, N, fallback_type> rv;
+            multiply(data, other.data, rv.data);
+            return rv;
+        }
+
+        // sum of a[i]*b[i]: products are fixed_point<NBITS + NBITS_OTHER - 1, ...>, summing N of them needs
+        //   bit_width(N - 1) more bits. Sums wider than 64 bits are accumulated exactly in 128 bits and renormalized
+        //   to 64 by rounding off the extra lowest fractional bits (as fixed_point<> operator * does)
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline auto dot(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            constexpr uint8_t PRODUCT_NBITS = NBITS + NBITS_OTHER - 1;
+            constexpr uint8_t OUT_NBITS = PRODUCT_NBITS + std::bit_width(N - 1);
+            constexpr uint8_t OUT_NORMALIZED_BITS = NORMALIZED_BITS + NORMALIZED_BITS - 1;
+            static_assert(PRODUCT_NBITS <= 64);
+
+            using product_underlying_type = out_underlying_type<std::min<uint8_t>(OUT_NBITS, 64)>;
+            product_underlying_type products[N];
+            multiply(data, other.data, products);
+            if constexpr (OUT_NBITS <= 64)
+            {
+                product_underlying_type sum = 0;
+                for (size_t i = 0; i < N; ++i)
+                    sum += products[i];
+                return fixed_point<OUT_NBITS, OUT_NORMALIZED_BITS, fallback_type>(sum);
+            }
+            else
+            {
+                constexpr uint8_t WIDE_SHIFT = OUT_NBITS - 64;
+                static_assert(OUT_NORMALIZED_BITS > WIDE_SHIFT);
+
+                // two's complement 128-bit hi:lo
+                uint64_t lo = 0;
+                uint64_t hi = 0;
+                for (size_t i = 0; i < N; ++i)
+                {
+                    uint64_t p = sixit::lwa::bit_cast<uint64_t>(products[i]);
+                    lo += p;
+                    hi += sixit::lwa::bit_cast<uint64_t>(products[i] >> 63) + (lo < p);
+                }
+                return fixed_point<64, OUT_NORMALIZED_BITS - WIDE_SHIFT, fallback_type>(wide_round_shr(hi, lo, WIDE_SHIFT));
+            }
+        }
+
+        // comparisons: per-lane masks, all-ones (true) or all-zeros (false)
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline simd_mask<N> operator<(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            return lanewise_mask<out_underlying_type<std::max(NBITS, NBITS_OTHER)>>(data, other.data, [](auto x, auto y) { return x < y; });
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline simd_mask<N> operator>(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            return other < *this;
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline simd_mask<N> operator<=(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            return lanewise_mask<out_underlying_type<std::max(NBITS, NBITS_OTHER)>>(data, other.data, [](auto x, auto y) { return x <= y; });
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline simd_mask<N> operator>=(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            return other <= *this;
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline simd_mask<N> operator==(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            return lanewise_mask<out_underlying_type<std::max(NBITS, NBITS_OTHER)>>(data, other.data, [](auto x, auto y) { return x == y; });
+        }
+        template<uint8_t NBITS_OTHER, class fallback_type_other>
+        inline simd_mask<N> operator!=(const fixed_point_vec<NBITS_OTHER, NORMALIZED_BITS, N, fallback_type_other>& other) const
+        {
+            return lanewise_mask<out_underlying_type<std::max(NBITS, NBITS_OTHER)>>(data, other.data, [](auto x, auto y) { return x != y; });
+        }
+
+        // mask[i] ? a[i] : b[i]
+        static inline fixed_point_vec select(const simd_mask<N>& mask, const fixed_point_vec& a, const fixed_point_vec& b)
+        {
+            fixed_point_vec rv;
+            for (size_t i = 0; i < N; ++i)
+                rv.data[i] = mask[i] ? a.data[i] : b.data[i];
+            return rv;
+        }
+    };
+
+    // default type with float fallback
+    template<size_t N>
+    using fx32_float_vec = fixed_point_vec<FX_BASE_NBITS, FX_BASE_NORMALIZED_BITS, N, float>;
+
+}
+
+#endif // SIXIT_FIXED_POINT_VEC_H
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Mykhailo Borovyk
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
@@ -150,6 +150,11 @@ namespace sixit::dmath {
             return sixit::lwa::bit_cast<float>(val);
         }
 
+        static float_with_sixit fma(float_with_sixit a, float_with_sixit b, float_with_sixit c)
+        {
+            return std::fma(a.f, b.f, c.f);
+        }
+
         static auto to_fallback(const float_with_sixit& val) { return val; }
     };
 
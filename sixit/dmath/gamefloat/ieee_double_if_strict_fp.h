@@ -0,0 +1,264 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin, Dmytro Ivanchykhin
+*/
+#ifndef sixit_dmath_gamefloat_ieee_double_if_strict_fp_h_included
+#define sixit_dmath_gamefloat_ieee_double_if_strict_fp_h_included
+#include "sixit/core/lwa.h"
+#include "sixit/dmath/traits.h"
+
+#include <cstdint>
+
+namespace sixit::rw
+{
+// forward declaration to avoid sixit::rw dependency
+template <typename T>
+struct member_type_alias;
+} // namespace sixit::rw
+
+namespace sixit::units
+{
+// forward declatation of helper for sixit::units library
+template <typename Fp>
+struct dimensional_scalar_rw_alias_helper;
+} // namespace sixit::units
+
+namespace sixit::dmath
+{
+
+/**
+ * @brief Whether the strict math is enforced by the compiler settings
+ *
+ * The following define can be manually defined via compiler flag if and only if the strict math is
+ * enforced by the compiler settings.
+ *
+ * For example:
+ *    * `cl.exe /fp:strict /DSIXIT_DMATH_SUPPORT_IEEE_FLOAT_IF_STRICT my_msvc_src.cpp`
+ */
+#ifdef SIXIT_DMATH_SUPPORT_IEEE_FLOAT_IF_STRICT
+
+/**
+ * A header-only class which ensure that each math operation is a separate expression which ends with semicolon;
+ * Will provide deterministic result only in case of compiler does not reorder ariphmetic across semicolon and
+ * strict math options are enabled: --fno-fast-math, -fno-associative-math, and -ffp-contract=off
+ */
+class ieee_double_if_strict_fp
+{
+  public:
+    double to_double() const
+    {
+        return data;
+    }
+
+    constexpr ieee_double_if_strict_fp() noexcept = default;
+    ieee_double_if_strict_fp(const ieee_double_if_strict_fp& other) noexcept = default;
+    ieee_double_if_strict_fp(ieee_double_if_strict_fp&& other) noexcept = default;
+    constexpr ieee_double_if_strict_fp(const double& other) : data(other){};
+
+    ieee_double_if_strict_fp operator+(ieee_double_if_strict_fp other) const
+    {
+        return data + other.data;
+    }
+
+    ieee_double_if_strict_fp operator-(ieee_double_if_strict_fp other) const
+    {
+        return data - other.data;
+    }
+
+    ieee_double_if_strict_fp operator*(ieee_double_if_strict_fp other) const
+    {
+        return data * other.data;
+    }
+
+    ieee_double_if_strict_fp operator/(ieee_double_if_strict_fp other) const
+    {
+        return data / other.data;
+    }
+
+    ieee_double_if_strict_fp& operator=(const ieee_double_if_strict_fp& other) noexcept = default;
+    ieee_double_if_strict_fp& operator=(ieee_double_if_strict_fp&& other) noexcept = default;
+
+    bool operator<(const ieee_double_if_strict_fp& other) const
+    {
+        return data < other.data;
+    }
+
+    bool operator>(const ieee_double_if_strict_fp& other) const
+    {
+        return data > other.data;
+    }
+
+    bool operator<=(const ieee_double_if_strict_fp& other) const
+    {
+        return data <= other.data;
+    }
+
+    bool operator>=(const ieee_double_if_strict_fp& other) const
+    {
+        return data >= other.data;
+    }
+
+    bool operator==(const ieee_double_if_strict_fp& other) const = default;
+
+    ieee_double_if_strict_fp operator-() const
+    {
+        return ieee_double_if_strict_fp(-data);
+    }
+
+  private:
+    double data = {};
+
+    struct rw_alias
+    {
+        using value_type = ieee_double_if_strict_fp;
+        using alias_type = double;
+        using type = double; // todo: ask DI for rw refactoring to use alias_type instead?
+
+        static alias_type value2alias(const value_type& value)
+        {
+            return value.to_double();
+        }
+
+        static value_type alias2value(alias_type value)
+        {
+            return {value};
+        }
+    };
+
+    friend struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_if_strict_fp>;
+    friend struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_if_strict_fp>;
+
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+};
+
+template <>
+struct fp_traits<ieee_double_if_strict_fp>
+{
+    static constexpr bool is_valid_fp = true;
+    static constexpr bool is_deterministic = true;
+    static constexpr bool is_fixed_point = false;
+    static constexpr bool is_supported = true;
+
+    static constexpr auto display_name = sixit::lwa::string_literal_helper("ieee_double_if_strict_fp");
+
+    using intermediate_type = double;
+    using fixed_point_type = void*;
+
+    static bool isnan(ieee_double_if_strict_fp val)
+    {
+        return fp_traits<double>::isnan(val.data);
+    }
+    static bool isinf(ieee_double_if_strict_fp val)
+    {
+        return fp_traits<double>::isinf(val.data);
+    }
+    static bool isfinite(ieee_double_if_strict_fp val)
+    {
+        return fp_traits<double>::isfinite(val.data);
+    }
+    static int32_t get_exp(ieee_double_if_strict_fp val)
+    {
+        return fp_traits<double>::get_exp(val.data);
+    }
+    static int64_t get_mantissa(ieee_double_if_strict_fp val)
+    {
+        return fp_traits<double>::get_mantissa(val.data);
+    }
+    static bool set_exp(ieee_double_if_strict_fp& val, int exp)
+    {
+        return fp_traits<double>::set_exp(val.data, exp);
+    }
+    static int64_t fp2int64(ieee_double_if_strict_fp val)
+    {
+        return fp_traits<double>::fp2int64(val.data);
+    }
+    static uint64_t bit_cast_to_ieee_uint64(const ieee_double_if_strict_fp& val)
+    {
+        return fp_traits<double>::bit_cast_to_ieee_uint64(val.data);
+    }
+    static bool get_sign(const ieee_double_if_strict_fp& val)
+    {
+        return fp_traits<double>::get_sign(val.data);
+    }
+    static bool equal_to_zero(const ieee_double_if_strict_fp& val)
+    {
+        return fp_traits<double>::equal_to_zero(val.data);
+    }
+    static ieee_double_if_strict_fp bit_cast_from_ieee_uint64(uint64_t val)
+    {
+        return fp_traits<double>::bit_cast_from_ieee_uint64(val);
+    }
+
+    static auto to_fallback(ieee_double_if_strict_fp val) { return val; }
+};
+
+#else
+
+// a stub as the ieee_double_if_strict_fp is not supported on this platform
+class ieee_double_if_strict_fp
+{
+  public:
+    struct rw_alias
+    {
+    };
+};
+
+template <>
+struct fp_traits<ieee_double_if_strict_fp>
+{
+    // not implemented for this platform
+    static constexpr bool is_supported = false;
+};
+
+#endif
+
+} // namespace sixit::dmath
+
+template <>
+struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_if_strict_fp>
+    : sixit::dmath::ieee_double_if_strict_fp::rw_alias
+{
+};
+
+template <>
+struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_if_strict_fp>
+    : sixit::dmath::ieee_double_if_strict_fp::rw_alias
+{
+};
+
+#endif // sixit_dmath_gamefloat_ieee_double_if_strict_fp_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin, Dmytro Ivanchykhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,374 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+
+#ifndef sixit_dmath_gamefloat_ieee_double_inline_asm_h_included
+#define sixit_dmath_gamefloat_ieee_double_inline_asm_h_included
+
+#include "sixit/core/core.h"
+#include "sixit/core/guidelines.h"
+#include "sixit/core/lwa.h"
+#include "sixit/dmath/traits.h"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace sixit::rw
+{
+// forward declaration to avoid sixit::rw dependency
+template <typename T>
+struct member_type_alias;
+} // namespace sixit::rw
+
+namespace sixit::units
+{
+// forward declatation of helper for sixit::units library
+template <typename Fp>
+struct dimensional_scalar_rw_alias_helper;
+} // namespace sixit::units
+
+namespace sixit::dmath
+{
+
+// several architectures support ieee_double_inline_asm; x86 needs SSE2 to avoid x87 extended precision
+#if defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG) &&                                                                     \
+    (defined(SIXIT_CPU_X64) || (defined(SIXIT_CPU_X86) && defined(__SSE2__)) || defined(SIXIT_CPU_ARM64) ||        \
+     (defined(SIXIT_CPU_RISCV64) && defined(__riscv_d)))
+
+/**
+ * @brief SIMD-based deterministic double implementation
+ *
+ * 64-bit counterpart of `ieee_float_inline_asm`. `sixit::cpual` provides asm helpers for floats only,
+ * so the scalar double instructions (`addsd`/`fadd`/`fadd.d` and so on) are emitted here directly.
+ * Each operation is a separate asm statement, so the compiler can neither reorder nor contract them.
+ */
+class ieee_double_inline_asm
+{
+    static int32_t f64bits_to_exponent(uint64_t bits)
+    {
+        return ((bits >> 52) & 0x7FF) - 1023;
+    }
+
+    static int64_t f64bits_to_mantissa(uint64_t bits)
+    {
+        int64_t rv = bits & UINT64_C(0xf'ffff'ffff'ffff);
+        uint64_t implicit_bit = static_cast<uint64_t>(f64bits_to_exponent(bits) > -1023) << 52;
+
+        rv |= implicit_bit;
+        bool is_negative = bits & UINT64_C(0x8000'0000'0000'0000);
+        return is_negative ? -rv : rv;
+    }
+
+    static uint64_t f64bits_set_exponent(uint64_t bits, int32_t new_exp)
+    {
+        auto biased_exp = new_exp + 1023;
+        SIXIT_ASSUMERT(biased_exp >= 0 && biased_exp < 0x800);
+
+        bits &= UINT64_C(0x800f'ffff'ffff'ffff);
+        bits |= uint64_t(biased_exp) << 52;
+        return bits;
+    }
+
+#if defined(SIXIT_CPU_X64) || defined(SIXIT_CPU_X86)
+#define SIXIT_DMATH_IEEE_DOUBLE_ASM_OP(insn_x86, insn_other)                                                        \
+    asm(insn_x86 " %1, %0" : "+x"(lhs) : "x"(rhs));                                                                 \
+    return lhs
+#elif defined(SIXIT_CPU_ARM64)
+#define SIXIT_DMATH_IEEE_DOUBLE_ASM_OP(insn_x86, insn_other)                                                        \
+    double rv;                                                                                                      \
+    asm(insn_other " %d0, %d1, %d2" : "=w"(rv) : "w"(lhs), "w"(rhs));                                               \
+    return rv
+#else // SIXIT_CPU_RISCV64
+#define SIXIT_DMATH_IEEE_DOUBLE_ASM_OP(insn_x86, insn_other)                                                        \
+    double rv;                                                                                                      \
+    asm(insn_other ".d %0, %1, %2" : "=f"(rv) : "f"(lhs), "f"(rhs));                                                \
+    return rv
+#endif
+
+    static double asm_add(double lhs, double rhs)
+    {
+        SIXIT_DMATH_IEEE_DOUBLE_ASM_OP("addsd", "fadd");
+    }
+
+    static double asm_subtract(double lhs, double rhs)
+    {
+        SIXIT_DMATH_IEEE_DOUBLE_ASM_OP("subsd", "fsub");
+    }
+
+    static double asm_multiply(double lhs, double rhs)
+    {
+        SIXIT_DMATH_IEEE_DOUBLE_ASM_OP("mulsd", "fmul");
+    }
+
+    static double asm_divide(double lhs, double rhs)
+    {
+        SIXIT_DMATH_IEEE_DOUBLE_ASM_OP("divsd", "fdiv");
+    }
+
+#undef SIXIT_DMATH_IEEE_DOUBLE_ASM_OP
+
+  public:
+    double to_double() const
+    {
+        return data;
+    }
+
+    constexpr ieee_double_inline_asm() noexcept = default;
+    ieee_double_inline_asm(const ieee_double_inline_asm& other) noexcept = default;
+    ieee_double_inline_asm(ieee_double_inline_asm&& other) noexcept = default;
+    ieee_double_inline_asm& operator=(const ieee_double_inline_asm& other) noexcept = default;
+
+    constexpr ieee_double_inline_asm(double d) : data(d){};
+
+    ieee_double_inline_asm operator+(ieee_double_inline_asm other) const
+    {
+        return asm_add(data, other.data);
+    }
+
+    ieee_double_inline_asm operator-(ieee_double_inline_asm other) const
+    {
+        return asm_subtract(data, other.data);
+    }
+
+    ieee_double_inline_asm operator*(ieee_double_inline_asm other) const
+    {
+        return asm_multiply(data, other.data);
+    }
+
+    ieee_double_inline_asm operator/(ieee_double_inline_asm other) const
+    {
+        return asm_divide(data, other.data);
+    }
+
+    // comparisons are exact, so there is nothing for the compiler to round differently
+    bool operator<(ieee_double_inline_asm other) const
+    {
+        return data < other.data;
+    }
+
+    bool operator<=(ieee_double_inline_asm other) const
+    {
+        return data <= other.data;
+    }
+
+    bool operator==(ieee_double_inline_asm other) const
+    {
+        return data == other.data;
+    }
+
+    bool operator>(ieee_double_inline_asm other) const
+    {
+        return other < *this;
+    }
+
+    bool operator>=(ieee_double_inline_asm other) const
+    {
+        return other <= *this;
+    }
+
+    bool operator!=(ieee_double_inline_asm other) const
+    {
+        return !(*this == other);
+    }
+
+    ieee_double_inline_asm operator-() const
+    {
+        constexpr uint64_t sign_bit = UINT64_C(0x8000'0000'0000'0000);
+        return sixit::lwa::bit_cast<double>(sixit::lwa::bit_cast<uint64_t>(data) ^ sign_bit);
+    }
+
+  private:
+    double data = {};
+
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+
+    struct rw_alias
+    {
+        using value_type = ieee_double_inline_asm;
+        using alias_type = double;
+        using type = double; // todo: ask DI for rw refactoring to use alias_type instead?
+
+        static alias_type value2alias(const value_type& value)
+        {
+            return value.to_double();
+        }
+
+        static value_type alias2value(alias_type value)
+        {
+            return {value};
+        }
+    };
+
+    friend struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_inline_asm>;
+    friend struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_inline_asm>;
+};
+
+template <>
+struct fp_traits<ieee_double_inline_asm>
+{
+    static constexpr bool is_valid_fp = true;
+    static constexpr bool is_deterministic = true;
+    static constexpr bool is_fixed_point = false;
+    static constexpr bool is_supported = true;
+
+    static constexpr auto display_name = sixit::lwa::string_literal_helper("ieee_double_inline_asm");
+
+    using intermediate_type = double;
+    using fixed_point_type = void*;
+
+    static bool isnan(ieee_double_inline_asm val)
+    {
+        static constexpr uint64_t all_but_sign = UINT64_C(0x7fff'ffff'ffff'ffff);
+        static constexpr uint64_t exponent_mask = UINT64_C(0x7ff0'0000'0000'0000);
+
+        // `exp == all_ones && mantissa > 0`
+        return (bit_cast_to_ieee_uint64(val) & all_but_sign) > exponent_mask;
+    }
+
+    static bool isinf(ieee_double_inline_asm val)
+    {
+        static constexpr uint64_t all_but_sign = UINT64_C(0x7fff'ffff'ffff'ffff);
+        static constexpr uint64_t exponent_mask = UINT64_C(0x7ff0'0000'0000'0000);
+
+        // `exp == all_ones && mantissa == 0`
+        return (bit_cast_to_ieee_uint64(val) & all_but_sign) == exponent_mask;
+    }
+
+    static bool isfinite(ieee_double_inline_asm val)
+    {
+        static constexpr uint64_t all_but_sign = UINT64_C(0x7fff'ffff'ffff'ffff);
+        static constexpr uint64_t exponent_mask = UINT64_C(0x7ff0'0000'0000'0000);
+
+        // `exp < all_ones`
+        return (bit_cast_to_ieee_uint64(val) & all_but_sign) < exponent_mask;
+    }
+
+    static int32_t get_exp(ieee_double_inline_asm val)
+    {
+        auto bits = bit_cast_to_ieee_uint64(val);
+        return ieee_double_inline_asm::f64bits_to_exponent(bits);
+    }
+
+    static int64_t get_mantissa(ieee_double_inline_asm val)
+    {
+        auto bits = bit_cast_to_ieee_uint64(val);
+        return ieee_double_inline_asm::f64bits_to_mantissa(bits);
+    }
+
+    static bool set_exp(ieee_double_inline_asm& val, int exp)
+    {
+        SIXIT_ASSUMERT(exp >= -1023 && exp <= 1023);
+        if (exp < -1023 || exp > 1023)
+            return false;
+
+        auto bits = bit_cast_to_ieee_uint64(val);
+        bits = ieee_double_inline_asm::f64bits_set_exponent(bits, exp);
+        val = bit_cast_from_ieee_uint64(bits);
+        return true;
+    }
+
+    static int64_t fp2int64(ieee_double_inline_asm val)
+    {
+        return static_cast<int64_t>(val.to_double());
+    }
+
+    static uint64_t bit_cast_to_ieee_uint64(ieee_double_inline_asm val)
+    {
+        return sixit::lwa::bit_cast<uint64_t>(val.to_double());
+    }
+
+    static bool get_sign(ieee_double_inline_asm val)
+    {
+        static constexpr uint64_t sign_bit = UINT64_C(0x8000'0000'0000'0000);
+        return (bit_cast_to_ieee_uint64(val) & sign_bit) != 0;
+    }
+
+    static bool equal_to_zero(ieee_double_inline_asm val)
+    {
+        static constexpr uint64_t sign_bit = UINT64_C(0x8000'0000'0000'0000);
+        return (bit_cast_to_ieee_uint64(val) & ~sign_bit) == 0;
+    }
+
+    static ieee_double_inline_asm bit_cast_from_ieee_uint64(uint64_t val)
+    {
+        return sixit::lwa::bit_cast<double>(val);
+    }
+
+    static auto to_fallback(ieee_double_inline_asm val)
+    {
+        return val;
+    }
+};
+
+#else // unsupported platform
+
+// a stub as the ieee_double_inline_asm is not supported on this platform
+class ieee_double_inline_asm
+{
+  public:
+    struct rw_alias
+    {
+    };
+};
+
+template <>
+struct fp_traits<ieee_double_inline_asm>
+{
+    // not implemented for this platform
+    static constexpr bool is_supported = false;
+};
+
+#endif
+
+} // namespace sixit::dmath
+
+template <>
+struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_inline_asm>
+    : sixit::dmath::ieee_double_inline_asm::rw_alias
+{
+};
+
+template <>
+struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_inline_asm>
+    : sixit::dmath::ieee_double_inline_asm::rw_alias
+{
+};
+
+#endif // sixit_dmath_gamefloat_ieee_double_inline_asm_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,317 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+
+#ifndef sixit_dmath_gamefloat_ieee_double_soft_h_included
+#define sixit_dmath_gamefloat_ieee_double_soft_h_included
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "sixit/core/guidelines.h"
+#include "sixit/core/lwa.h"
+#include "sixit/dmath/traits.h"
+
+#include "sixit/dmath/softfloat/softfloat_inline.h"
+
+namespace sixit::rw
+{
+// forward declaration to avoid sixit::rw dependency
+template <typename T>
+struct member_type_alias;
+} // namespace sixit::rw
+
+namespace sixit::units
+{
+// forward declatation of helper for sixit::units library
+template <typename Fp>
+struct dimensional_scalar_rw_alias_helper;
+} // namespace sixit::units
+
+namespace sixit::dmath
+{
+
+/**
+ * @brief IEEE-compatible deterministic double class based on adaptation of Berkeley's SoftFloat
+ *
+ * 64-bit counterpart of `ieee_float_soft`. See `sixit/dmath/softfloat/README.md` for details on adaptation.
+ */
+class ieee_double_soft
+{
+    static constexpr int32_t f64bits_to_exponent(uint64_t bits)
+    {
+        return ((bits >> 52) & 0x7FF) - 1023;
+    }
+
+    static constexpr int64_t f64bits_to_mantissa(uint64_t bits)
+    {
+        int64_t rv = bits & UINT64_C(0xf'ffff'ffff'ffff);
+        uint64_t implicit_bit = static_cast<uint64_t>(f64bits_to_exponent(bits) > -1023) << 52;
+
+        rv |= implicit_bit;
+        bool is_negative = bits & UINT64_C(0x8000'0000'0000'0000);
+        return is_negative ? -rv : rv;
+    }
+
+    static constexpr uint64_t f64bits_set_exponent(uint64_t bits, int32_t new_exp)
+    {
+        auto biased_exp = new_exp + 1023;
+        if (!std::is_constant_evaluated())
+            SIXIT_ASSUMERT(biased_exp >= 0 && biased_exp < 0x800);
+
+        bits &= UINT64_C(0x800f'ffff'ffff'ffff);
+        bits |= uint64_t(biased_exp) << 52;
+        return bits;
+    }
+
+    using soft_double_t = sixit::dmath::softfloat::float64_t;
+
+    // rounding to nearest/even, exception flags are discarded: no thread-local state is involved
+    using softfloat_context = sixit::dmath::softfloat::static_context<>;
+
+    constexpr ieee_double_soft(soft_double_t f64) : data(f64)
+    {
+    }
+
+  public:
+    constexpr double to_double() const
+    {
+        return sixit::lwa::bit_cast<double>(data);
+    }
+
+    constexpr ieee_double_soft() noexcept = default;
+    constexpr ieee_double_soft(const ieee_double_soft& other) noexcept = default;
+    constexpr ieee_double_soft(ieee_double_soft&& other) noexcept = default;
+    constexpr ieee_double_soft& operator=(const ieee_double_soft& other) noexcept = default;
+
+    constexpr ieee_double_soft(double d) : data(sixit::lwa::bit_cast<soft_double_t>(d)) {};
+
+    constexpr ieee_double_soft operator+(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_add(data, other.data, ctx);
+    }
+
+    constexpr ieee_double_soft operator-(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_sub(data, other.data, ctx);
+    }
+
+    constexpr ieee_double_soft operator*(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_mul(data, other.data, ctx);
+    }
+
+    constexpr ieee_double_soft operator/(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_div(data, other.data, ctx);
+    }
+
+    constexpr bool operator<(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_lt(data, other.data, ctx);
+    }
+
+    constexpr bool operator<=(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_le(data, other.data, ctx);
+    }
+
+    constexpr bool operator==(ieee_double_soft other) const
+    {
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_eq(data, other.data, ctx);
+    }
+
+    constexpr bool operator>(ieee_double_soft other) const
+    {
+        return other < *this;
+    }
+
+    constexpr bool operator>=(ieee_double_soft other) const
+    {
+        return other <= *this;
+    }
+
+    constexpr bool operator!=(ieee_double_soft other) const
+    {
+        return !(*this == other);
+    }
+
+    constexpr ieee_double_soft operator-() const
+    {
+        constexpr uint64_t sign_bit = UINT64_C(0x8000'0000'0000'0000);
+        uint64_t bits = sixit::lwa::bit_cast<uint64_t>(to_double());
+        return sixit::lwa::bit_cast<double>(bits ^ sign_bit);
+    }
+
+  private:
+    soft_double_t data = {};
+
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+
+    struct rw_alias
+    {
+        using value_type = ieee_double_soft;
+        using alias_type = double;
+        using type = double; // todo: ask DI for rw refactoring to use alias_type instead?
+
+        static alias_type value2alias(const value_type& value)
+        {
+            return value.to_double();
+        }
+
+        static value_type alias2value(alias_type value)
+        {
+            return {value};
+        }
+    };
+
+    friend struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_soft>;
+    friend struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_soft>;
+};
+
+template <>
+struct fp_traits<ieee_double_soft>
+{
+    static constexpr bool is_valid_fp = true;
+    static constexpr bool is_deterministic = true;
+    static constexpr bool is_fixed_point = false;
+    static constexpr bool is_supported = true;
+
+    static constexpr auto display_name = sixit::lwa::string_literal_helper("ieee_double_soft");
+
+    using intermediate_type = double;
+    using fixed_point_type = void*;
+
+    static constexpr bool isnan(ieee_double_soft val)
+    {
+        return sixit::dmath::softfloat::f64_isSignalingNaN(val.data) || (val != val);
+    }
+
+    static constexpr bool isinf(ieee_double_soft val)
+    {
+        constexpr auto pos_inf = ieee_double_soft(std::numeric_limits<double>::infinity());
+        constexpr auto neg_inf = ieee_double_soft(-std::numeric_limits<double>::infinity());
+        return val == pos_inf || val == neg_inf;
+    }
+
+    static constexpr bool isfinite(ieee_double_soft val)
+    {
+        constexpr int special_exp = 1024;    // exponent of infinite and NaN
+        return get_exp(val) != special_exp;
+    }
+
+    static constexpr int32_t get_exp(ieee_double_soft val)
+    {
+        uint64_t bits = fp_traits<ieee_double_soft>::bit_cast_to_ieee_uint64(val);
+        return ieee_double_soft::f64bits_to_exponent(bits);
+    }
+
+    static constexpr int64_t get_mantissa(ieee_double_soft val)
+    {
+        uint64_t bits = fp_traits<ieee_double_soft>::bit_cast_to_ieee_uint64(val);
+        return ieee_double_soft::f64bits_to_mantissa(bits);
+    }
+
+    static constexpr bool set_exp(ieee_double_soft& val, int exp)
+    {
+        if (!std::is_constant_evaluated())
+            SIXIT_ASSUMERT(exp >= -1023 && exp <= 1023);
+        if (exp < -1023 || exp > 1023)
+            return false;
+
+        uint64_t bits = fp_traits<ieee_double_soft>::bit_cast_to_ieee_uint64(val);
+        bits = ieee_double_soft::f64bits_set_exponent(bits, exp);
+        val = fp_traits<ieee_double_soft>::bit_cast_from_ieee_uint64(bits);
+        return true;
+    }
+
+    static constexpr int64_t fp2int64(ieee_double_soft val)
+    {
+        ieee_double_soft::softfloat_context ctx;
+        return sixit::dmath::softfloat::f64_to_i64(val.data, sixit::dmath::softfloat::softfloat_round_minMag, false,
+                                                   ctx);
+    }
+
+    static constexpr uint64_t bit_cast_to_ieee_uint64(ieee_double_soft val)
+    {
+        return val.data.v;
+    }
+
+    static constexpr ieee_double_soft bit_cast_from_ieee_uint64(uint64_t bits)
+    {
+        return ieee_double_soft(ieee_double_soft::soft_double_t{bits});
+    }
+
+    static constexpr bool get_sign(ieee_double_soft val)
+    {
+        constexpr uint64_t sign_bit = UINT64_C(0x8000'0000'0000'0000);
+        return (bit_cast_to_ieee_uint64(val) & sign_bit) != 0;
+    }
+
+    static constexpr bool equal_to_zero(ieee_double_soft val)
+    {
+        constexpr uint64_t sign_bit = UINT64_C(0x8000'0000'0000'0000);
+        return (bit_cast_to_ieee_uint64(val) & ~sign_bit) == 0;
+    }
+
+    static constexpr auto to_fallback(ieee_double_soft val) { return val; }
+};
+
+} // namespace sixit::dmath
+
+template <>
+struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_soft>
+    : sixit::dmath::ieee_double_soft::rw_alias
+{
+};
+
+template <>
+struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_soft> : sixit::dmath::ieee_double_soft::rw_alias
+{
+};
+
+#endif // sixit_dmath_gamefloat_ieee_double_soft_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
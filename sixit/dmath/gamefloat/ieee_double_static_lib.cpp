@@ -0,0 +1,177 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+
+#include "sixit/core/lwa.h"
+#include "sixit/dmath/gamefloat/ieee_double_static_lib.h"
+
+#include <cmath>
+
+using sixit::dmath::ieee_double_static_lib_detail;
+
+double ieee_double_static_lib_detail::add(double lhs, double rhs)
+{
+    return lhs + rhs;
+}
+
+double ieee_double_static_lib_detail::subtract(double lhs, double rhs)
+{
+    return lhs - rhs;
+}
+
+double ieee_double_static_lib_detail::multiply(double lhs, double rhs)
+{
+    return lhs * rhs;
+}
+
+double ieee_double_static_lib_detail::divide(double lhs, double rhs)
+{
+    return lhs / rhs;
+}
+
+bool ieee_double_static_lib_detail::compare_lt(double lhs, double rhs)
+{
+    return lhs < rhs;
+}
+
+bool ieee_double_static_lib_detail::compare_gt(double lhs, double rhs)
+{
+    return lhs > rhs;
+}
+
+bool ieee_double_static_lib_detail::compare_le(double lhs, double rhs)
+{
+    return lhs <= rhs;
+}
+
+bool ieee_double_static_lib_detail::compare_ge(double lhs, double rhs)
+{
+    return lhs >= rhs;
+}
+
+bool ieee_double_static_lib_detail::compare_eq(double lhs, double rhs)
+{
+    return lhs == rhs;
+}
+
+double ieee_double_static_lib_detail::negate(double value)
+{
+    return -value;
+}
+
+int64_t ieee_double_static_lib_detail::fp2int64(double val)
+{
+    return static_cast<int64_t>(val);
+}
+
+bool ieee_double_static_lib_detail::set_exp(double& val, int exp)
+{
+    exp += 1023;
+    if (exp < 0 || exp >= 2048)
+        return false;
+    uint64_t rv = sixit::lwa::bit_cast<uint64_t>(val);
+    rv &= UINT64_C(0x800f'ffff'ffff'ffff);
+    rv |= uint64_t(exp) << 52;
+    val = sixit::lwa::bit_cast<double>(rv);
+    return true;
+}
+
+int64_t ieee_double_static_lib_detail::get_mantissa(double val)
+{
+    int64_t bits = sixit::lwa::bit_cast<int64_t>(val);
+    int64_t rv = bits & INT64_C(0xf'ffff'ffff'ffff);
+    bool has_implicit_bit = get_exp(val) > -1023;
+    rv |= uint64_t(has_implicit_bit) << 52;
+
+    bool is_negative = bits < 0;
+    return is_negative ? -rv : rv;
+}
+
+int32_t ieee_double_static_lib_detail::get_exp(double val)
+{
+    int32_t rv = (sixit::lwa::bit_cast<uint64_t>(val) >> 52) & 0x7ff;
+    rv -= 1023;
+    return rv;
+}
+
+bool ieee_double_static_lib_detail::isfinite(double val)
+{
+    static constexpr uint64_t all_but_sign = UINT64_C(0x7fff'ffff'ffff'ffff);
+    static constexpr uint64_t exponent_mask = UINT64_C(0x7ff0'0000'0000'0000);
+
+    // `exp < all_ones`
+    return (bit_cast_to_ieee_uint64(val) & all_but_sign) < exponent_mask;
+}
+
+bool ieee_double_static_lib_detail::isinf(double val)
+{
+    static constexpr uint64_t all_but_sign = UINT64_C(0x7fff'ffff'ffff'ffff);
+    static constexpr uint64_t exponent_mask = UINT64_C(0x7ff0'0000'0000'0000);
+
+    // `exp == all_ones && mantissa == 0`
+    return (bit_cast_to_ieee_uint64(val) & all_but_sign) == exponent_mask;
+}
+
+bool ieee_double_static_lib_detail::isnan(double val)
+{
+    static constexpr uint64_t all_but_sign = UINT64_C(0x7fff'ffff'ffff'ffff);
+    static constexpr uint64_t exponent_mask = UINT64_C(0x7ff0'0000'0000'0000);
+
+    // `exp == all_ones && mantissa > 0`
+    return (bit_cast_to_ieee_uint64(val) & all_but_sign) > exponent_mask;
+}
+
+uint64_t ieee_double_static_lib_detail::bit_cast_to_ieee_uint64(double val)
+{
+    return sixit::lwa::bit_cast<uint64_t>(val);
+}
+
+bool ieee_double_static_lib_detail::get_sign(double val)
+{
+    return sixit::lwa::bit_cast<uint64_t>(val) >> 63;
+}
+
+bool ieee_double_static_lib_detail::equal_to_zero(double val)
+{
+    return !(sixit::lwa::bit_cast<uint64_t>(val) << 1);
+}
+
+double ieee_double_static_lib_detail::bit_cast_from_ieee_uint64(uint64_t val)
+{
+    return sixit::lwa::bit_cast<double>(val);
+}
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
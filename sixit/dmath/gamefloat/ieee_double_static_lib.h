@@ -0,0 +1,322 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+#ifndef sixit_dmath_gamefloat_ieee_double_static_lib_h_included
+#define sixit_dmath_gamefloat_ieee_double_static_lib_h_included
+
+#include <cstdint>
+
+#include "sixit/core/core.h"
+#include "sixit/dmath/traits.h"
+
+namespace sixit::rw
+{
+// forward declaration to avoid sixit::rw dependency
+template <typename T>
+struct member_type_alias;
+} // namespace sixit::rw
+
+namespace sixit::units
+{
+// forward declatation of helper for sixit::units library
+template <typename Fp>
+struct dimensional_scalar_rw_alias_helper;
+} // namespace sixit::units
+
+namespace sixit::dmath
+{
+
+class ieee_double_static_lib;
+
+/**
+ * All-private internal implementations that should never be called directly.
+ * Please use `ieee_double_static_lib` instead
+ *
+ * @see ieee_double_static_lib
+ */
+class ieee_double_static_lib_detail
+{
+    // all-private
+    static double add(double lhs, double rhs);
+    static double subtract(double lhs, double rhs);
+    static double multiply(double lhs, double rhs);
+    static double divide(double lhs, double rhs);
+    static bool compare_lt(double lhs, double rhs);
+    static bool compare_gt(double lhs, double rhs);
+    static bool compare_le(double lhs, double rhs);
+    static bool compare_ge(double lhs, double rhs);
+    static bool compare_eq(double lhs, double rhs);
+    static double negate(double value);
+
+    static int64_t fp2int64(double val);
+    static bool set_exp(double& val, int exp);
+    static int64_t get_mantissa(double val);
+    static int32_t get_exp(double val);
+    static bool isfinite(double val);
+    static bool isinf(double val);
+    static bool isnan(double val);
+    static uint64_t bit_cast_to_ieee_uint64(double val);
+    static bool get_sign(double val);
+    static bool equal_to_zero(double val);
+    static double bit_cast_from_ieee_uint64(uint64_t val);
+
+    friend sixit::dmath::ieee_double_static_lib;
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+};
+
+/**
+ * @brief User's confirmation about LTO/LTCG absense is needed to use `ieee_double_static_lib`
+ *
+ * Once LTO flags aren't enabled in the compiler options, user may confirm this by defining
+ * SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB in the compiler options.
+ *
+ * For example:
+ *    `cl ... -DSIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB my_src.cpp`
+ */
+#ifdef SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB
+
+// todo: Detect LTO/LTCG!
+
+/**
+ * Static library based deterministic double.
+ *
+ * The point of having operations hidden inside a different translation unit is to
+ * prevent compiler from inlining and optimizing its methods.
+ *
+ * @warning non-deterministic with LTO/LTCG (gcc `-flto` or msvc `/GL /LTCG`) or unity builds.
+ */
+class ieee_double_static_lib
+{
+  public:
+    double to_double() const
+    {
+        return static_cast<double>(*this);
+    }
+
+    constexpr ieee_double_static_lib() noexcept = default;
+    ieee_double_static_lib(const ieee_double_static_lib& other) noexcept = default;
+    ieee_double_static_lib(ieee_double_static_lib&& other) noexcept = default;
+    constexpr ieee_double_static_lib(const double& other) : data(other){};
+
+    ieee_double_static_lib& operator=(const ieee_double_static_lib& other) = default;
+
+    ieee_double_static_lib operator+(ieee_double_static_lib other) const
+    {
+        return ieee_double_static_lib_detail::add(data, other.data);
+    }
+
+    ieee_double_static_lib operator-(ieee_double_static_lib other) const
+    {
+        return ieee_double_static_lib_detail::subtract(data, other.data);
+    }
+
+    ieee_double_static_lib operator*(ieee_double_static_lib other) const
+    {
+        return ieee_double_static_lib_detail::multiply(data, other.data);
+    }
+
+    ieee_double_static_lib operator/(ieee_double_static_lib other) const
+    {
+        return ieee_double_static_lib_detail::divide(data, other.data);
+    }
+
+    bool operator<(const ieee_double_static_lib& other) const
+    {
+        return ieee_double_static_lib_detail::compare_lt(data, other.data);
+    }
+
+    bool operator>(const ieee_double_static_lib& other) const
+    {
+        return ieee_double_static_lib_detail::compare_gt(data, other.data);
+    }
+
+    bool operator<=(const ieee_double_static_lib& other) const
+    {
+        return ieee_double_static_lib_detail::compare_le(data, other.data);
+    }
+
+    bool operator>=(const ieee_double_static_lib& other) const
+    {
+        return ieee_double_static_lib_detail::compare_ge(data, other.data);
+    }
+
+    bool operator==(const ieee_double_static_lib& other) const
+    {
+        return ieee_double_static_lib_detail::compare_eq(data, other.data);
+    }
+
+    ieee_double_static_lib operator-() const
+    {
+        return ieee_double_static_lib_detail::negate(data);
+    }
+
+  private:
+    double data = {};
+
+    operator double() const
+    {
+        return data;
+    }
+
+    struct rw_alias
+    {
+        using value_type = ieee_double_static_lib;
+        using alias_type = double;
+        using type = double; // todo: ask DI for rw refactoring to use alias_type instead?
+
+        static alias_type value2alias(const value_type& value)
+        {
+            return value.to_double();
+        }
+
+        static value_type alias2value(alias_type value)
+        {
+            return {value};
+        }
+    };
+
+    friend struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_static_lib>;
+    friend struct sixit::rw::member_type_alias<ieee_double_static_lib>;
+
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+};
+
+template <>
+struct fp_traits<ieee_double_static_lib>
+{
+    static constexpr bool is_valid_fp = true;
+    static constexpr bool is_deterministic = true;
+    static constexpr bool is_fixed_point = false;
+    static constexpr bool is_supported = true;
+
+    static constexpr auto display_name = sixit::lwa::string_literal_helper("ieee_double_static_lib");
+
+    using intermediate_type = double;
+    using fixed_point_type = void*;
+
+    static int64_t fp2int64(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::fp2int64(val.data);
+    }
+
+    static bool set_exp(ieee_double_static_lib& val, int exp)
+    {
+        return ieee_double_static_lib_detail::set_exp(val.data, exp);
+    }
+
+    static int64_t get_mantissa(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::get_mantissa(val.data);
+    }
+
+    static int32_t get_exp(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::get_exp(val.data);
+    }
+
+    static bool isfinite(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::isfinite(val.data);
+    }
+
+    static bool isinf(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::isinf(val.data);
+    }
+
+    static bool isnan(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::isnan(val.data);
+    }
+
+    static uint64_t bit_cast_to_ieee_uint64(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::bit_cast_to_ieee_uint64(val.data);
+    }
+
+    static bool get_sign(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::get_sign(val.data);
+    }
+
+    static bool equal_to_zero(ieee_double_static_lib val)
+    {
+        return ieee_double_static_lib_detail::equal_to_zero(val.data);
+    }
+
+    static ieee_double_static_lib bit_cast_from_ieee_uint64(uint64_t val)
+    {
+        return ieee_double_static_lib(ieee_double_static_lib_detail::bit_cast_from_ieee_uint64(val));
+    }
+    static auto to_fallback(ieee_double_static_lib val) { return val; }
+};
+
+#else  // LTO/LTCG absence is not confirmed, ieee_double_static_lib disabled
+// a stub as the ieee_double_static_lib is not supported without the confirmation above
+class ieee_double_static_lib
+{
+  public:
+    struct rw_alias
+    {
+    };
+};
+
+template <>
+struct fp_traits<ieee_double_static_lib>
+{
+    // not implemented for this platform
+    static constexpr bool is_supported = false;
+};
+#endif // SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB
+
+} // namespace sixit::dmath
+
+template <>
+struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_double_static_lib>
+    : sixit::dmath::ieee_double_static_lib::rw_alias
+{
+};
+
+template <>
+struct sixit::rw::member_type_alias<sixit::dmath::ieee_double_static_lib> : sixit::dmath::ieee_double_static_lib::rw_alias
+{
+};
+
+#endif // sixit_dmath_gamefloat_ieee_double_static_lib_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
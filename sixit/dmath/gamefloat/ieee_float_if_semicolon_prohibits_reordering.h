@@ -198,6 +198,10 @@ struct fp_traits<ieee_float_if_semicolon_prohibits_reordering>
     {
         return fp_traits<float>::bit_cast_from_ieee_uint32(val);
     }
+    static ieee_float_if_semicolon_prohibits_reordering fma(const ieee_float_if_semicolon_prohibits_reordering& a, const ieee_float_if_semicolon_prohibits_reordering& b, const ieee_float_if_semicolon_prohibits_reordering& c)
+    {
+        return fp_traits<float>::fma(a.data, b.data, c.data);
+    }
 
     static auto to_fallback(ieee_float_if_semicolon_prohibits_reordering val) { return val; }
 };
@@ -190,6 +190,10 @@ struct fp_traits<ieee_float_if_strict_fp>
     {
         return fp_traits<float>::bit_cast_from_ieee_uint32(val);
     }
+    static ieee_float_if_strict_fp fma(const ieee_float_if_strict_fp& a, const ieee_float_if_strict_fp& b, const ieee_float_if_strict_fp& c)
+    {
+        return fp_traits<float>::fma(a.data, b.data, c.data);
+    }
 
     static auto to_fallback(ieee_float_if_strict_fp val) { return val; }
 };
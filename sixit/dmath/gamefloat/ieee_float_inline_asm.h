@@ -11,7 +11,11 @@ Contributors: Sherry Ignatchenko, Victor Istomin
 #include "sixit/core/guidelines.h"
 #include "sixit/core/lwa.h"
 #include "sixit/dmath/traits.h"
+#include "sixit/dmath/gamefloat/simd_float.h"
+#include "sixit/dmath/softfloat/softfloat_inline.h"
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
@@ -66,6 +70,95 @@ class ieee_float_inline_asm
         return bits;
     }
 
+    // a*b+c with a single rounding; the FMA instructions below are IEEE-754 fusedMultiplyAdd on every ISA,
+    //   and where none of them is guaranteed to be available, SoftFloat provides the same bits
+    static float asm_fma(float a, float b, float c)
+    {
+#if (defined(SIXIT_CPU_X64) || defined(SIXIT_CPU_X86)) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG) && defined(__FMA__)
+        asm("vfmadd231ss %2, %1, %0" : "+x"(c) : "x"(a), "x"(b));
+        return c;
+#elif defined(SIXIT_CPU_ARM64) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+        float rv;
+        asm("fmadd %s0, %s1, %s2, %s3" : "=w"(rv) : "w"(a), "w"(b), "w"(c));
+        return rv;
+#elif (defined(SIXIT_CPU_RISCV64) || defined(SIXIT_CPU_RISCV32)) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG) &&     \
+    defined(__riscv_flen)
+        float rv;
+        asm("fmadd.s %0, %1, %2, %3" : "=f"(rv) : "f"(a), "f"(b), "f"(c));
+        return rv;
+#else
+        sixit::dmath::softfloat::static_context<> ctx;
+        return sixit::lwa::bit_cast<float>(sixit::dmath::softfloat::f32_mulAdd(
+            sixit::lwa::bit_cast<sixit::dmath::softfloat::float32_t>(a),
+            sixit::lwa::bit_cast<sixit::dmath::softfloat::float32_t>(b),
+            sixit::lwa::bit_cast<sixit::dmath::softfloat::float32_t>(c), ctx));
+#endif
+    }
+
+    // K Horner steps r = k[i] + x*r as a single asm block: exactly the same instructions as K pairs of operator*
+    //   and operator+ (so the same bits), but the compiler can't spill r or reorder anything in between
+    template <size_t K>
+    static sixit::cpual::asm_float_t asm_horner_steps(sixit::cpual::asm_float_t r, sixit::cpual::asm_float_t x,
+                                                      const sixit::cpual::asm_float_t* k)
+    {
+        static_assert(K >= 1 && K <= 4);
+#if (defined(SIXIT_CPU_X64) || (defined(SIXIT_CPU_X86) && defined(__SSE2__))) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+        if constexpr (K == 1)
+            asm("mulss %1, %0\n\taddss %2, %0" : "+x"(r) : "x"(x), "xm"(k[0]));
+        else if constexpr (K == 2)
+            asm("mulss %1, %0\n\taddss %2, %0\n\t"
+                "mulss %1, %0\n\taddss %3, %0" : "+x"(r) : "x"(x), "xm"(k[0]), "xm"(k[1]));
+        else if constexpr (K == 3)
+            asm("mulss %1, %0\n\taddss %2, %0\n\t"
+                "mulss %1, %0\n\taddss %3, %0\n\t"
+                "mulss %1, %0\n\taddss %4, %0" : "+x"(r) : "x"(x), "xm"(k[0]), "xm"(k[1]), "xm"(k[2]));
+        else
+            asm("mulss %1, %0\n\taddss %2, %0\n\t"
+                "mulss %1, %0\n\taddss %3, %0\n\t"
+                "mulss %1, %0\n\taddss %4, %0\n\t"
+                "mulss %1, %0\n\taddss %5, %0" : "+x"(r) : "x"(x), "xm"(k[0]), "xm"(k[1]), "xm"(k[2]), "xm"(k[3]));
+        return r;
+#elif defined(SIXIT_CPU_ARM64) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+        if constexpr (K == 1)
+            asm("fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s2" : "+w"(r) : "w"(x), "w"(k[0]));
+        else if constexpr (K == 2)
+            asm("fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s2\n\t"
+                "fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s3" : "+w"(r) : "w"(x), "w"(k[0]), "w"(k[1]));
+        else if constexpr (K == 3)
+            asm("fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s2\n\t"
+                "fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s3\n\t"
+                "fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s4" : "+w"(r) : "w"(x), "w"(k[0]), "w"(k[1]), "w"(k[2]));
+        else
+            asm("fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s2\n\t"
+                "fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s3\n\t"
+                "fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s4\n\t"
+                "fmul %s0, %s0, %s1\n\tfadd %s0, %s0, %s5" : "+w"(r) : "w"(x), "w"(k[0]), "w"(k[1]), "w"(k[2]), "w"(k[3]));
+        return r;
+#elif (defined(SIXIT_CPU_RISCV64) || defined(SIXIT_CPU_RISCV32)) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG) &&     \
+    defined(__riscv_flen)
+        if constexpr (K == 1)
+            asm("fmul.s %0, %0, %1\n\tfadd.s %0, %0, %2" : "+f"(r) : "f"(x), "f"(k[0]));
+        else if constexpr (K == 2)
+            asm("fmul.s %0, %0, %1\n\tfadd.s %0, %0, %2\n\t"
+                "fmul.s %0, %0, %1\n\tfadd.s %0, %0, %3" : "+f"(r) : "f"(x), "f"(k[0]), "f"(k[1]));
+        else if constexpr (K == 3)
+            asm("fmul.s %0, %0, %1\n\tfadd.s %0, %0, %2\n\t"
+                "fmul.s %0, %0, %1\n\tfadd.s %0, %0, %3\n\t"
+                "fmul.s %0, %0, %1\n\tfadd.s %0, %0, %4" : "+f"(r) : "f"(x), "f"(k[0]), "f"(k[1]), "f"(k[2]));
+        else
+            asm("fmul.s %0, %0, %1\n\tfadd.s %0, %0, %2\n\t"
+                "fmul.s %0, %0, %1\n\tfadd.s %0, %0, %3\n\t"
+                "fmul.s %0, %0, %1\n\tfadd.s %0, %0, %4\n\t"
+                "fmul.s %0, %0, %1\n\tfadd.s %0, %0, %5" : "+f"(r) : "f"(x), "f"(k[0]), "f"(k[1]), "f"(k[2]), "f"(k[3]));
+        return r;
+#else
+        // no GCC-style asm: one cpual operation at a time, which is still the same sequence of instructions
+        for (size_t i = 0; i < K; ++i)
+            r = sixit::cpual::ieee_add_float(k[i], sixit::cpual::ieee_multiply_float(x, r));
+        return r;
+#endif
+    }
+
     template <typename T>
     static constexpr bool is_simd_type = std::is_same_v<T, sixit::cpual::asm_float_t> && !std::is_same_v<T, float>;
 
@@ -260,12 +353,365 @@ struct fp_traits<ieee_float_inline_asm>
         return sixit::lwa::bit_cast<float>(val);
     }
 
+    static ieee_float_inline_asm fma(ieee_float_inline_asm a, ieee_float_inline_asm b, ieee_float_inline_asm c)
+    {
+        return ieee_float_inline_asm::asm_fma(a.to_float(), b.to_float(), c.to_float());
+    }
+
     static auto to_fallback(ieee_float_inline_asm val)
     {
         return val;
     }
+
+    // c[0] + x*(c[1] + x*(... + x*c[N-1])), each operation rounded separately; see sixit::dmath::mathf::__horner()
+    template <size_t N>
+    static ieee_float_inline_asm horner(ieee_float_inline_asm x, const ieee_float_inline_asm (&c)[N])
+    {
+        static_assert(N >= 1);
+        sixit::cpual::asm_float_t xf = x.data;
+        sixit::cpual::asm_float_t k[N];
+        for (size_t i = 0; i < N; ++i)
+            k[i] = c[N - 1 - i].data; // in the order of use
+        sixit::cpual::asm_float_t r = k[0];
+        size_t i = 1;
+        for (; i + 4 <= N; i += 4)
+            r = ieee_float_inline_asm::asm_horner_steps<4>(r, xf, k + i);
+        if constexpr ((N - 1) % 4 == 1)
+            r = ieee_float_inline_asm::asm_horner_steps<1>(r, xf, k + i);
+        else if constexpr ((N - 1) % 4 == 2)
+            r = ieee_float_inline_asm::asm_horner_steps<2>(r, xf, k + i);
+        else if constexpr ((N - 1) % 4 == 3)
+            r = ieee_float_inline_asm::asm_horner_steps<3>(r, xf, k + i);
+        ieee_float_inline_asm rv;
+        rv.data = r;
+        return rv;
+    }
+};
+
+/**
+ * @brief lanes of `simd_float<ieee_float_inline_asm, N>`, stored packed
+ *
+ * `std::array<ieee_float_inline_asm, N>` would hold a whole register per lane (using only lane 0 of it);
+ *   here lanes are contiguous floats, so that `simd_lane_ops<>` below can process 4 of them (8 with AVX)
+ *   per instruction. Element access goes through `lane_ref`, so for `simd_float<>` it is still an array
+ *   of `ieee_float_inline_asm`.
+ */
+template <size_t N>
+class ieee_float_inline_asm_lanes
+{
+  public:
+    class lane_ref
+    {
+      public:
+        operator ieee_float_inline_asm() const
+        {
+            return ieee_float_inline_asm(*f);
+        }
+
+        lane_ref& operator=(ieee_float_inline_asm val)
+        {
+            *f = val.to_float();
+            return *this;
+        }
+
+        lane_ref& operator=(const lane_ref& other)
+        {
+            *f = *other.f;
+            return *this;
+        }
+
+      private:
+        explicit lane_ref(float* f_) : f(f_)
+        {
+        }
+
+        float* f;
+
+        friend class ieee_float_inline_asm_lanes;
+    };
+
+    lane_ref operator[](size_t i)
+    {
+        return lane_ref(&f[i]);
+    }
+
+    ieee_float_inline_asm operator[](size_t i) const
+    {
+        return ieee_float_inline_asm(f[i]);
+    }
+
+    void fill(ieee_float_inline_asm val)
+    {
+        float v = val.to_float();
+        for (size_t i = 0; i < N; ++i)
+            f[i] = v;
+    }
+
+  private:
+    alignas(32) float f[N] = {};
+
+    template <typename fp, size_t N_>
+    friend struct simd_lane_ops;
+};
+
+/**
+ * @brief packed arithmetic for `simd_float<ieee_float_inline_asm, N>`
+ *
+ * Packed `addps`/`subps`/`mulps`/`divps` (`vaddps` etc. on ymm with AVX) on x64/x86, and `fadd v.4s` etc.
+ *   on ARM64, in inline asm as the scalar operations are; packed IEEE operations are correctly rounded
+ *   lane by lane, and comparisons are exact, so results are bit-identical to the scalar ieee_float_inline_asm.
+ *   Where there is no GCC-style inline asm (or no packed instructions: RISC-V), it is scalar operations lane by lane.
+ */
+template <size_t N>
+    requires(N % 4 == 0)
+struct simd_lane_ops<ieee_float_inline_asm, N>
+{
+    using lanes_type = ieee_float_inline_asm_lanes<N>;
+
+    static void add(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        apply<op::add>(a, b, rv);
+    }
+
+    static void sub(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        apply<op::sub>(a, b, rv);
+    }
+
+    static void mul(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        apply<op::mul>(a, b, rv);
+    }
+
+    static void div(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        apply<op::div>(a, b, rv);
+    }
+
+    static void fma(const lanes_type& a, const lanes_type& b, const lanes_type& c, lanes_type& rv)
+    {
+#if ((defined(SIXIT_CPU_X64) || defined(SIXIT_CPU_X86)) && defined(__FMA__) || defined(SIXIT_CPU_ARM64)) &&            \
+    defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+        for (size_t i = 0; i < N; i += 4)
+        {
+            v4sf x = load4(a.f + i), y = load4(b.f + i), z = load4(c.f + i);
+#if defined(SIXIT_CPU_ARM64)
+            asm("fmla %0.4s, %1.4s, %2.4s" : "+w"(z) : "w"(x), "w"(y));
+#else
+            asm("vfmadd231ps %2, %1, %0" : "+x"(z) : "x"(x), "x"(y));
+#endif
+            store4(z, rv.f + i);
+        }
+#else
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = fp_traits<ieee_float_inline_asm>::fma(a[i], b[i], c[i]);
+#endif
+    }
+
+    static void neg(const lanes_type& a, lanes_type& rv)
+    {
+        // IEEE negate() is a sign bit flip, for NaNs too
+        simd_uint32<N> bits;
+        to_bits(a, bits);
+        for (size_t i = 0; i < N; ++i)
+            bits[i] ^= UINT32_C(0x8000'0000);
+        from_bits(bits, rv);
+    }
+
+    static void lt(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        compare<cmp::lt>(a, b, rv);
+    }
+
+    static void le(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        compare<cmp::le>(a, b, rv);
+    }
+
+    static void eq(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        compare<cmp::eq>(a, b, rv);
+    }
+
+    static void select(const simd_mask<N>& mask, const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        simd_uint32<N> ua, ub;
+        to_bits(a, ua);
+        to_bits(b, ub);
+        for (size_t i = 0; i < N; ++i)
+            ua[i] = (ua[i] & mask[i]) | (ub[i] & ~mask[i]);
+        from_bits(ua, rv);
+    }
+
+    static void to_bits(const lanes_type& a, simd_uint32<N>& rv)
+    {
+        std::memcpy(rv.data(), a.f, sizeof(a.f));
+    }
+
+    static void from_bits(const simd_uint32<N>& a, lanes_type& rv)
+    {
+        std::memcpy(rv.f, a.data(), sizeof(rv.f));
+    }
+
+  private:
+    enum class op
+    {
+        add,
+        sub,
+        mul,
+        div
+    };
+
+    enum class cmp
+    {
+        lt,
+        le,
+        eq
+    };
+
+#if (defined(SIXIT_CPU_X64) || (defined(SIXIT_CPU_X86) && defined(__SSE2__)) || defined(SIXIT_CPU_ARM64)) &&         \
+    defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+    typedef float v4sf __attribute__((vector_size(16)));
+
+    static v4sf load4(const float* src)
+    {
+        v4sf rv;
+        std::memcpy(&rv, src, sizeof(rv));
+        return rv;
+    }
+
+    static void store4(v4sf val, float* dst)
+    {
+        std::memcpy(dst, &val, sizeof(val));
+    }
+
+#if defined(__AVX__) && !defined(SIXIT_CPU_ARM64)
+    typedef float v8sf __attribute__((vector_size(32)));
+
+    template <op o>
+    static v8sf op8(v8sf a, v8sf b)
+    {
+        v8sf rv;
+        if constexpr (o == op::add)
+            asm("vaddps %2, %1, %0" : "=x"(rv) : "x"(a), "x"(b));
+        else if constexpr (o == op::sub)
+            asm("vsubps %2, %1, %0" : "=x"(rv) : "x"(a), "x"(b));
+        else if constexpr (o == op::mul)
+            asm("vmulps %2, %1, %0" : "=x"(rv) : "x"(a), "x"(b));
+        else
+            asm("vdivps %2, %1, %0" : "=x"(rv) : "x"(a), "x"(b));
+        return rv;
+    }
+#endif
+
+    template <op o>
+    static v4sf op4(v4sf a, v4sf b)
+    {
+#if defined(SIXIT_CPU_ARM64)
+        if constexpr (o == op::add)
+            asm("fadd %0.4s, %0.4s, %1.4s" : "+w"(a) : "w"(b));
+        else if constexpr (o == op::sub)
+            asm("fsub %0.4s, %0.4s, %1.4s" : "+w"(a) : "w"(b));
+        else if constexpr (o == op::mul)
+            asm("fmul %0.4s, %0.4s, %1.4s" : "+w"(a) : "w"(b));
+        else
+            asm("fdiv %0.4s, %0.4s, %1.4s" : "+w"(a) : "w"(b));
+#else
+        if constexpr (o == op::add)
+            asm("addps %1, %0" : "+x"(a) : "x"(b));
+        else if constexpr (o == op::sub)
+            asm("subps %1, %0" : "+x"(a) : "x"(b));
+        else if constexpr (o == op::mul)
+            asm("mulps %1, %0" : "+x"(a) : "x"(b));
+        else
+            asm("divps %1, %0" : "+x"(a) : "x"(b));
+#endif
+        return a;
+    }
+
+    template <op o>
+    static void apply(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        size_t i = 0;
+#if defined(__AVX__) && !defined(SIXIT_CPU_ARM64)
+        for (; i + 8 <= N; i += 8)
+        {
+            v8sf x, y;
+            std::memcpy(&x, a.f + i, sizeof(x));
+            std::memcpy(&y, b.f + i, sizeof(y));
+            x = op8<o>(x, y);
+            std::memcpy(rv.f + i, &x, sizeof(x));
+        }
+#endif
+        for (; i < N; i += 4)
+            store4(op4<o>(load4(a.f + i), load4(b.f + i)), rv.f + i);
+    }
+
+    template <cmp c>
+    static void compare(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        for (size_t i = 0; i < N; i += 4)
+        {
+            v4sf x = load4(a.f + i), y = load4(b.f + i);
+#if defined(SIXIT_CPU_ARM64)
+            if constexpr (c == cmp::lt)
+                asm("fcmgt %0.4s, %1.4s, %0.4s" : "+w"(x) : "w"(y));
+            else if constexpr (c == cmp::le)
+                asm("fcmge %0.4s, %1.4s, %0.4s" : "+w"(x) : "w"(y));
+            else
+                asm("fcmeq %0.4s, %0.4s, %1.4s" : "+w"(x) : "w"(y));
+#else
+            if constexpr (c == cmp::lt)
+                asm("cmpltps %1, %0" : "+x"(x) : "x"(y));
+            else if constexpr (c == cmp::le)
+                asm("cmpleps %1, %0" : "+x"(x) : "x"(y));
+            else
+                asm("cmpeqps %1, %0" : "+x"(x) : "x"(y));
+#endif
+            std::memcpy(rv.data() + i, &x, sizeof(x));
+        }
+    }
+#else
+    template <op o>
+    static void apply(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            if constexpr (o == op::add)
+                rv[i] = a[i] + b[i];
+            else if constexpr (o == op::sub)
+                rv[i] = a[i] - b[i];
+            else if constexpr (o == op::mul)
+                rv[i] = a[i] * b[i];
+            else
+                rv[i] = a[i] / b[i];
+        }
+    }
+
+    template <cmp c>
+    static void compare(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            bool r;
+            if constexpr (c == cmp::lt)
+                r = a[i] < b[i];
+            else if constexpr (c == cmp::le)
+                r = a[i] <= b[i];
+            else
+                r = a[i] == b[i];
+            rv[i] = r ? UINT32_C(0xffff'ffff) : 0;
+        }
+    }
+#endif
 };
 
+/**
+ * @brief 4 and 8 lanes of ieee_float_inline_asm, processed by packed instructions (see above)
+ */
+using ieee_float4_inline_asm = simd_float<ieee_float_inline_asm, 4>;
+using ieee_float8_inline_asm = simd_float<ieee_float_inline_asm, 8>;
+
 #else // unsupported platform
 
 // a stub as the ieee_float_inline_asm is not supported on this platform
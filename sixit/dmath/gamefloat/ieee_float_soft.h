@@ -14,8 +14,10 @@ Contributors: Sherry Ignatchenko, Victor Istomin
 #include "sixit/core/guidelines.h"
 #include "sixit/core/lwa.h"
 #include "sixit/dmath/traits.h"
+#include "sixit/dmath/gamefloat/simd_float.h"
 
 #include "sixit/dmath/softfloat/softfloat_inline.h"
+#include "sixit/dmath/softfloat/softfloat_lanes.h"
 
 namespace sixit::rw
 {
@@ -41,12 +43,12 @@ namespace sixit::dmath
  */
 class ieee_float_soft
 {
-    static int32_t f32bits_to_exponent(uint32_t bits)
+    static constexpr int32_t f32bits_to_exponent(uint32_t bits)
     {
         return ((bits >> 23) & 0xFF) - 127;
     }
 
-    static int32_t f32bits_to_mantissa(uint32_t bits)
+    static constexpr int32_t f32bits_to_mantissa(uint32_t bits)
     {
         int32_t rv = bits & 0x7f'ffff;
         uint32_t implicit_bit = static_cast<uint32_t>(f32bits_to_exponent(bits) > -127) << 23;
@@ -56,10 +58,11 @@ class ieee_float_soft
         return is_negative ? -rv : rv;
     }
 
-    static uint32_t f32bits_set_exponent(uint32_t bits, int32_t new_exp)
+    static constexpr uint32_t f32bits_set_exponent(uint32_t bits, int32_t new_exp)
     {
         auto biased_exp = new_exp + 127;
-        SIXIT_ASSUMERT(biased_exp >= 0 && biased_exp < 0x100);
+        if (!std::is_constant_evaluated())
+            SIXIT_ASSUMERT(biased_exp >= 0 && biased_exp < 0x100);
 
         bits &= UINT32_C(0x807f'ffff);
         bits |= biased_exp << 23;
@@ -68,76 +71,86 @@ class ieee_float_soft
 
     using soft_float_t = sixit::dmath::softfloat::float32_t;
 
-    ieee_float_soft(soft_float_t f32) : data(f32)
+    // rounding to nearest/even, exception flags are discarded: no thread-local state is involved
+    using softfloat_context = sixit::dmath::softfloat::static_context<>;
+
+    constexpr ieee_float_soft(soft_float_t f32) : data(f32)
     {
     }
 
   public:
-    float to_float() const
+    constexpr float to_float() const
     {
         return sixit::lwa::bit_cast<float>(data);
     }
 
     constexpr ieee_float_soft() noexcept = default;
-    ieee_float_soft(const ieee_float_soft& other) noexcept = default;
-    ieee_float_soft(ieee_float_soft&& other) noexcept = default;
-    ieee_float_soft& operator=(const ieee_float_soft& other) noexcept = default;
+    constexpr ieee_float_soft(const ieee_float_soft& other) noexcept = default;
+    constexpr ieee_float_soft(ieee_float_soft&& other) noexcept = default;
+    constexpr ieee_float_soft& operator=(const ieee_float_soft& other) noexcept = default;
 
     constexpr ieee_float_soft(float f) : data(sixit::lwa::bit_cast<soft_float_t>(f)) {};
 
-    ieee_float_soft operator+(ieee_float_soft other) const
+    constexpr ieee_float_soft operator+(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_add(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_add(data, other.data, ctx);
     }
 
-    ieee_float_soft operator-(ieee_float_soft other) const
+    constexpr ieee_float_soft operator-(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_sub(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_sub(data, other.data, ctx);
     }
     
-    ieee_float_soft operator*(ieee_float_soft other) const
+    constexpr ieee_float_soft operator*(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_mul(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_mul(data, other.data, ctx);
     }
 
-    ieee_float_soft operator/(ieee_float_soft other) const
+    constexpr ieee_float_soft operator/(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_div(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_div(data, other.data, ctx);
     }
 
-    bool operator<(ieee_float_soft other) const
+    constexpr bool operator<(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_lt(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_lt(data, other.data, ctx);
     }
 
-    bool operator<=(ieee_float_soft other) const
+    constexpr bool operator<=(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_le(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_le(data, other.data, ctx);
     }
 
-    bool operator==(ieee_float_soft other) const
+    constexpr bool operator==(ieee_float_soft other) const
     {
-        return sixit::dmath::softfloat::f32_eq(data, other.data);
+        softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_eq(data, other.data, ctx);
     }
 
-    bool operator>(ieee_float_soft other) const
+    constexpr bool operator>(ieee_float_soft other) const
     {
         return other < *this;
     }
 
-    bool operator>=(ieee_float_soft other) const
+    constexpr bool operator>=(ieee_float_soft other) const
     {
         return other <= *this;
     }
 
-    bool operator!=(ieee_float_soft other) const
+    constexpr bool operator!=(ieee_float_soft other) const
     {
         return !(*this == other);
     }
 
-    ieee_float_soft operator-() const
+    constexpr ieee_float_soft operator-() const
     {
-        static constexpr uint32_t sign_bit = 0x8000'0000;
+        constexpr uint32_t sign_bit = 0x8000'0000;
         uint32_t bits = sixit::lwa::bit_cast<uint32_t>(to_float());
         return sixit::lwa::bit_cast<float>(bits ^ sign_bit);
     }
@@ -147,6 +160,8 @@ class ieee_float_soft
 
     template <typename fp>
     friend struct sixit::dmath::fp_traits;
+    template <typename fp, size_t N>
+    friend struct sixit::dmath::simd_lane_ops;
 
     struct rw_alias
     {
@@ -182,39 +197,40 @@ struct fp_traits<ieee_float_soft>
     using intermediate_type = float;
     using fixed_point_type = void*;
 
-    static bool isnan(ieee_float_soft val)
+    static constexpr bool isnan(ieee_float_soft val)
     {
         return sixit::dmath::softfloat::f32_isSignalingNaN(val.data) || (val != val);
     }
 
-    static bool isinf(ieee_float_soft val)
+    static constexpr bool isinf(ieee_float_soft val)
     {
-        static constexpr auto pos_inf = ieee_float_soft(std::numeric_limits<float>::infinity());
-        static constexpr auto neg_inf = ieee_float_soft(-std::numeric_limits<float>::infinity());
+        constexpr auto pos_inf = ieee_float_soft(std::numeric_limits<float>::infinity());
+        constexpr auto neg_inf = ieee_float_soft(-std::numeric_limits<float>::infinity());
         return val == pos_inf || val == neg_inf;
     }
 
-    static bool isfinite(ieee_float_soft val)
+    static constexpr bool isfinite(ieee_float_soft val)
     {
-        static constexpr int special_exp = 128;    // exponent of infinite and NaN
+        constexpr int special_exp = 128;    // exponent of infinite and NaN
         return get_exp(val) != special_exp;
     }
 
-    static int32_t get_exp(ieee_float_soft val)
+    static constexpr int32_t get_exp(ieee_float_soft val)
     {
         uint32_t bits = fp_traits<ieee_float_soft>::bit_cast_to_ieee_uint32(val);
         return ieee_float_soft::f32bits_to_exponent(bits);
     }
 
-    static int32_t get_mantissa(ieee_float_soft val)
+    static constexpr int32_t get_mantissa(ieee_float_soft val)
     {
         uint32_t bits = fp_traits<ieee_float_soft>::bit_cast_to_ieee_uint32(val);
         return ieee_float_soft::f32bits_to_mantissa(bits);
     }
 
-    static bool set_exp(ieee_float_soft& val, int exp)
+    static constexpr bool set_exp(ieee_float_soft& val, int exp)
     {
-        SIXIT_ASSUMERT(exp >= -127 && exp <= 127);
+        if (!std::is_constant_evaluated())
+            SIXIT_ASSUMERT(exp >= -127 && exp <= 127);
         if (exp < -127 || exp > 127)
             return false;
 
@@ -224,34 +240,102 @@ struct fp_traits<ieee_float_soft>
         return true;
     }
 
-    static int64_t fp2int64(ieee_float_soft val)
+    static constexpr int64_t fp2int64(ieee_float_soft val)
     {
-        return sixit::dmath::softfloat::f32_to_i64(val.data, sixit::dmath::softfloat::softfloat_round_minMag, false);
+        ieee_float_soft::softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_to_i64(val.data, sixit::dmath::softfloat::softfloat_round_minMag, false,
+                                                   ctx);
     }
 
-    static uint32_t bit_cast_to_ieee_uint32(ieee_float_soft val)
+    static constexpr uint32_t bit_cast_to_ieee_uint32(ieee_float_soft val)
     {
         return sixit::lwa::bit_cast<uint32_t>(val.to_float());
     }
     
-    static ieee_float_soft bit_cast_from_ieee_uint32(uint32_t bits)
+    static constexpr ieee_float_soft bit_cast_from_ieee_uint32(uint32_t bits)
     {
         return ieee_float_soft(sixit::lwa::bit_cast<ieee_float_soft::soft_float_t>(bits));
     }
 
-    static bool get_sign(ieee_float_soft val)
+    static constexpr bool get_sign(ieee_float_soft val)
     {
-        static constexpr uint32_t sign_bit = 0x8000'0000;
+        constexpr uint32_t sign_bit = 0x8000'0000;
         return (bit_cast_to_ieee_uint32(val) & sign_bit) != 0;
     }
 
-    static bool equal_to_zero(ieee_float_soft val)
+    static constexpr bool equal_to_zero(ieee_float_soft val)
     {
-        static constexpr uint32_t sign_bit = 0x8000'0000;
+        constexpr uint32_t sign_bit = 0x8000'0000;
         return (bit_cast_to_ieee_uint32(val) & ~sign_bit) == 0;
     }
 
-    static auto to_fallback(ieee_float_soft val) { return val; }
+    // a*b+c with a single rounding
+    static constexpr ieee_float_soft fma(ieee_float_soft a, ieee_float_soft b, ieee_float_soft c)
+    {
+        ieee_float_soft::softfloat_context ctx;
+        return sixit::dmath::softfloat::f32_mulAdd(a.data, b.data, c.data, ctx);
+    }
+
+    static constexpr auto to_fallback(ieee_float_soft val) { return val; }
+};
+
+/**
+ * @brief lane-parallel SoftFloat arithmetic for `simd_float<ieee_float_soft, N>`
+ *
+ * See `sixit/dmath/softfloat/softfloat_lanes.h` for details; results are bit-identical to the scalar ones.
+ */
+template <size_t N>
+struct simd_lane_ops<ieee_float_soft, N> : simd_lane_ops_generic<ieee_float_soft, N>
+{
+    using lanes_type = std::array<ieee_float_soft, N>;
+    using soft_lanes_type = std::array<sixit::dmath::softfloat::float32_t, N>;
+
+    static void add(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        soft_lanes_type z;
+        ieee_float_soft::softfloat_context ctx;
+        sixit::dmath::softfloat::f32_add_lanes<N>(to_soft(a).data(), to_soft(b).data(), z.data(), ctx);
+        from_soft(z, rv);
+    }
+
+    static void sub(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        soft_lanes_type z;
+        ieee_float_soft::softfloat_context ctx;
+        sixit::dmath::softfloat::f32_sub_lanes<N>(to_soft(a).data(), to_soft(b).data(), z.data(), ctx);
+        from_soft(z, rv);
+    }
+
+    static void mul(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        soft_lanes_type z;
+        ieee_float_soft::softfloat_context ctx;
+        sixit::dmath::softfloat::f32_mul_lanes<N>(to_soft(a).data(), to_soft(b).data(), z.data(), ctx);
+        from_soft(z, rv);
+    }
+
+    static void div(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        soft_lanes_type z;
+        ieee_float_soft::softfloat_context ctx;
+        sixit::dmath::softfloat::f32_div_lanes<N>(to_soft(a).data(), to_soft(b).data(), z.data(), ctx);
+        from_soft(z, rv);
+    }
+
+  private:
+    static soft_lanes_type to_soft(const lanes_type& a)
+    {
+        soft_lanes_type rv;
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i].data;
+        return rv;
+    }
+
+    static void from_soft(const soft_lanes_type& a, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = ieee_float_soft(a[i]);
+    }
 };
 
 } // namespace sixit::dmath
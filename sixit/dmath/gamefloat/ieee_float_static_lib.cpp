@@ -4,8 +4,22 @@ This file is licensed under The 3-Clause BSD License, with full text available a
 Contributors: Sherry Ignatchenko, Victor Istomin
 */
 
+// a*b + c must stay two separately rounded operations (as multiply() followed by add()), both in the array
+//   functions and in mathf functions instantiated below, so contracting it into an FMA instruction is not allowed
+//   anywhere in this file (the pragmas go before the #includes, to cover the mathf templates too)
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
 #include "sixit/core/lwa.h"
 #include "sixit/dmath/gamefloat/ieee_float_static_lib.h"
+#ifdef SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB
+#include "sixit/dmath/mathf/mathf.h"
+#endif
 
 #include <cmath>
 
@@ -31,6 +45,12 @@ float ieee_float_static_lib_detail::divide(float lhs, float rhs)
     return lhs / rhs;
 }
 
+float ieee_float_static_lib_detail::fma(float a, float b, float c)
+{
+    // std::fma() is correctly rounded by definition, whether it is a single instruction or a library call
+    return std::fma(a, b, c);
+}
+
 bool ieee_float_static_lib_detail::compare_lt(float lhs, float rhs)
 {
     return lhs < rhs;
@@ -143,6 +163,93 @@ float ieee_float_static_lib_detail::bit_cast_from_ieee_uint32(uint32_t val)
     return sixit::lwa::bit_cast<float>(val);
 }
 
+// array versions: plain loops, which are free to be unrolled and vectorized by the compiler, as each element
+//   is still computed by exactly one IEEE operation (and SIMD add/sub/mul/div/fma are correctly rounded too).
+//   Element-wise loops go strictly forward, so out == a (or b, or c) is fine
+
+void ieee_float_static_lib_detail::add_n(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] + b[i];
+}
+
+void ieee_float_static_lib_detail::subtract_n(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] - b[i];
+}
+
+void ieee_float_static_lib_detail::multiply_n(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] * b[i];
+}
+
+void ieee_float_static_lib_detail::divide_n(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] / b[i];
+}
+
+void ieee_float_static_lib_detail::mul_add_n(const float* a, const float* b, const float* c, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] * b[i] + c[i];
+}
+
+void ieee_float_static_lib_detail::fma_n(const float* a, const float* b, const float* c, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = std::fma(a[i], b[i], c[i]);
+}
+
+float ieee_float_static_lib_detail::dot_n(const float* a, const float* b, size_t n)
+{
+    // single accumulator on purpose: splitting the sum into several partial ones would be faster,
+    //   but it would change the order of additions, and so the result
+    float acc = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+        acc = acc + a[i] * b[i];
+    return acc;
+}
+
+// whole mathf functions: _sin() etc. here are the very same templates as everywhere else, instantiated for
+//   ieee_float_static_lib; the only difference is that within this file the compiler may inline the operations.
+//   They need the class itself, so they exist only when SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB is set for
+//   the whole build (the class is used only then, so nobody calls them otherwise)
+#ifdef SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB
+
+float ieee_float_static_lib_detail::mathf_sin(float x)
+{
+    return sixit::dmath::mathf::_sin(ieee_float_static_lib(x)).to_float();
+}
+
+float ieee_float_static_lib_detail::mathf_cos(float x)
+{
+    return sixit::dmath::mathf::_cos(ieee_float_static_lib(x)).to_float();
+}
+
+float ieee_float_static_lib_detail::mathf_exp(float x)
+{
+    return sixit::dmath::mathf::_exp(ieee_float_static_lib(x)).to_float();
+}
+
+float ieee_float_static_lib_detail::mathf_log(float x)
+{
+    return sixit::dmath::mathf::_log(ieee_float_static_lib(x)).to_float();
+}
+
+float ieee_float_static_lib_detail::mathf_atan2(float y, float x)
+{
+    return sixit::dmath::mathf::_atan2(ieee_float_static_lib(y), ieee_float_static_lib(x)).to_float();
+}
+
+float ieee_float_static_lib_detail::mathf_sqrt(float x)
+{
+    return sixit::dmath::mathf::_sqrt(ieee_float_static_lib(x)).to_float();
+}
+#endif // SIXIT_DMATH_SUPPORT_IEEE_FLOAT_STATIC_LIB
+
 /*
 The 3-Clause BSD License
 
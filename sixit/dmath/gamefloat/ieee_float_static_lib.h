@@ -6,6 +6,7 @@ Contributors: Sherry Ignatchenko, Victor Istomin
 #ifndef sixit_dmath_gamefloat_ieee_float_static_lib_h_included
 #define sixit_dmath_gamefloat_ieee_float_static_lib_h_included
 
+#include <cstddef>
 #include <cstdint>
 
 #include "sixit/core/core.h"
@@ -43,6 +44,7 @@ class ieee_float_static_lib_detail
     static float subtract(float lhs, float rhs);
     static float multiply(float lhs, float rhs);
     static float divide(float lhs, float rhs);
+    static float fma(float a, float b, float c);
     static bool compare_lt(float lhs, float rhs);
     static bool compare_gt(float lhs, float rhs);
     static bool compare_le(float lhs, float rhs);
@@ -62,6 +64,28 @@ class ieee_float_static_lib_detail
     static bool equal_to_zero(float val);
     static float bit_cast_from_ieee_uint32(uint32_t val);
 
+    // array versions, so that one opaque call covers the whole loop: out[i] = a[i] op b[i],
+    //   bit-identical to the scalar operations above (out may alias a, b or c)
+    static void add_n(const float* a, const float* b, float* out, size_t n);
+    static void subtract_n(const float* a, const float* b, float* out, size_t n);
+    static void multiply_n(const float* a, const float* b, float* out, size_t n);
+    static void divide_n(const float* a, const float* b, float* out, size_t n);
+    // out[i] = a[i]*b[i] + c[i], rounded twice (as multiply() followed by add())
+    static void mul_add_n(const float* a, const float* b, const float* c, float* out, size_t n);
+    // out[i] = fma(a[i], b[i], c[i]), rounded once
+    static void fma_n(const float* a, const float* b, const float* c, float* out, size_t n);
+    // ((0 + a[0]*b[0]) + a[1]*b[1]) + ..., each operation rounded separately, strictly in this order
+    static float dot_n(const float* a, const float* b, size_t n);
+
+    // whole sixit::dmath::mathf functions, instantiated for ieee_float_static_lib within the .cpp, where all the
+    //   operations above can be inlined; so it is one opaque call per function, with exactly the same result
+    static float mathf_sin(float x);
+    static float mathf_cos(float x);
+    static float mathf_exp(float x);
+    static float mathf_log(float x);
+    static float mathf_atan2(float y, float x);
+    static float mathf_sqrt(float x);
+
     friend sixit::dmath::ieee_float_static_lib;
     template <typename fp>
     friend struct sixit::dmath::fp_traits;
@@ -252,8 +276,74 @@ struct fp_traits<ieee_float_static_lib>
     {
         return ieee_float_static_lib(ieee_float_static_lib_detail::bit_cast_from_ieee_uint32(val));
     }
+
+    // a*b+c with a single rounding
+    static ieee_float_static_lib fma(ieee_float_static_lib a, ieee_float_static_lib b, ieee_float_static_lib c)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::fma(a.data, b.data, c.data));
+    }
+
     static auto to_fallback(ieee_float_static_lib val) { return val; }
+
+    // array entry points (see ieee_float_static_lib_detail); used by sixit::dmath::mathf::batch:: arithmetic
+    static void add_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, ieee_float_static_lib* out, size_t n)
+    {
+        ieee_float_static_lib_detail::add_n(&a->data, &b->data, &out->data, n);
+    }
+    static void subtract_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, ieee_float_static_lib* out, size_t n)
+    {
+        ieee_float_static_lib_detail::subtract_n(&a->data, &b->data, &out->data, n);
+    }
+    static void multiply_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, ieee_float_static_lib* out, size_t n)
+    {
+        ieee_float_static_lib_detail::multiply_n(&a->data, &b->data, &out->data, n);
+    }
+    static void divide_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, ieee_float_static_lib* out, size_t n)
+    {
+        ieee_float_static_lib_detail::divide_n(&a->data, &b->data, &out->data, n);
+    }
+    static void mul_add_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, const ieee_float_static_lib* c, ieee_float_static_lib* out, size_t n)
+    {
+        ieee_float_static_lib_detail::mul_add_n(&a->data, &b->data, &c->data, &out->data, n);
+    }
+    static void fma_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, const ieee_float_static_lib* c, ieee_float_static_lib* out, size_t n)
+    {
+        ieee_float_static_lib_detail::fma_n(&a->data, &b->data, &c->data, &out->data, n);
+    }
+    static ieee_float_static_lib dot_n(const ieee_float_static_lib* a, const ieee_float_static_lib* b, size_t n)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::dot_n(&a->data, &b->data, n));
+    }
+
+    // out-of-line mathf functions (see ieee_float_static_lib_detail); sixit::dmath::mathf::sin() etc. call them
+    //   instead of composing the function out of opaque operations
+    static ieee_float_static_lib mathf_sin(ieee_float_static_lib x)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::mathf_sin(x.data));
+    }
+    static ieee_float_static_lib mathf_cos(ieee_float_static_lib x)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::mathf_cos(x.data));
+    }
+    static ieee_float_static_lib mathf_exp(ieee_float_static_lib x)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::mathf_exp(x.data));
+    }
+    static ieee_float_static_lib mathf_log(ieee_float_static_lib x)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::mathf_log(x.data));
+    }
+    static ieee_float_static_lib mathf_atan2(ieee_float_static_lib y, ieee_float_static_lib x)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::mathf_atan2(y.data, x.data));
+    }
+    static ieee_float_static_lib mathf_sqrt(ieee_float_static_lib x)
+    {
+        return ieee_float_static_lib(ieee_float_static_lib_detail::mathf_sqrt(x.data));
+    }
 };
+// array entry points above treat arrays of ieee_float_static_lib as arrays of float
+static_assert(sizeof(ieee_float_static_lib) == sizeof(float));
 
 #else  // LTO/LTCG absence is not confirmed, ieee_float_static_lib disabled
 // a stub as the ieee_float_inline_asm is not supported on this platform
@@ -0,0 +1,429 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+
+#ifndef sixit_dmath_gamefloat_simd_float_h_included
+#define sixit_dmath_gamefloat_simd_float_h_included
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "sixit/core/lwa.h"
+#include "sixit/dmath/traits.h"
+
+namespace sixit::dmath
+{
+
+/**
+ * @brief per-lane 32-bit unsigned integers, used for IEEE bit patterns of lanes
+ */
+template <size_t N>
+using simd_uint32 = std::array<uint32_t, N>;
+
+/**
+ * @brief per-lane mask, each lane is either all-ones (true) or all-zeros (false)
+ */
+template <size_t N>
+using simd_mask = std::array<uint32_t, N>;
+
+/**
+ * @brief true for fp types which carry several lanes and follow the SIMD part of `fp_traits<>`
+ *
+ * SIMD part of `fp_traits<>` consists of `lanes`, `lane_type`, `load()`, `store()`, `broadcast()`,
+ *   `select()` and bit casts which operate on `simd_uint32<lanes>`.
+ */
+template <typename fp>
+constexpr bool is_simd_fp_v = requires { fp_traits<fp>::lanes; };
+
+/**
+ * @brief generic lane operations: scalar operations of `fp` applied lane by lane
+ *
+ * Results are bit-identical to the scalar code by construction.
+ */
+template <typename fp, size_t N>
+struct simd_lane_ops_generic
+{
+    using lanes_type = std::array<fp, N>;
+
+    static void add(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] + b[i];
+    }
+
+    static void sub(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] - b[i];
+    }
+
+    static void mul(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] * b[i];
+    }
+
+    static void div(const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] / b[i];
+    }
+
+    static void fma(const lanes_type& a, const lanes_type& b, const lanes_type& c, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = fp_traits<fp>::fma(a[i], b[i], c[i]);
+    }
+
+    static void neg(const lanes_type& a, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = -a[i];
+    }
+
+    static void lt(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] < b[i] ? UINT32_C(0xffff'ffff) : 0;
+    }
+
+    static void le(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] <= b[i] ? UINT32_C(0xffff'ffff) : 0;
+    }
+
+    static void eq(const lanes_type& a, const lanes_type& b, simd_mask<N>& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = a[i] == b[i] ? UINT32_C(0xffff'ffff) : 0;
+    }
+
+    static void select(const simd_mask<N>& mask, const lanes_type& a, const lanes_type& b, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = mask[i] ? a[i] : b[i];
+    }
+
+    static void to_bits(const lanes_type& a, simd_uint32<N>& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = fp_traits<fp>::bit_cast_to_ieee_uint32(a[i]);
+    }
+
+    static void from_bits(const simd_uint32<N>& a, lanes_type& rv)
+    {
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = fp_traits<fp>::bit_cast_from_ieee_uint32(a[i]);
+    }
+};
+
+/**
+ * @brief lane operations used by `simd_float<>`
+ *
+ * Backends which can process several lanes at once (while staying bit-exact) specialize this template,
+ *   usually deriving from `simd_lane_ops_generic<>` and replacing only some of the operations.
+ */
+template <typename fp, size_t N>
+struct simd_lane_ops : simd_lane_ops_generic<fp, N>
+{
+};
+
+/**
+ * @brief batch of N lanes of deterministic fp, processed together
+ *
+ * All operations are lane-wise and produce exactly the same bits as the same operation applied to each lane
+ *   separately; this allows mathf functions to process several arguments at once, replacing branches with
+ *   masked selects, while staying bit-identical to the scalar path.
+ *
+ * Typical N is 4, 8 or 16.
+ *
+ * NB: `+ - * /`, `fma()`, comparisons and selects are lane-parallel (packed where `simd_lane_ops<>` is specialized),
+ *   but `mathf::sin()`, `cos()`, `exp()` and `log()` over `simd_float<>` are NOT faster than scalar calls: by default
+ *   they apply the scalar function lane by lane, as the lane-parallel kernels in mathf/simd/ (which compute all
+ *   the branches for all the lanes) are currently slower than that on all the backends; define
+ *   SIXIT_DMATH_SIMD_USE_LANE_KERNELS to use them anyway (results are bit-identical either way).
+ */
+template <typename fp, size_t N>
+class simd_float
+{
+    static_assert(N > 0);
+    static_assert(!fp_traits<fp>::is_fixed_point, "simd_float<> is intended for IEEE-compatible fp types");
+
+    using ops = simd_lane_ops<fp, N>;
+    using lanes_type = typename ops::lanes_type;
+
+  public:
+    using lane_type = fp;
+    static constexpr size_t lanes = N;
+
+    simd_float() noexcept = default;
+    simd_float(const simd_float& other) noexcept = default;
+    simd_float& operator=(const simd_float& other) noexcept = default;
+
+    /** broadcasting constructors */
+    simd_float(fp val)
+    {
+        data.fill(val);
+    }
+
+    template <typename T>
+        requires(std::is_floating_point_v<T> && !std::is_same_v<T, fp>)
+    explicit simd_float(T val) : simd_float(fp(float(val)))
+    {
+    }
+
+    fp operator[](size_t i) const
+    {
+        return data[i];
+    }
+
+    simd_float operator+(const simd_float& other) const
+    {
+        simd_float rv;
+        ops::add(data, other.data, rv.data);
+        return rv;
+    }
+
+    simd_float operator-(const simd_float& other) const
+    {
+        simd_float rv;
+        ops::sub(data, other.data, rv.data);
+        return rv;
+    }
+
+    simd_float operator*(const simd_float& other) const
+    {
+        simd_float rv;
+        ops::mul(data, other.data, rv.data);
+        return rv;
+    }
+
+    simd_float operator/(const simd_float& other) const
+    {
+        simd_float rv;
+        ops::div(data, other.data, rv.data);
+        return rv;
+    }
+
+    simd_float operator-() const
+    {
+        simd_float rv;
+        ops::neg(data, rv.data);
+        return rv;
+    }
+
+    simd_mask<N> operator<(const simd_float& other) const
+    {
+        simd_mask<N> rv;
+        ops::lt(data, other.data, rv);
+        return rv;
+    }
+
+    simd_mask<N> operator<=(const simd_float& other) const
+    {
+        simd_mask<N> rv;
+        ops::le(data, other.data, rv);
+        return rv;
+    }
+
+    simd_mask<N> operator==(const simd_float& other) const
+    {
+        simd_mask<N> rv;
+        ops::eq(data, other.data, rv);
+        return rv;
+    }
+
+    simd_mask<N> operator>(const simd_float& other) const
+    {
+        return other < *this;
+    }
+
+    simd_mask<N> operator>=(const simd_float& other) const
+    {
+        return other <= *this;
+    }
+
+    simd_mask<N> operator!=(const simd_float& other) const
+    {
+        simd_mask<N> rv = *this == other;
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = ~rv[i];
+        return rv;
+    }
+
+  private:
+    lanes_type data = {};
+
+    template <typename fp_>
+    friend struct sixit::dmath::fp_traits;
+};
+
+template <typename fp, size_t N>
+struct fp_traits<simd_float<fp, N>>
+{
+    using simd_type = simd_float<fp, N>;
+    using ops = simd_lane_ops<fp, N>;
+
+    static constexpr bool is_valid_fp = fp_traits<fp>::is_valid_fp;
+    static constexpr bool is_deterministic = fp_traits<fp>::is_deterministic;
+    static constexpr bool is_fixed_point = false;
+    static constexpr bool is_supported = fp_traits<fp>::is_supported;
+
+    static constexpr auto display_name =
+        sixit::lwa::string_literal_helper("simd_float<") + fp_traits<fp>::display_name + ">";
+
+    using intermediate_type = simd_type;
+    using fixed_point_type = void*;
+
+    using lane_type = fp;
+    static constexpr size_t lanes = N;
+
+    static simd_type load(const fp* src)
+    {
+        simd_type rv;
+        for (size_t i = 0; i < N; ++i)
+            rv.data[i] = src[i];
+        return rv;
+    }
+
+    static void store(const simd_type& val, fp* dst)
+    {
+        for (size_t i = 0; i < N; ++i)
+            dst[i] = val.data[i];
+    }
+
+    static simd_type broadcast(fp val)
+    {
+        return simd_type(val);
+    }
+
+    static fp get_lane(const simd_type& val, size_t i)
+    {
+        return val.data[i];
+    }
+
+    static void set_lane(simd_type& val, size_t i, fp lane)
+    {
+        val.data[i] = lane;
+    }
+
+    static simd_type select(const simd_mask<N>& mask, const simd_type& a, const simd_type& b)
+    {
+        simd_type rv;
+        ops::select(mask, a.data, b.data, rv.data);
+        return rv;
+    }
+
+    static simd_type fma(const simd_type& a, const simd_type& b, const simd_type& c)
+    {
+        simd_type rv;
+        ops::fma(a.data, b.data, c.data, rv.data);
+        return rv;
+    }
+
+    static simd_uint32<N> bit_cast_to_ieee_uint32(const simd_type& val)
+    {
+        simd_uint32<N> rv;
+        ops::to_bits(val.data, rv);
+        return rv;
+    }
+
+    static simd_type bit_cast_from_ieee_uint32(const simd_uint32<N>& bits)
+    {
+        simd_type rv;
+        ops::from_bits(bits, rv.data);
+        return rv;
+    }
+
+    static simd_mask<N> isnan(const simd_type& val)
+    {
+        return val != val;
+    }
+
+    static simd_mask<N> isinf(const simd_type& val)
+    {
+        simd_uint32<N> rv = bit_cast_to_ieee_uint32(val);
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = (rv[i] & 0x7fff'ffff) == 0x7f80'0000 ? UINT32_C(0xffff'ffff) : 0;
+        return rv;
+    }
+
+    static simd_mask<N> isfinite(const simd_type& val)
+    {
+        simd_uint32<N> rv = bit_cast_to_ieee_uint32(val);
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = (rv[i] & 0x7f80'0000) != 0x7f80'0000 ? UINT32_C(0xffff'ffff) : 0;
+        return rv;
+    }
+
+    static simd_mask<N> get_sign(const simd_type& val)
+    {
+        simd_uint32<N> rv = bit_cast_to_ieee_uint32(val);
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = (rv[i] >> 31) ? UINT32_C(0xffff'ffff) : 0;
+        return rv;
+    }
+
+    static simd_mask<N> equal_to_zero(const simd_type& val)
+    {
+        simd_uint32<N> rv = bit_cast_to_ieee_uint32(val);
+        for (size_t i = 0; i < N; ++i)
+            rv[i] = (rv[i] << 1) == 0 ? UINT32_C(0xffff'ffff) : 0;
+        return rv;
+    }
+
+    static auto to_fallback(const simd_type& val) { return val; }
+};
+
+/**
+ * @brief SIMD type used for bulk processing of contiguous arrays of fp (see `mathf/batch.h`)
+ *
+ * Backends with packed operations specialize it to point to their packed type.
+ */
+template <typename fp>
+struct simd_batch_type
+{
+    using type = simd_float<fp, 8>;
+};
+
+} // namespace sixit::dmath
+
+#endif // sixit_dmath_gamefloat_simd_float_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathd___cos_h_included
+#define sixit_dmath_mathd___cos_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    /*
+     * __cos( x,  y )
+     * kernel cos function on [-pi/4, pi/4], pi/4 ~ 0.785398164
+     * Input x is assumed to be bounded by ~pi/4 in magnitude.
+     * Input y is the tail of x.
+     */
+    template <typename fp>
+    struct __cos_kernel_data
+    {
+        static constexpr fp C1 = fp( 4.16666666666666019037e-02); /* 0x3FA55555, 0x5555554C */
+        static constexpr fp C2 = fp(-1.38888888888741095749e-03); /* 0xBF56C16C, 0x16C15177 */
+        static constexpr fp C3 = fp( 2.48015872894767294178e-05); /* 0x3EFA01A0, 0x19CB1590 */
+        static constexpr fp C4 = fp(-2.75573143513906633035e-07); /* 0xBE927E4F, 0x809C52AD */
+        static constexpr fp C5 = fp( 2.08757232129817482790e-09); /* 0x3E21EE9E, 0xBDB4B1C4 */
+        static constexpr fp C6 = fp(-1.13596475577881948265e-11); /* 0xBDA8FAE9, 0xBE8838D4 */
+    };
+
+    template <typename fp>
+    constexpr fp __cos(fp x, fp y)
+    {
+        using d = __cos_kernel_data<fp>;
+        fp hz, z, r, w;
+
+        z  = x*x;
+        w  = z*z;
+        r  = z*(d::C1 + z*(d::C2 + z*d::C3)) + w*w*(d::C4 + z*(d::C5 + z*d::C6));
+        hz = fp(0.5)*z;
+        w  = fp(1.0) - hz;
+        return w + (((fp(1.0) - w) - hz) + (z*r - x*y));
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd___cos_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
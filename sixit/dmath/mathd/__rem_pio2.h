@@ -0,0 +1,214 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunSoft, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/* __rem_pio2(x,y)
+ *
+ * return the remainder of x rem pi/2 in y[0]+y[1]
+ * use __rem_pio2_large() for large x
+ *
+ * invpio2:  53 bits of 2/pi
+ * pio2_1:   first  33 bit of pi/2
+ * pio2_1t:  pi/2 - pio2_1
+ * pio2_2:   second 33 bit of pi/2
+ * pio2_2t:  pi/2 - (pio2_1+pio2_2)
+ * pio2_3:   third  33 bit of pi/2
+ * pio2_3t:  pi/2 - (pio2_1+pio2_2+pio2_3)
+ */
+#ifndef sixit_dmath_mathd___rem_pio2_h_included
+#define sixit_dmath_mathd___rem_pio2_h_included
+
+#include "__utils.h"
+#include "__rem_pio2_large.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __rem_pio2_data {
+        static constexpr fp toint   = fp(1.5 / std::numeric_limits<double>::epsilon());
+        static constexpr fp pio4    = fp(0x1.921fb54442d18p-1);
+        static constexpr fp invpio2 = fp(6.36619772367581382433e-01); /* 0x3FE45F30, 0x6DC9C883 */
+        static constexpr fp pio2_1  = fp(1.57079632673412561417e+00); /* 0x3FF921FB, 0x54400000 */
+        static constexpr fp pio2_1t = fp(6.07710050650619224932e-11); /* 0x3DD0B461, 0x1A626331 */
+        static constexpr fp pio2_2  = fp(6.07710050630396597660e-11); /* 0x3DD0B461, 0x1A600000 */
+        static constexpr fp pio2_2t = fp(2.02226624879595063154e-21); /* 0x3BA3198A, 0x2E037073 */
+        static constexpr fp pio2_3  = fp(2.02226624871116645580e-21); /* 0x3BA3198A, 0x2E000000 */
+        static constexpr fp pio2_3t = fp(8.47842766036889956997e-32); /* 0x397B839A, 0x252049C1 */
+    };
+
+    /* caller must handle the case when reduction is not needed: |x| ~<= pi/4 */
+    template <typename fp>
+    constexpr int __rem_pio2(fp x, fp *y)
+    {
+        using d = __rem_pio2_data<fp>;
+        uint64_t ui = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x);
+        fp z, w, t, r, fn;
+        fp tx[3], ty[2];
+        uint32_t ix;
+        int sign, n, ex, ey, i;
+
+        sign = int(ui >> 63);
+        ix = uint32_t(ui >> 32) & 0x7fffffff;
+
+        // small multiples of pi/2 are handled by a single subtraction, except the ones which would
+        // suffer from cancellation; these go to the medium case (`goto medium` in the original code)
+        bool medium = false;
+        if (ix <= 0x400f6a7a) {  /* |x| ~<= 5pi/4 */
+            if ((ix & 0xfffff) == 0x921fb)  /* |x| ~= pi/2 or 2pi/2 */
+                medium = true;  /* cancellation -- use medium case */
+            else {
+                int k = ix <= 0x4002d97c ? 1 : 2;  /* |x| ~<= 3pi/4 */
+                fp kf = __from_int32<fp>(k);
+                if (!sign) {
+                    z = x - kf*d::pio2_1;  /* one round good to 85 bits */
+                    y[0] = z - kf*d::pio2_1t;
+                    y[1] = (z-y[0]) - kf*d::pio2_1t;
+                    return k;
+                } else {
+                    z = x + kf*d::pio2_1;
+                    y[0] = z + kf*d::pio2_1t;
+                    y[1] = (z-y[0]) + kf*d::pio2_1t;
+                    return -k;
+                }
+            }
+        }
+        else if (ix <= 0x401c463b) {  /* |x| ~<= 9pi/4 */
+            int k;
+            if (ix <= 0x4015fdbc) {  /* |x| ~<= 7pi/4 */
+                medium = ix == 0x4012d97c;  /* |x| ~= 3pi/2 */
+                k = 3;
+            } else {
+                medium = ix == 0x401921fb;  /* |x| ~= 4pi/2 */
+                k = 4;
+            }
+            if (!medium) {
+                fp kf = __from_int32<fp>(k);
+                if (!sign) {
+                    z = x - kf*d::pio2_1;
+                    y[0] = z - kf*d::pio2_1t;
+                    y[1] = (z-y[0]) - kf*d::pio2_1t;
+                    return k;
+                } else {
+                    z = x + kf*d::pio2_1;
+                    y[0] = z + kf*d::pio2_1t;
+                    y[1] = (z-y[0]) + kf*d::pio2_1t;
+                    return -k;
+                }
+            }
+        }
+        if (medium || ix < 0x413921fb) {  /* |x| ~< 2^20*(pi/2), medium size */
+            /* rint(x/(pi/2)) */
+            fn = x*d::invpio2 + d::toint - d::toint;
+            n = __to_int32(fn);
+            r = x - fn*d::pio2_1;
+            w = fn*d::pio2_1t;  /* 1st round, good to 85 bits */
+            /* Matters with directed rounding. */
+            if (predict_false(r - w < -d::pio4)) {
+                n--;
+                fn = fn - fp(1.0);
+                r = x - fn*d::pio2_1;
+                w = fn*d::pio2_1t;
+            } else if (predict_false(r - w > d::pio4)) {
+                n++;
+                fn = fn + fp(1.0);
+                r = x - fn*d::pio2_1;
+                w = fn*d::pio2_1t;
+            }
+            y[0] = r - w;
+            ey = int(get_high_word(y[0]) >> 20) & 0x7ff;
+            ex = int(ix >> 20);
+            if (ex - ey > 16) { /* 2nd round, good to 118 bits */
+                t = r;
+                w = fn*d::pio2_2;
+                r = t - w;
+                w = fn*d::pio2_2t - ((t-r)-w);
+                y[0] = r - w;
+                ey = int(get_high_word(y[0]) >> 20) & 0x7ff;
+                if (ex - ey > 49) {  /* 3rd round, good to 151 bits, covers all cases */
+                    t = r;
+                    w = fn*d::pio2_3;
+                    r = t - w;
+                    w = fn*d::pio2_3t - ((t-r)-w);
+                    y[0] = r - w;
+                }
+            }
+            y[1] = (r - y[0]) - w;
+            return n;
+        }
+        /*
+         * all other (large) arguments
+         */
+        if (ix >= 0x7ff00000) {  /* x is inf or NaN */
+            y[0] = y[1] = x - x;
+            return 0;
+        }
+        /* set z = scalbn(|x|,-ilogb(x)+23) */
+        ui &= uint64_t(-1) >> 12;
+        ui |= uint64_t(0x3ff + 23) << 52;
+        z = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint64(ui);
+        for (i=0; i < 2; i++) {
+            tx[i] = __from_int32<fp>(__to_int32(z));
+            z     = (z-tx[i])*fp(0x1p24);
+        }
+        tx[i] = z;
+        /* skip zero terms, first term is non-zero */
+        while (tx[i] == fp(0.0))
+            i--;
+        n = __rem_pio2_large(tx, ty, int(ix>>20)-(0x3ff+23), i+1, 1);
+        if (sign) {
+            y[0] = -ty[0];
+            y[1] = -ty[1];
+            return -n;
+        }
+        y[0] = ty[0];
+        y[1] = ty[1];
+        return n;
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd___rem_pio2_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
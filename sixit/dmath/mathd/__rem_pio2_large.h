@@ -0,0 +1,262 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunSoft, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+* __rem_pio2_large(x,y,e0,nx,prec)
+* double x[],y[]; int e0,nx,prec;
+*
+* Double precision counterpart of mathf/__rem_pio2_large.h, see the detailed description there.
+* Unlike the float version, x[] and y[] keep all the 53 bits, and 2^n scaling is done by exact
+* multiplication (`__scalbn`), so the result is the same as of MUSL's __rem_pio2_large() on every backend.
+*/
+#ifndef sixit_dmath_mathd___rem_pio2_large_h_included
+#define sixit_dmath_mathd___rem_pio2_large_h_included
+
+#include "__utils.h"
+#include "floor.h"
+#include "sixit/dmath/mathf/__rem_pio2_large.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __rem_pio2_large_data {
+        static constexpr int init_jk[] = {3,4,4,6}; /* initial value for jk */
+
+        /* the table of 2/pi is precision-independent, 66 terms are enough for double (e0 <= 1024-23) */
+        static constexpr const int32_t* ipio2 = sixit::dmath::mathf::__rem_pio2_large_data<float>::ipio2;
+
+        static constexpr fp PIo2[] = {
+            fp(1.57079625129699707031e+00), /* 0x3FF921FB, 0x40000000 */
+            fp(7.54978941586159635335e-08), /* 0x3E74442D, 0x00000000 */
+            fp(5.39030252995776476554e-15), /* 0x3CF84698, 0x80000000 */
+            fp(3.28200341580791294123e-22), /* 0x3B78CC51, 0x60000000 */
+            fp(1.27065575308067607349e-29), /* 0x39F01B83, 0x80000000 */
+            fp(1.22933308981111328932e-36), /* 0x387A2520, 0x40000000 */
+            fp(2.73370053816464559624e-44), /* 0x36E38222, 0x80000000 */
+            fp(2.16741683877804819444e-51), /* 0x3569F31D, 0x00000000 */
+        };
+    };
+
+    template <typename fp>
+    constexpr int __rem_pio2_large(fp *x, fp *y, int e0, int nx, int prec)
+    {
+        using d = __rem_pio2_large_data<fp>;
+        int32_t jz,jx,jv,jp,jk,carry,n,iq[20],i,j,k,m,q0,ih;
+        fp z,fw,f[20],q[20];
+        fp fq[20] = {}; // fq[0] is always written (jz >= 0), but the compiler can't prove it for prec 1 and 2
+
+        /* initialize jk*/
+        jk = d::init_jk[prec];
+        jp = jk;
+
+        /* determine jx,jv,q0, note that 3>q0 */
+        jx = nx-1;
+        jv = (e0-3)/24;  if(jv<0) jv=0;
+        q0 = e0-24*(jv+1);
+
+        /* set up f[0] to f[jx+jk] where f[jx+jk] = ipio2[jv+jk] */
+        j = jv-jx; m = jx+jk;
+        for (i=0; i<=m; i++,j++)
+            f[i] = j < 0 ? fp(0.0) : __from_int32<fp>(d::ipio2[j]);
+
+        /* compute q[0],q[1],...q[jk] */
+        for (i=0; i<=jk; i++) {
+            for (j=0,fw=fp(0.0); j<=jx; j++)
+                fw = fw + x[j]*f[jx+i-j];
+            q[i] = fw;
+        }
+
+        jz = jk;
+        while (true)
+        {
+            /* distill q[] into iq[] reversingly */
+            for (i=0,j=jz,z=q[jz]; j>0; i++,j--) {
+                fw    = __from_int32<fp>(__to_int32(fp(0x1p-24)*z));
+                iq[i] = __to_int32(z - fp(0x1p24)*fw);
+                z     = q[j-1]+fw;
+            }
+
+            /* compute n */
+            z  = __scalbn(z,q0);       /* actual value of z */
+            z  = z - fp(8.0)*floor(z*fp(0.125)); /* trim off integer >= 8 */
+            n  = __to_int32(z);
+            z  = z - __from_int32<fp>(n);
+            ih = 0;
+            if (q0 > 0) {  /* need iq[jz-1] to determine n */
+                i  = iq[jz-1]>>(24-q0); n += i;
+                iq[jz-1] -= i<<(24-q0);
+                ih = iq[jz-1]>>(23-q0);
+            }
+            else if (q0 == 0) ih = iq[jz-1]>>23;
+            else if (z >= fp(0.5)) ih = 2;
+
+            if (ih > 0) {  /* q > 0.5 */
+                n += 1; carry = 0;
+                for (i=0; i<jz; i++) {  /* compute 1-q */
+                    j = iq[i];
+                    if (carry == 0) {
+                        if (j != 0) {
+                            carry = 1;
+                            iq[i] = 0x1000000 - j;
+                        }
+                    } else
+                        iq[i] = 0xffffff - j;
+                }
+                if (q0 > 0) {  /* rare case: chance is 1 in 12 */
+                    switch(q0) {
+                    case 1:
+                        iq[jz-1] &= 0x7fffff; break;
+                    case 2:
+                        iq[jz-1] &= 0x3fffff; break;
+                    }
+                }
+                if (ih == 2) {
+                    z = fp(1.0) - z;
+                    if (carry != 0)
+                        z = z - __scalbn(fp(1.0),q0);
+                }
+            }
+
+            /* check if recomputation is needed */
+            if (z == fp(0.0)) {
+                j = 0;
+                for (i=jz-1; i>=jk; i--) j |= iq[i];
+                if (j == 0) {  /* need recomputation */
+                    for (k=1; iq[jk-k]==0; k++);  /* k = no. of terms needed */
+
+                    for (i=jz+1; i<=jz+k; i++) {  /* add q[jz+1] to q[jz+k] */
+                        f[jx+i] = __from_int32<fp>(d::ipio2[jv+i]);
+                        for (j=0,fw=fp(0.0); j<=jx; j++)
+                            fw = fw + x[j]*f[jx+i-j];
+                        q[i] = fw;
+                    }
+                    jz += k;
+                    continue;
+                }
+            }
+            break;
+        }
+
+        /* chop off zero terms */
+        if (z == fp(0.0)) {
+            jz -= 1;
+            q0 -= 24;
+            while (iq[jz] == 0) {
+                jz--;
+                q0 -= 24;
+            }
+        } else { /* break z into 24-bit if necessary */
+            z = __scalbn(z,-q0);
+            if (z >= fp(0x1p24)) {
+                fw = __from_int32<fp>(__to_int32(fp(0x1p-24)*z));
+                iq[jz] = __to_int32(z - fp(0x1p24)*fw);
+                jz += 1;
+                q0 += 24;
+                iq[jz] = __to_int32(fw);
+            } else
+                iq[jz] = __to_int32(z);
+        }
+
+        /* convert integer "bit" chunk to floating-point value */
+        fw = __scalbn(fp(1.0),q0);
+        for (i=jz; i>=0; i--) {
+            q[i] = fw*__from_int32<fp>(iq[i]);
+            fw = fw*fp(0x1p-24);
+        }
+
+        /* compute PIo2[0,...,jp]*q[jz,...,0] */
+        for(i=jz; i>=0; i--) {
+            for (fw=fp(0.0),k=0; k<=jp && k<=jz-i; k++)
+                fw = fw + d::PIo2[k]*q[i+k];
+            fq[jz-i] = fw;
+        }
+
+        /* compress fq[] into y[] */
+        switch(prec) {
+        case 0:
+            fw = fp(0.0);
+            for (i=jz; i>=0; i--)
+                fw = fw + fq[i];
+            y[0] = ih==0 ? fw : -fw;
+            break;
+        case 1:
+        case 2:
+            fw = fp(0.0);
+            for (i=jz; i>=0; i--)
+                fw = fw + fq[i];
+            y[0] = ih==0 ? fw : -fw;
+            fw = fq[0]-fw;
+            for (i=1; i<=jz; i++)
+                fw = fw + fq[i];
+            y[1] = ih==0 ? fw : -fw;
+            break;
+        case 3:  /* painful */
+            for (i=jz; i>0; i--) {
+                fw      = fq[i-1]+fq[i];
+                fq[i]   = fq[i] + (fq[i-1]-fw);
+                fq[i-1] = fw;
+            }
+            for (i=jz; i>1; i--) {
+                fw      = fq[i-1]+fq[i];
+                fq[i]   = fq[i] + (fq[i-1]-fw);
+                fq[i-1] = fw;
+            }
+            for (fw=fp(0.0),i=jz; i>=2; i--)
+                fw = fw + fq[i];
+            if (ih==0) {
+                y[0] =  fq[0]; y[1] =  fq[1]; y[2] =  fw;
+            } else {
+                y[0] = -fq[0]; y[1] = -fq[1]; y[2] = -fw;
+            }
+        }
+        return n&7;
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd___rem_pio2_large_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathd___sin_h_included
+#define sixit_dmath_mathd___sin_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    /* __sin( x, y, iy)
+     * kernel sin function on ~[-pi/4, pi/4] (except on -0), pi/4 ~ 0.7854
+     * Input x is assumed to be bounded by ~pi/4 in magnitude.
+     * Input y is the tail of x.
+     * Input iy indicates whether y is 0. (if iy=0, y assume to be 0).
+     */
+    template <typename fp>
+    struct __sin_kernel_data
+    {
+        static constexpr fp S1 = fp(-1.66666666666666324348e-01); /* 0xBFC55555, 0x55555549 */
+        static constexpr fp S2 = fp( 8.33333333332248946124e-03); /* 0x3F811111, 0x1110F8A6 */
+        static constexpr fp S3 = fp(-1.98412698298579493134e-04); /* 0xBF2A01A0, 0x19C161D5 */
+        static constexpr fp S4 = fp( 2.75573137070700676789e-06); /* 0x3EC71DE3, 0x57B1FE7D */
+        static constexpr fp S5 = fp(-2.50507602534068634195e-08); /* 0xBE5AE5E6, 0x8A2B9CEB */
+        static constexpr fp S6 = fp( 1.58969099521155010221e-10); /* 0x3DE5D93A, 0x5ACFD57C */
+    };
+
+    template <typename fp>
+    constexpr fp __sin(fp x, fp y, int iy)
+    {
+        using d = __sin_kernel_data<fp>;
+        fp z, r, v, w;
+
+        z = x*x;
+        w = z*z;
+        r = d::S2 + z*(d::S3 + z*d::S4) + z*w*(d::S5 + z*d::S6);
+        v = z*x;
+        if (iy == 0)
+            return x + v*(d::S1 + z*r);
+        else
+            return x - ((z*(fp(0.5)*y - v*r) - y) - v*d::S1);
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd___sin_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathd___tan_h_included
+#define sixit_dmath_mathd___tan_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    /* __tan( x, y, k )
+     * kernel tan function on ~[-pi/4, pi/4] (except on -0), pi/4 ~ 0.7854
+     * Input x is assumed to be bounded by ~pi/4 in magnitude.
+     * Input y is the tail of x.
+     * Input odd indicates whether tan (if odd = 0) or -1/tan (if odd = 1) is returned.
+     */
+    template <typename fp>
+    struct __tan_kernel_data
+    {
+        static constexpr fp T[] = {
+            fp( 3.33333333333334091986e-01), /* 3FD55555, 55555563 */
+            fp( 1.33333333333201242699e-01), /* 3FC11111, 1110FE7A */
+            fp( 5.39682539762260521377e-02), /* 3FABA1BA, 1BB341FE */
+            fp( 2.18694882948595424599e-02), /* 3F9664F4, 8406D637 */
+            fp( 8.86323982359930005737e-03), /* 3F8226E3, E96E8493 */
+            fp( 3.59207910759131235356e-03), /* 3F6D6D22, C9560328 */
+            fp( 1.45620945432529025516e-03), /* 3F57DBC8, FEE08315 */
+            fp( 5.88041240820264096874e-04), /* 3F4344D8, F2F26501 */
+            fp( 2.46463134818469906812e-04), /* 3F3026F7, 1A8D1068 */
+            fp( 7.81794442939557092300e-05), /* 3F147E88, A03792A6 */
+            fp( 7.14072491382608190305e-05), /* 3F12B80F, 32F0A7E9 */
+            fp(-1.85586374855275456654e-05), /* BEF375CB, DB605373 */
+            fp( 2.59073051863633712884e-05), /* 3EFB2A70, 74BF7AD4 */
+        };
+        static constexpr fp pio4   = fp(7.85398163397448278999e-01); /* 3FE921FB, 54442D18 */
+        static constexpr fp pio4lo = fp(3.06161699786838301793e-17); /* 3C81A626, 33145C07 */
+    };
+
+    template <typename fp>
+    constexpr fp __tan(fp x, fp y, int odd)
+    {
+        using d = __tan_kernel_data<fp>;
+        fp z, r, v, w, s, a;
+        fp w0, a0;
+        uint32_t hx;
+        bool big;
+        int sign = 0;
+
+        hx = get_high_word(x);
+        big = (hx&0x7fffffff) >= 0x3FE59428; /* |x| >= 0.6744 */
+        if (big) {
+            sign = hx>>31;
+            if (sign) {
+                x = -x;
+                y = -y;
+            }
+            x = (d::pio4 - x) + (d::pio4lo - y);
+            y = fp(0.0);
+        }
+        z = x * x;
+        w = z * z;
+        r = d::T[1] + w*(d::T[3] + w*(d::T[5] + w*(d::T[7] + w*(d::T[9] + w*d::T[11]))));
+        v = z*(d::T[2] + w*(d::T[4] + w*(d::T[6] + w*(d::T[8] + w*(d::T[10] + w*d::T[12])))));
+        s = z * x;
+        r = y + z*(s*(r + v) + y) + s*d::T[0];
+        w = x + r;
+        if (big) {
+            s = __from_int32<fp>(1 - 2*odd);
+            v = s - fp(2.0) * (x + (r - w*w/(w + s)));
+            return sign ? -v : v;
+        }
+        if (!odd)
+            return w;
+        /* -1.0/(x+r) has up to 2ulp error, so compute it accurately */
+        w0 = w;
+        set_low_word(w0, 0);
+        v = r - (w0 - x);       /* w0+v = r+x */
+        a = fp(-1.0) / w;
+        a0 = a;
+        set_low_word(a0, 0);
+        return a0 + a*(fp(1.0) + a0*w0 + a0*v);
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd___tan_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
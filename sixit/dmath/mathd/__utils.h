@@ -0,0 +1,136 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathd___utils_h_included
+#define sixit_dmath_mathd___utils_h_included
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "sixit/dmath/traits.h"
+#include "sixit/dmath/mathf/__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    using sixit::dmath::mathf::eval_as_fp;
+    using sixit::dmath::mathf::force_eval_fp;
+
+    // GET_HIGH_WORD/GET_LOW_WORD/INSERT_WORDS/SET_HIGH_WORD/SET_LOW_WORD of MUSL, on top of fp_traits<fp>
+
+    template <typename fp>
+    constexpr uint32_t get_high_word(fp x)
+    {
+        return uint32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x) >> 32);
+    }
+
+    template <typename fp>
+    constexpr uint32_t get_low_word(fp x)
+    {
+        return uint32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x));
+    }
+
+    template <typename fp>
+    constexpr fp insert_words(uint32_t hi, uint32_t lo)
+    {
+        return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint64(uint64_t(hi) << 32 | lo);
+    }
+
+    template <typename fp>
+    constexpr void set_high_word(fp& x, uint32_t hi)
+    {
+        x = insert_words<fp>(hi, get_low_word(x));
+    }
+
+    template <typename fp>
+    constexpr void set_low_word(fp& x, uint32_t lo)
+    {
+        x = insert_words<fp>(get_high_word(x), lo);
+    }
+
+    template <typename fp>
+    constexpr fp __fabs(fp x)
+    {
+        uint64_t bits = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x);
+        return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint64(bits & UINT64_C(0x7fff'ffff'ffff'ffff));
+    }
+
+    // x * 2^n; multiplications by exact powers of 2 only, so it is deterministic on every backend
+    template <typename fp>
+    constexpr fp __scalbn(fp x, int n)
+    {
+        fp y = x;
+
+        if (n > 1023) {
+            y = y * fp(0x1p1023);
+            n -= 1023;
+            if (n > 1023) {
+                y = y * fp(0x1p1023);
+                n -= 1023;
+                if (n > 1023)
+                    n = 1023;
+            }
+        } else if (n < -1022) {
+            /* make sure final n < -53 to avoid double
+               rounding in the subnormal range */
+            y = y * fp(0x1p-1022 * 0x1p53);
+            n += 1022 - 53;
+            if (n < -1022) {
+                y = y * fp(0x1p-1022 * 0x1p53);
+                n += 1022 - 53;
+                if (n < -1022)
+                    n = -1022;
+            }
+        }
+        return y * sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint64(uint64_t(0x3ff + n) << 52);
+    }
+
+    template <typename fp>
+    constexpr int32_t __to_int32(fp x)
+    {
+        return int32_t(sixit::dmath::fp_traits<fp>::fp2int64(x));
+    }
+
+    template <typename fp>
+    constexpr fp __from_int32(int32_t i)
+    {
+        // exact: any int32_t fits into 53 bits of mantissa
+        return fp(double(i));
+    }
+} // namespace sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd___utils_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
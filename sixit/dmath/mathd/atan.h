@@ -0,0 +1,181 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/* atan(x)
+ * Method
+ *   1. Reduce x to positive by atan(x) = -atan(-x).
+ *   2. According to the integer k=4t+0.25 chopped, t=x, the argument
+ *      is further reduced to one of the following intervals and the
+ *      arctangent of t is evaluated by the corresponding formula:
+ *
+ *      [0,7/16]      atan(x) = t-t^3*(a1+t^2*(a2+...(a10+t^2*a11)...)
+ *      [7/16,11/16]  atan(x) = atan(1/2) + atan( (t-0.5)/(1+t/2) )
+ *      [11/16.19/16] atan(x) = atan( 1 ) + atan( (t-1)/(1+t) )
+ *      [19/16,39/16] atan(x) = atan(3/2) + atan( (t-1.5)/(1+1.5t) )
+ *      [39/16,INF]   atan(x) = atan(INF) + atan( -1/t )
+ */
+#ifndef sixit_dmath_mathd_atan_h_included
+#define sixit_dmath_mathd_atan_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __atan_data
+    {
+        static constexpr fp atanhi[] = {
+            fp(4.63647609000806093515e-01), /* atan(0.5)hi 0x3FDDAC67, 0x0561BB4F */
+            fp(7.85398163397448278999e-01), /* atan(1.0)hi 0x3FE921FB, 0x54442D18 */
+            fp(9.82793723247329054082e-01), /* atan(1.5)hi 0x3FEF730B, 0xD281F69B */
+            fp(1.57079632679489655800e+00), /* atan(inf)hi 0x3FF921FB, 0x54442D18 */
+        };
+
+        static constexpr fp atanlo[] = {
+            fp(2.26987774529616870924e-17), /* atan(0.5)lo 0x3C7A2B7F, 0x222F65E2 */
+            fp(3.06161699786838301793e-17), /* atan(1.0)lo 0x3C81A626, 0x33145C07 */
+            fp(1.39033110312309984516e-17), /* atan(1.5)lo 0x3C700788, 0x7AF0CBBD */
+            fp(6.12323399573676603587e-17), /* atan(inf)lo 0x3C91A626, 0x33145C07 */
+        };
+
+        static constexpr fp aT[] = {
+            fp( 3.33333333333329318027e-01), /* 0x3FD55555, 0x5555550D */
+            fp(-1.99999999998764832476e-01), /* 0xBFC99999, 0x9998EBC4 */
+            fp( 1.42857142725034663711e-01), /* 0x3FC24924, 0x920083FF */
+            fp(-1.11111104054623557880e-01), /* 0xBFBC71C6, 0xFE231671 */
+            fp( 9.09088713343650656196e-02), /* 0x3FB745CD, 0xC54C206E */
+            fp(-7.69187620504482999495e-02), /* 0xBFB3B0F2, 0xAF749A6D */
+            fp( 6.66107313738753120669e-02), /* 0x3FB10D66, 0xA0D03D51 */
+            fp(-5.83357013379057348645e-02), /* 0xBFADDE2D, 0x52DEFD9A */
+            fp( 4.97687799461593236017e-02), /* 0x3FA97B4B, 0x24760DEB */
+            fp(-3.65315727442169155270e-02), /* 0xBFA2B444, 0x2C6A6C2F */
+            fp( 1.62858201153657823623e-02), /* 0x3F90AD3A, 0xE322DA11 */
+        };
+    };
+
+    template <typename fp>
+    constexpr fp _atan(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<double, fp>) {
+            return std::atan(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __atan_data<fp>;
+            fp w, s1, s2, z;
+            uint32_t ix, sign;
+            int id;
+
+            ix = get_high_word(x);
+            sign = ix >> 31;
+            ix &= 0x7fffffff;
+            if (ix >= 0x44100000) {   /* if |x| >= 2^66 */
+                if (sixit::dmath::fp_traits<fp>::isnan(x))
+                    return x;
+                z = d::atanhi[3] + fp(0x1p-120);
+                return sign ? -z : z;
+            }
+            if (ix < 0x3fdc0000) {    /* |x| < 0.4375 */
+                if (ix < 0x3e400000) {  /* |x| < 2^-27 */
+                    /* raise underflow for subnormal x */
+                    if constexpr (std::is_same_v<fp, double>)
+                        if (ix < 0x00100000)
+                            force_eval_fp((float)x);
+                    return x;
+                }
+                id = -1;
+            } else {
+                x = __fabs(x);
+                if (ix < 0x3ff30000) {  /* |x| < 1.1875 */
+                    if (ix < 0x3fe60000) {  /*  7/16 <= |x| < 11/16 */
+                        id = 0;
+                        x = (fp(2.0)*x - fp(1.0))/(fp(2.0) + x);
+                    } else {                /* 11/16 <= |x| < 19/16 */
+                        id = 1;
+                        x = (x - fp(1.0))/(x + fp(1.0));
+                    }
+                } else {
+                    if (ix < 0x40038000) {  /* |x| < 2.4375 */
+                        id = 2;
+                        x = (x - fp(1.5))/(fp(1.0) + fp(1.5)*x);
+                    } else {                /* 2.4375 <= |x| < 2^66 */
+                        id = 3;
+                        x = fp(-1.0)/x;
+                    }
+                }
+            }
+            /* end of argument reduction */
+            z = x*x;
+            w = z*z;
+            /* break sum from i=0 to 10 aT[i]z**(i+1) into odd and even poly */
+            s1 = z*(d::aT[0] + w*(d::aT[2] + w*(d::aT[4] + w*(d::aT[6] + w*(d::aT[8] + w*d::aT[10])))));
+            s2 = w*(d::aT[1] + w*(d::aT[3] + w*(d::aT[5] + w*(d::aT[7] + w*d::aT[9]))));
+            if (id < 0)
+                return x - x*(s1 + s2);
+            z = d::atanhi[id] - (x*(s1 + s2) - d::atanlo[id] - x);
+            return sign ? -z : z;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto atan(fp x)
+    {
+        return _atan(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> atan(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ atan<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_atan_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
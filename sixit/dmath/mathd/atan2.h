@@ -0,0 +1,159 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/* atan2(y,x)
+ * Method :
+ *      1. Reduce y to positive by atan2(y,x)=-atan2(-y,x).
+ *      2. Reduce x to positive by (if x and y are unexceptional):
+ *              ARG (x+iy) = arctan(y/x)           ... if x > 0,
+ *              ARG (x+iy) = pi - arctan[y/(-x)]   ... if x < 0,
+ */
+#ifndef sixit_dmath_mathd_atan2_h_included
+#define sixit_dmath_mathd_atan2_h_included
+
+#include "__utils.h"
+#include "atan.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __atan2_data {
+        static constexpr fp pi     = fp(3.1415926535897931160E+00); /* 0x400921FB, 0x54442D18 */
+        static constexpr fp pi_lo  = fp(1.2246467991473531772E-16); /* 0x3CA1A626, 0x33145C07 */
+    };
+
+    template <typename fp>
+    constexpr fp _atan2(fp y, fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<double, fp>) {
+            return std::atan2(y, x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __atan2_data<fp>;
+            fp z;
+            uint32_t m, lx, ly, ix, iy;
+
+            if (sixit::dmath::fp_traits<fp>::isnan(x) ||
+                sixit::dmath::fp_traits<fp>::isnan(y))
+                return x + y;
+            ix = get_high_word(x);
+            lx = get_low_word(x);
+            iy = get_high_word(y);
+            ly = get_low_word(y);
+            if (((ix - 0x3ff00000) | lx) == 0)  /* x = 1.0 */
+                return atan(y);
+            m = ((iy>>31)&1) | ((ix>>30)&2);  /* 2*sign(x)+sign(y) */
+            ix = ix & 0x7fffffff;
+            iy = iy & 0x7fffffff;
+
+            /* when y = 0 */
+            if ((iy|ly) == 0) {
+                switch (m) {
+                case 0:
+                case 1: return y;   /* atan(+-0,+anything)=+-0 */
+                case 2: return  d::pi; /* atan(+0,-anything) = pi */
+                case 3: return -d::pi; /* atan(-0,-anything) =-pi */
+                }
+            }
+            /* when x = 0 */
+            if ((ix|lx) == 0)
+                return m&1 ? -d::pi/fp(2.0) : d::pi/fp(2.0);
+            /* when x is INF */
+            if (ix == 0x7ff00000) {
+                if (iy == 0x7ff00000) {
+                    switch (m) {
+                    case 0: return  d::pi/fp(4.0);   /* atan(+INF,+INF) */
+                    case 1: return -d::pi/fp(4.0);   /* atan(-INF,+INF) */
+                    case 2: return  fp(3.0)*d::pi/fp(4.0); /* atan(+INF,-INF) */
+                    case 3: return fp(-3.0)*d::pi/fp(4.0); /* atan(-INF,-INF) */
+                    }
+                } else {
+                    switch (m) {
+                    case 0: return fp(0.0);  /* atan(+...,+INF) */
+                    case 1: return fp(-0.0); /* atan(-...,+INF) */
+                    case 2: return  d::pi;   /* atan(+...,-INF) */
+                    case 3: return -d::pi;   /* atan(-...,-INF) */
+                    }
+                }
+            }
+            /* |y/x| > 0x1p64 */
+            if (ix + (64<<20) < iy || iy == 0x7ff00000)
+                return m&1 ? -d::pi/fp(2.0) : d::pi/fp(2.0);
+
+            /* z = atan(|y/x|) without spurious underflow */
+            if ((m&2) && iy + (64<<20) < ix)  /* |y/x| < 0x1p-64, x<0 */
+                z = fp(0.0);
+            else
+                z = atan(__fabs(y/x));
+            switch (m) {
+            case 0: return z;              /* atan(+,+) */
+            case 1: return -z;             /* atan(-,+) */
+            case 2: return d::pi - (z - d::pi_lo); /* atan(+,-) */
+            default: /* case 3 */
+                return (z - d::pi_lo) - d::pi; /* atan(-,-) */
+            }
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto atan2(fp y, fp x)
+    {
+        return _atan2(sixit::dmath::fp_traits<fp>::to_fallback(y), sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_ / dim_> atan2(sixit::units::dimensional_scalar<fp, dim_> a, sixit::units::dimensional_scalar<fp, dim_> b)
+    {
+        return sixit::units::dimensional_scalar<fp, dim_ / dim_>({ atan2<fp>(a.value, b.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_atan2_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
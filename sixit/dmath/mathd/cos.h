@@ -0,0 +1,118 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathd_cos_h_included
+#define sixit_dmath_mathd_cos_h_included
+
+#include "__utils.h"
+#include "__sin.h"
+#include "__cos.h"
+#include "__rem_pio2.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    constexpr fp _cos(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<double, fp>)
+        {
+            return std::cos(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            fp y[2];
+            uint32_t ix;
+            unsigned n;
+
+            ix = get_high_word(x);
+            ix &= 0x7fffffff;
+
+            /* |x| ~< pi/4 */
+            if (ix <= 0x3fe921fb) {
+                if (ix < 0x3e46a09e) {  /* |x| < 2**-27 * sqrt(2) */
+                    /* raise inexact if x!=0 */
+                    if constexpr (std::is_same_v<fp, double>)
+                        force_eval_fp(x + 0x1p120f);
+                    return fp(1.0);
+                }
+                return __cos(x, fp(0.0));
+            }
+
+            /* cos(Inf or NaN) is NaN */
+            if (ix >= 0x7ff00000)
+                return x - x;
+
+            /* argument reduction */
+            n = unsigned(__rem_pio2(x, y));
+            switch (n&3) {
+            case 0: return  __cos(y[0], y[1]);
+            case 1: return -__sin(y[0], y[1], 1);
+            case 2: return -__cos(y[0], y[1]);
+            default:
+                return  __sin(y[0], y[1], 1);
+            }
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto cos(fp x)
+    {
+        return _cos(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> cos(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ cos<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_cos_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
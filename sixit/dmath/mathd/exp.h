@@ -0,0 +1,175 @@
+/*
+ * ====================================================
+ * Copyright (C) 2004 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunSoft, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/* exp(x)
+ * Returns the exponential of x.
+ *
+ * Method
+ *   1. Argument reduction:
+ *      Reduce x to an r so that |r| <= 0.5*ln2 ~ 0.34658.
+ *      Given x, find r and integer k such that
+ *
+ *               x = k*ln2 + r,  |r| <= 0.5*ln2.
+ *
+ *      Here r will be represented as r = hi-lo for better
+ *      accuracy.
+ *
+ *   2. Approximation of exp(r) by a special rational function on
+ *      the interval [0,0.34658]; see the original fdlibm e_exp.c for details.
+ *
+ *   3. Scale back to obtain exp(x):
+ *      From step 1, we have
+ *         exp(x) = 2^k * exp(r)
+ *
+ * Table-free fdlibm version (as used by MUSL before 1.1.20): all the operations are
+ * basic arithmetic on fp, so the result is the same on every deterministic backend.
+ */
+#ifndef sixit_dmath_mathd_exp_h_included
+#define sixit_dmath_mathd_exp_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __exp_data
+    {
+        static constexpr fp half[2] = {fp(0.5), fp(-0.5)};
+        static constexpr fp ln2hi  = fp(6.93147180369123816490e-01); /* 0x3fe62e42, 0xfee00000 */
+        static constexpr fp ln2lo  = fp(1.90821492927058770002e-10); /* 0x3dea39ef, 0x35793c76 */
+        static constexpr fp invln2 = fp(1.44269504088896338700e+00); /* 0x3ff71547, 0x652b82fe */
+        static constexpr fp P1 = fp( 1.66666666666666019037e-01); /* 0x3FC55555, 0x5555553E */
+        static constexpr fp P2 = fp(-2.77777777770155933842e-03); /* 0xBF66C16C, 0x16BEBD93 */
+        static constexpr fp P3 = fp( 6.61375632143793436117e-05); /* 0x3F11566A, 0xAF25DE2C */
+        static constexpr fp P4 = fp(-1.65339022054652515390e-06); /* 0xBEBBBD41, 0xC5D26BF1 */
+        static constexpr fp P5 = fp( 4.13813679705723846039e-08); /* 0x3E663769, 0x72BEA4D0 */
+    };
+
+    template <typename fp>
+    constexpr fp _exp(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<double, fp>) {
+            return std::exp(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __exp_data<fp>;
+            fp hi, lo, c, xx, y;
+            int k, sign;
+            uint32_t hx;
+
+            hx = get_high_word(x);
+            sign = hx>>31;
+            hx &= 0x7fffffff;  /* high word of |x| */
+
+            /* special cases */
+            if (hx >= 0x4086232b) {  /* if |x| >= 708.39... */
+                if (sixit::dmath::fp_traits<fp>::isnan(x))
+                    return x;
+                if (x > fp(709.782712893383973096)) {
+                    /* overflow if x!=inf */
+                    x = x * fp(0x1p1023);
+                    return x;
+                }
+                if (x < fp(-708.39641853226410622)) {
+                    /* underflow if x!=-inf */
+                    if constexpr (std::is_same_v<fp, double>)
+                        force_eval_fp((float)(-0x1p-149/x));
+                    if (x < fp(-745.13321910194110842))
+                        return fp(0.0);
+                }
+            }
+
+            /* argument reduction */
+            if (hx > 0x3fd62e42) {  /* if |x| > 0.5 ln2 */
+                if (hx >= 0x3ff0a2b2)  /* if |x| >= 1.5 ln2 */
+                    k = __to_int32(d::invln2*x + d::half[sign]);
+                else
+                    k = 1 - sign - sign;
+                fp kf = __from_int32<fp>(k);
+                hi = x - kf*d::ln2hi;  /* k*ln2hi is exact here */
+                lo = kf*d::ln2lo;
+                x = hi - lo;
+            } else if (hx > 0x3e300000)  {  /* if |x| > 2**-28 */
+                k = 0;
+                hi = x;
+                lo = fp(0.0);
+            } else {
+                /* inexact if x!=0 */
+                if constexpr (std::is_same_v<fp, double>)
+                    force_eval_fp(0x1p1023 + x);
+                return fp(1.0) + x;
+            }
+
+            /* x is now in primary range */
+            xx = x*x;
+            c = x - xx*(d::P1 + xx*(d::P2 + xx*(d::P3 + xx*(d::P4 + xx*d::P5))));
+            y = fp(1.0) + (x*c/(fp(2.0) - c) - lo + hi);
+            if (k == 0)
+                return y;
+            return __scalbn(y, k);
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto exp(fp x)
+    {
+        return _exp(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> exp(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ exp<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_exp_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/* log(x)
+ * Return the logarithm of x
+ *
+ * Method :
+ *   1. Argument Reduction: find k and f such that
+ *                      x = 2^k * (1+f),
+ *         where  sqrt(2)/2 < 1+f < sqrt(2) .
+ *
+ *   2. Approximation of log(1+f): see the original fdlibm e_log.c for details.
+ *
+ *   3. Finally,  log(x) = k*ln2 + log(1+f).
+ *                       = k*ln2_hi+(f-(hfsq-(s*(hfsq+R)+k*ln2_lo)))
+ *
+ * Table-free fdlibm version (as used by MUSL before 1.1.20).
+ */
+#ifndef sixit_dmath_mathd_log_h_included
+#define sixit_dmath_mathd_log_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __log_data
+    {
+        static constexpr fp ln2_hi = fp(6.93147180369123816490e-01); /* 3fe62e42 fee00000 */
+        static constexpr fp ln2_lo = fp(1.90821492927058770002e-10); /* 3dea39ef 35793c76 */
+        static constexpr fp Lg1 = fp(6.666666666666735130e-01);  /* 3FE55555 55555593 */
+        static constexpr fp Lg2 = fp(3.999999999940941908e-01);  /* 3FD99999 9997FA04 */
+        static constexpr fp Lg3 = fp(2.857142874366239149e-01);  /* 3FD24924 94229359 */
+        static constexpr fp Lg4 = fp(2.222219843214978396e-01);  /* 3FCC71C5 1D8E78AF */
+        static constexpr fp Lg5 = fp(1.818357216161805012e-01);  /* 3FC74664 96CB03DE */
+        static constexpr fp Lg6 = fp(1.531383769920937332e-01);  /* 3FC39A09 D078C69F */
+        static constexpr fp Lg7 = fp(1.479819860511658591e-01);  /* 3FC2F112 DF3E5244 */
+    };
+
+    template <typename fp>
+    constexpr fp _log(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<double, fp>) {
+            return std::log(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __log_data<fp>;
+            uint64_t ui = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x);
+            fp hfsq, f, s, z, R, w, t1, t2, dk;
+            uint32_t hx;
+            int k;
+
+            hx = uint32_t(ui>>32);
+            k = 0;
+            if (hx < 0x00100000 || hx>>31) {
+                if (ui<<1 == 0)
+                    return fp(-1.0)/(x*x);  /* log(+-0)=-inf */
+                if (hx>>31)
+                    return (x-x)/fp(0.0); /* log(-#) = NaN */
+                /* subnormal number, scale x up */
+                k -= 54;
+                x = x * fp(0x1p54);
+                ui = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x);
+                hx = uint32_t(ui>>32);
+            } else if (hx >= 0x7ff00000) {
+                return x;
+            } else if (hx == 0x3ff00000 && ui<<32 == 0)
+                return fp(0.0);
+
+            /* reduce x into [sqrt(2)/2, sqrt(2)] */
+            hx += 0x3ff00000 - 0x3fe6a09e;
+            k += int(hx>>20) - 0x3ff;
+            hx = (hx&0x000fffff) + 0x3fe6a09e;
+            ui = uint64_t(hx)<<32 | (ui&0xffffffff);
+            x = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint64(ui);
+
+            f = x - fp(1.0);
+            hfsq = fp(0.5)*f*f;
+            s = f/(fp(2.0) + f);
+            z = s*s;
+            w = z*z;
+            t1 = w*(d::Lg2 + w*(d::Lg4 + w*d::Lg6));
+            t2 = z*(d::Lg1 + w*(d::Lg3 + w*(d::Lg5 + w*d::Lg7)));
+            R = t2 + t1;
+            dk = __from_int32<fp>(k);
+            return s*(hfsq + R) + dk*d::ln2_lo - hfsq + f + dk*d::ln2_hi;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto log(fp x)
+    {
+        return _log(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> log(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ log<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_log_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
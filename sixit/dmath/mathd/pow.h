@@ -0,0 +1,353 @@
+/*
+ * ====================================================
+ * Copyright (C) 2004 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/* pow(x,y) return x**y
+ *
+ *                    n
+ * Method:  Let x =  2   * (1+f)
+ *      1. Compute and return log2(x) in two pieces:
+ *              log2(x) = w1 + w2,
+ *         where w1 has 53-24 = 29 bit trailing zeros.
+ *      2. Perform y*log2(x) = n+y' by simulating muti-precision
+ *         arithmetic, where |y'|<=0.5.
+ *      3. Return x**y = 2**n*exp(y'*log2)
+ *
+ * Special cases are the same as in C99 (see the original fdlibm e_pow.c).
+ *
+ * Table-free fdlibm version (as used by MUSL before 1.1.20): all the operations are
+ * basic arithmetic on fp and bit manipulations, so the result is the same on every deterministic backend.
+ */
+#ifndef sixit_dmath_mathd_pow_h_included
+#define sixit_dmath_mathd_pow_h_included
+
+#include "__utils.h"
+#include "sqrt.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    struct __pow_data
+    {
+        static constexpr fp bp[]   = {fp(1.0), fp(1.5),};
+        static constexpr fp dp_h[] = {fp(0.0), fp(5.84962487220764160156e-01),}; /* 0x3FE2B803, 0x40000000 */
+        static constexpr fp dp_l[] = {fp(0.0), fp(1.35003920212974897128e-08),}; /* 0x3E4CFDEB, 0x43CFD006 */
+        static constexpr fp two53  = fp(9007199254740992.0); /* 0x43400000, 0x00000000 */
+        static constexpr fp huge   = fp(1.0e300);
+        static constexpr fp tiny   = fp(1.0e-300);
+        /* poly coefs for (3/2)*(log(x)-2s-2/3*s**3 */
+        static constexpr fp L1 = fp(5.99999999999994648725e-01); /* 0x3FE33333, 0x33333303 */
+        static constexpr fp L2 = fp(4.28571428578550184252e-01); /* 0x3FDB6DB6, 0xDB6FABFF */
+        static constexpr fp L3 = fp(3.33333329818377432918e-01); /* 0x3FD55555, 0x518F264D */
+        static constexpr fp L4 = fp(2.72728123808534006489e-01); /* 0x3FD17460, 0xA91D4101 */
+        static constexpr fp L5 = fp(2.30660745775561754067e-01); /* 0x3FCD864A, 0x93C9DB65 */
+        static constexpr fp L6 = fp(2.06975017800338417784e-01); /* 0x3FCA7E28, 0x4A454EEF */
+        static constexpr fp P1 = fp( 1.66666666666666019037e-01); /* 0x3FC55555, 0x5555553E */
+        static constexpr fp P2 = fp(-2.77777777770155933842e-03); /* 0xBF66C16C, 0x16BEBD93 */
+        static constexpr fp P3 = fp( 6.61375632143793436117e-05); /* 0x3F11566A, 0xAF25DE2C */
+        static constexpr fp P4 = fp(-1.65339022054652515390e-06); /* 0xBEBBBD41, 0xC5D26BF1 */
+        static constexpr fp P5 = fp( 4.13813679705723846039e-08); /* 0x3E663769, 0x72BEA4D0 */
+        static constexpr fp lg2     = fp( 6.93147180559945286227e-01); /* 0x3FE62E42, 0xFEFA39EF */
+        static constexpr fp lg2_h   = fp( 6.93147182464599609375e-01); /* 0x3FE62E43, 0x00000000 */
+        static constexpr fp lg2_l   = fp(-1.90465429995776804525e-09); /* 0xBE205C61, 0x0CA86C39 */
+        static constexpr fp ovt     = fp( 8.0085662595372944372e-017); /* -(1024-log2(ovfl+.5ulp)) */
+        static constexpr fp cp      = fp( 9.61796693925975554329e-01); /* 0x3FEEC709, 0xDC3A03FD =2/(3ln2) */
+        static constexpr fp cp_h    = fp( 9.61796700954437255859e-01); /* 0x3FEEC709, 0xE0000000 =(float)cp */
+        static constexpr fp cp_l    = fp(-7.02846165095275826516e-09); /* 0xBE3E2FE0, 0x145B01F5 =tail of cp_h*/
+        static constexpr fp ivln2   = fp( 1.44269504088896338700e+00); /* 0x3FF71547, 0x652B82FE =1/ln2 */
+        static constexpr fp ivln2_h = fp( 1.44269502162933349609e+00); /* 0x3FF71547, 0x60000000 =24b 1/ln2*/
+        static constexpr fp ivln2_l = fp( 1.92596299112661746887e-08); /* 0x3E54AE0B, 0xF85DDF44 =1/ln2 tail*/
+    };
+
+    template <typename fp>
+    constexpr fp _pow(fp x, fp y)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<double, fp>) {
+            return std::pow(x, y);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __pow_data<fp>;
+            fp z, ax, z_h, z_l, p_h, p_l;
+            fp y1, t1, t2, r, s, t, u, v, w;
+            int32_t i, j, k, yisint, n;
+            int32_t hx, hy, ix, iy;
+            uint32_t lx, ly;
+
+            hx = int32_t(get_high_word(x));
+            lx = get_low_word(x);
+            hy = int32_t(get_high_word(y));
+            ly = get_low_word(y);
+            ix = hx & 0x7fffffff;
+            iy = hy & 0x7fffffff;
+
+            /* x**0 = 1, even if x is NaN */
+            if ((uint32_t(iy)|ly) == 0)
+                return fp(1.0);
+            /* 1**y = 1, even if y is NaN */
+            if (hx == 0x3ff00000 && lx == 0)
+                return fp(1.0);
+            /* NaN if either arg is NaN */
+            if (ix > 0x7ff00000 || (ix == 0x7ff00000 && lx != 0) ||
+                iy > 0x7ff00000 || (iy == 0x7ff00000 && ly != 0))
+                return x + y;
+
+            /* determine if y is an odd int when x < 0
+             * yisint = 0       ... y is not an integer
+             * yisint = 1       ... y is an odd int
+             * yisint = 2       ... y is an even int
+             */
+            yisint = 0;
+            if (hx < 0) {
+                if (iy >= 0x43400000)
+                    yisint = 2; /* even integer y */
+                else if (iy >= 0x3ff00000) {
+                    k = (iy>>20) - 0x3ff;        /* exponent */
+                    if (k > 20) {
+                        uint32_t jj = ly >> (52-k);
+                        if ((jj<<(52-k)) == ly)
+                            yisint = 2 - (jj&1);
+                    } else if (ly == 0) {
+                        uint32_t jj = uint32_t(iy) >> (20-k);
+                        if ((jj<<(20-k)) == uint32_t(iy))
+                            yisint = 2 - (jj&1);
+                    }
+                }
+            }
+
+            /* special value of y */
+            if (ly == 0) {
+                if (iy == 0x7ff00000) {  /* y is +-inf */
+                    if (((ix-0x3ff00000)|int32_t(lx)) == 0)  /* (-1)**+-inf is 1 */
+                        return fp(1.0);
+                    else if (ix >= 0x3ff00000) /* (|x|>1)**+-inf = inf,0 */
+                        return hy >= 0 ? y : fp(0.0);
+                    else                       /* (|x|<1)**+-inf = 0,inf */
+                        return hy >= 0 ? fp(0.0) : -y;
+                }
+                if (iy == 0x3ff00000) {    /* y is +-1 */
+                    if (hy >= 0)
+                        return x;
+                    return fp(1.0)/x;
+                }
+                if (hy == 0x40000000)    /* y is 2 */
+                    return x*x;
+                if (hy == 0x3fe00000) {  /* y is 0.5 */
+                    if (hx >= 0)     /* x >= +0 */
+                        return sqrt(x);
+                }
+            }
+
+            ax = __fabs(x);
+            /* special value of x */
+            if (lx == 0) {
+                if (ix == 0x7ff00000 || ix == 0 || ix == 0x3ff00000) { /* x is +-0,+-inf,+-1 */
+                    z = ax;
+                    if (hy < 0)   /* z = (1/|x|) */
+                        z = fp(1.0)/z;
+                    if (hx < 0) {
+                        if (((ix-0x3ff00000)|yisint) == 0) {
+                            z = (z-z)/(z-z); /* (-1)**non-int is NaN */
+                        } else if (yisint == 1)
+                            z = -z;          /* (x<0)**odd = -(|x|**odd) */
+                    }
+                    return z;
+                }
+            }
+
+            s = fp(1.0); /* sign of result */
+            if (hx < 0) {
+                if (yisint == 0) /* (x<0)**(non-int) is NaN */
+                    return (x-x)/(x-x);
+                if (yisint == 1) /* (x<0)**(odd int) */
+                    s = fp(-1.0);
+            }
+
+            /* |y| is huge */
+            if (iy > 0x41e00000) { /* if |y| > 2**31 */
+                if (iy > 0x43f00000) {  /* if |y| > 2**64, must o/uflow */
+                    if (ix <= 0x3fefffff)
+                        return hy < 0 ? d::huge*d::huge : d::tiny*d::tiny;
+                    if (ix >= 0x3ff00000)
+                        return hy > 0 ? d::huge*d::huge : d::tiny*d::tiny;
+                }
+                /* over/underflow if x is not close to one */
+                if (ix < 0x3fefffff)
+                    return hy < 0 ? s*d::huge*d::huge : s*d::tiny*d::tiny;
+                if (ix > 0x3ff00000)
+                    return hy > 0 ? s*d::huge*d::huge : s*d::tiny*d::tiny;
+                /* now |1-x| is tiny <= 2**-20, suffice to compute
+                   log(x) by x-x^2/2+x^3/3-x^4/4 */
+                t = ax - fp(1.0);       /* t has 20 trailing zeros */
+                w = (t*t)*(fp(0.5) - t*(fp(0.3333333333333333333333) - t*fp(0.25)));
+                u = d::ivln2_h*t;      /* ivln2_h has 21 sig. bits */
+                v = t*d::ivln2_l - w*d::ivln2;
+                t1 = u + v;
+                set_low_word(t1, 0);
+                t2 = v - (t1-u);
+            } else {
+                fp ss, s2, s_h, s_l, t_h, t_l;
+                n = 0;
+                /* take care subnormal number */
+                if (ix < 0x00100000) {
+                    ax = ax * d::two53;
+                    n -= 53;
+                    ix = int32_t(get_high_word(ax));
+                }
+                n += ((ix)>>20) - 0x3ff;
+                j = ix & 0x000fffff;
+                /* determine interval */
+                ix = j | 0x3ff00000;   /* normalize ix */
+                if (j <= 0x3988E)      /* |x|<sqrt(3/2) */
+                    k = 0;
+                else if (j < 0xBB67A)  /* |x|<sqrt(3)   */
+                    k = 1;
+                else {
+                    k = 0;
+                    n += 1;
+                    ix -= 0x00100000;
+                }
+                set_high_word(ax, uint32_t(ix));
+
+                /* compute ss = s_h+s_l = (x-1)/(x+1) or (x-1.5)/(x+1.5) */
+                u = ax - d::bp[k];        /* bp[0]=1.0, bp[1]=1.5 */
+                v = fp(1.0)/(ax + d::bp[k]);
+                ss = u*v;
+                s_h = ss;
+                set_low_word(s_h, 0);
+                /* t_h=ax+bp[k] High */
+                t_h = insert_words<fp>(uint32_t(((ix>>1)|0x20000000) + 0x00080000 + (k<<18)), 0);
+                t_l = ax - (t_h - d::bp[k]);
+                s_l = v*((u - s_h*t_h) - s_h*t_l);
+                /* compute log(ax) */
+                s2 = ss*ss;
+                r = s2*s2*(d::L1 + s2*(d::L2 + s2*(d::L3 + s2*(d::L4 + s2*(d::L5 + s2*d::L6)))));
+                r = r + s_l*(s_h + ss);
+                s2 = s_h*s_h;
+                t_h = fp(3.0) + s2 + r;
+                set_low_word(t_h, 0);
+                t_l = r - ((t_h - fp(3.0)) - s2);
+                /* u+v = ss*(1+...) */
+                u = s_h*t_h;
+                v = s_l*t_h + t_l*ss;
+                /* 2/(3log2)*(ss+...) */
+                p_h = u + v;
+                set_low_word(p_h, 0);
+                p_l = v - (p_h - u);
+                z_h = d::cp_h*p_h;        /* cp_h+cp_l = 2/(3*log2) */
+                z_l = d::cp_l*p_h + p_l*d::cp + d::dp_l[k];
+                /* log2(ax) = (ss+..)*2/(3*log2) = n + dp_h + z_h + z_l */
+                t = __from_int32<fp>(n);
+                t1 = ((z_h + z_l) + d::dp_h[k]) + t;
+                set_low_word(t1, 0);
+                t2 = z_l - (((t1 - t) - d::dp_h[k]) - z_h);
+            }
+
+            /* split up y into y1+y2 and compute (y1+y2)*(t1+t2) */
+            y1 = y;
+            set_low_word(y1, 0);
+            p_l = (y - y1)*t1 + y*t2;
+            p_h = y1*t1;
+            z = p_l + p_h;
+            j = int32_t(get_high_word(z));
+            i = int32_t(get_low_word(z));
+            if (j >= 0x40900000) {                      /* z >= 1024 */
+                if (((j-0x40900000)|i) != 0)        /* if z > 1024 */
+                    return s*d::huge*d::huge;         /* overflow */
+                if (p_l + d::ovt > z - p_h)
+                    return s*d::huge*d::huge;         /* overflow */
+            } else if ((j&0x7fffffff) >= 0x4090cc00) {  /* z <= -1075 */
+                if (((uint32_t(j)-0xc090cc00)|uint32_t(i)) != 0)        /* z < -1075 */
+                    return s*d::tiny*d::tiny;         /* underflow */
+                if (p_l <= z - p_h)
+                    return s*d::tiny*d::tiny;         /* underflow */
+            }
+            /*
+             * compute 2**(p_h+p_l)
+             */
+            i = j & 0x7fffffff;
+            k = (i>>20) - 0x3ff;
+            n = 0;
+            if (i > 0x3fe00000) {  /* if |z| > 0.5, set n = [z+0.5] */
+                n = j + (0x00100000>>(k+1));
+                k = ((n&0x7fffffff)>>20) - 0x3ff;  /* new k for n */
+                t = insert_words<fp>(uint32_t(n & ~(0x000fffff>>k)), 0);
+                n = ((n&0x000fffff)|0x00100000)>>(20-k);
+                if (j < 0)
+                    n = -n;
+                p_h = p_h - t;
+            }
+            t = p_l + p_h;
+            set_low_word(t, 0);
+            u = t*d::lg2_h;
+            v = (p_l - (t - p_h))*d::lg2 + t*d::lg2_l;
+            z = u + v;
+            w = v - (z - u);
+            t = z*z;
+            t1 = z - t*(d::P1 + t*(d::P2 + t*(d::P3 + t*(d::P4 + t*d::P5))));
+            r = (z*t1)/(t1 - fp(2.0)) - (w + z*w);
+            z = fp(1.0) - (r - z);
+            j = int32_t(get_high_word(z));
+            j += int32_t(uint32_t(n)<<20);
+            if ((j>>20) <= 0)  /* subnormal output */
+                z = __scalbn(z, n);
+            else
+                set_high_word(z, uint32_t(j));
+            return s*z;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto pow(fp x, fp y)
+    {
+        return _pow(sixit::dmath::fp_traits<fp>::to_fallback(x), sixit::dmath::fp_traits<fp>::to_fallback(y));
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_pow_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
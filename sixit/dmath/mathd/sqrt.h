@@ -0,0 +1,159 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+#ifndef sixit_dmath_mathd_sqrt_h_included
+#define sixit_dmath_mathd_sqrt_h_included
+
+#include <cstdint>
+#include "__utils.h"
+#include "sixit/dmath/mathf/sqrt.h"
+
+namespace sixit::dmath::mathd
+{
+    template <typename fp>
+    constexpr fp _sqrt(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<fp, double>) {
+            return std::sqrt(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            // MUSL's sqrt(): Goldschmidt iterations on integers, seeded from the same
+            // __rsqrt_tab as mathf::sqrt(); the result is correctly rounded (to nearest)
+            uint64_t ix, top, m;
+
+            auto mul32 = [](uint32_t a, uint32_t b)
+            {
+                return uint32_t(((uint64_t)a * b) >> 32);
+            };
+
+            /* returns a*b*2^-64 - e, with error 0 <= e < 3 */
+            auto mul64 = [](uint64_t a, uint64_t b)
+            {
+                uint64_t ahi = a>>32;
+                uint64_t alo = a&0xffffffff;
+                uint64_t bhi = b>>32;
+                uint64_t blo = b&0xffffffff;
+                return ahi*bhi + (ahi*blo >> 32) + (alo*bhi >> 32);
+            };
+
+            ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x);
+            top = ix >> 52;
+            if (predict_false(top - 0x001 >= 0x7ff - 0x001)) {
+                /* x < 0x1p-1022 or inf or nan.  */
+                if (ix * 2 == 0)
+                    return x;
+                if (ix == 0x7ff0000000000000)
+                    return x;
+                if (ix > 0x7ff0000000000000)
+                    return (x - x) / (x - x);
+                /* x is subnormal, normalize it.  */
+                ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint64(x * fp(0x1p52));
+                top = ix >> 52;
+                top -= 52;
+            }
+
+            /* argument reduction:
+               x = 4^e m; with integer e, and m in [1, 4)
+               m: fixed point representation [2.62]
+               2^e is the exponent part of the result.  */
+            bool even = top & 1;
+            m = (ix << 11) | 0x8000000000000000;
+            if (even) m >>= 1;
+            top = (top + 0x3ff) >> 1;
+
+            /* approximate r ~ 1/sqrt(m) and s ~ sqrt(m) when m in [1,4),
+               then refine them with Goldschmidt iterations.  */
+            constexpr uint64_t three = 0xc0000000;
+            uint64_t r, s, d, u, i;
+
+            i = (ix >> 46) % 128;
+            r = (uint32_t)sixit::dmath::mathf::__rsqrt_tab[i] << 16;
+            /* |r sqrt(m) - 1| < 0x1.fdp-9 */
+            s = mul32(uint32_t(m>>32), uint32_t(r));
+            /* |s/sqrt(m) - 1| < 0x1.fdp-9 */
+            d = mul32(uint32_t(s), uint32_t(r));
+            u = three - d;
+            r = uint64_t(mul32(uint32_t(r), uint32_t(u))) << 1;
+            /* |r sqrt(m) - 1| < 0x1.7bp-16 */
+            s = uint64_t(mul32(uint32_t(s), uint32_t(u))) << 1;
+            /* |s/sqrt(m) - 1| < 0x1.7bp-16 */
+            d = mul32(uint32_t(s), uint32_t(r));
+            u = three - d;
+            r = uint64_t(mul32(uint32_t(r), uint32_t(u))) << 1;
+            /* |r sqrt(m) - 1| < 0x1.3704p-29 (measured worst-case) */
+            r = r << 32;
+            s = mul64(m, r);
+            d = mul64(s, r);
+            u = (three<<32) - d;
+            s = mul64(s, u);  /* repr: 3.61 */
+            /* -0x1p-57 < s - sqrt(m) < 0x1.8001p-61 */
+            s = (s - 2) >> 9; /* repr: 12.52 */
+            /* -0x1.09p-52 < s - sqrt(m) < -0x1.fffcp-63 */
+
+            /* s < sqrt(m) < s + 0x1.09p-52,
+               compute nearest rounded result:
+               the nearest result to 52 bits is either s or s+0x1p-52,
+               we can decide by comparing (2^52 s + 0.5)^2 to 2^104 m.  */
+            uint64_t d0, d1;
+            d0 = (m << 42) - s*s;
+            d1 = s - d0;
+            s += d1 >> 63;
+            s &= 0x000fffffffffffff;
+            s |= top << 52;
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint64(s);
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto sqrt(fp x)
+    {
+        return _sqrt(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline auto sqrt(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        return sixit::units::dimensional_scalar<fp, sixit::units::sqrt<dim_>()>({ sqrt<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathd
+
+#endif // sixit_dmath_mathd_sqrt_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -21,7 +21,7 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 namespace sixit::dmath::mathf
 {
     template <typename fp>
-    fp __cosdf(fp x /*must_be_double*/)
+    constexpr fp __cosdf(fp x /*must_be_double*/)
     {
         fp C0  = fp(float(-0x1ffffffd0c5e81.0p-54)); /* -0.499999997251031003120 */ // must_be_double
         fp C1  = fp(float( 0x155553e1053a42.0p-57)); /*  0.0416666233237390631894 */ // must_be_double
@@ -33,8 +33,8 @@ namespace sixit::dmath::mathf
         /* Try to optimize for parallel evaluation as in __tandf.c. */
         z = x * x;
         w = z * z;
-        r = C2 + z * C3;
-        return ((fp(1.0) + z * C0) + w * C1) + (w * z) * r;
+        r = __mul_add(z, C3, C2);
+        return __mul_add(w * z, r, __mul_add(w, C1, __mul_add(z, C0, fp(1.0))));
     }
 } //  sixit::dmath::mathf
 
@@ -283,8 +283,19 @@ namespace sixit::dmath::mathf
         };
     };
 
+    // 2^n, exact for any n in the range of double; constexpr replacement for scalbn(1.0, n)
+    constexpr double __exp2i(int n)
+    {
+        double rv = 1.0;
+        for (; n > 0; --n)
+            rv *= 2.0;
+        for (; n < 0; ++n)
+            rv *= 0.5;
+        return rv;
+    }
+
     template <typename fp>
-    int __rem_pio2_large(fp *x /*must_be_double*/, fp *y /*must_be_double*/, int e0, int nx, int prec)
+    constexpr int __rem_pio2_large(fp *x /*must_be_double*/, fp *y /*must_be_double*/, int e0, int nx, int prec)
     {
         int32_t jz,jx,jv,jp,jk,carry,n,iq[20],i,j,k,m,q0,ih;
         fp z,fw,f[20],fq[20],q[20];   // must_be_double
@@ -321,8 +332,9 @@ namespace sixit::dmath::mathf
             }
 
             /* compute n */
-            assert(sixit::dmath::fp_traits<fp>::set_exp(z, 
-                        sixit::dmath::fp_traits<fp>::get_exp(z) + q0));
+            [[maybe_unused]] bool exp_ok = sixit::dmath::fp_traits<fp>::set_exp(z,
+                        sixit::dmath::fp_traits<fp>::get_exp(z) + q0);
+            assert(exp_ok);
             z = z - (fp(8.f) * floor(z * fp(0.125))); /* trim off integer >= 8 */
             n  = int32_t(sixit::dmath::fp_traits<fp>::fp2int64(z));
             z = z - (/*(double) must_be_double*/fp(float(n)));
@@ -358,7 +370,7 @@ namespace sixit::dmath::mathf
                 if (ih == 2) {
                     z = fp(1.f) - z;
                     if (carry != 0)
-                        z = z - fp(float(scalbn(1.0, q0)));
+                        z = z - fp(float(__exp2i(q0)));
                 }
             }
 
@@ -391,8 +403,9 @@ namespace sixit::dmath::mathf
                 q0 -= 24;
             }
         } else { /* break z into 24-bit if necessary */
-            assert(sixit::dmath::fp_traits<fp>::set_exp(z, 
-                        sixit::dmath::fp_traits<fp>::get_exp(z) - q0));
+            [[maybe_unused]] bool exp_ok = sixit::dmath::fp_traits<fp>::set_exp(z,
+                        sixit::dmath::fp_traits<fp>::get_exp(z) - q0);
+            assert(exp_ok);
             if (z >= fp(0x1p24)) {
                 fw = /*(double) must_be_double*/ float(sixit::dmath::fp_traits<fp>::fp2int64(fp(0x1p-24) * z));
                 iq[jz] = int32_t(sixit::dmath::fp_traits<fp>::fp2int64(z - fp(0x1p24) * fw));
@@ -404,7 +417,7 @@ namespace sixit::dmath::mathf
         }
 
         /* convert integer "bit" chunk to floating-point value */
-        fw = fp(float(scalbn(1.0,q0)));
+        fw = fp(float(__exp2i(q0)));
         for (i=jz; i>=0; i--) {
             q[i] = fw * /*(double) must_be_double*/ fp(float(iq[i]));
             fw = fw * fp(0x1p-24);
@@ -17,25 +17,47 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 /* __rem_pio2f(x,y)
 *
 * return the remainder of x rem pi/2 in *y
-* use double precision for everything except passing x
-* use __rem_pio2_large() for large x
+*
+* for |x| ~< 2^28*(pi/2), two-constant Cody-Waite reduction in fp (cheap on hardware-backed fp classes,
+* and bit-identical across them, but its error grows as |x|*2^-23);
+* for larger x (which previously went to __rem_pio2_large()), Payne-Hanek reduction on integers only
+* (__rem_pio2f_int(), bits of x are taken with bit_cast_to_ieee_uint32()), which works for all finite x:
+* with x = m*2^e (m < 2^24), bits of 2/pi with weights above 2^(1-e) only add multiples of 4 to x*2/pi,
+* so it is enough to multiply m by the next 128 bits of 2/pi, which gives x*2/pi mod 4 with at least
+* 128-24-2 bits of fraction; it is then rounded to the nearest quadrant n, and the (signed) remainder
+* is multiplied by pi/2 and rounded to float, so |y| <= pi/4 and y is correctly rounded except in cases
+* which are closer than 2^-60 (relative) to the midpoint between two floats.
+* As no fp operations are involved, it costs the same for all the fp classes, and it is
+* as fast for |x| ~ 2^127 as for |x| ~ 2^2; fast:: uses it for all |x|, as its error bounds rely on y
+* being correctly rounded.
 */
 
 /*
-* invpio2:  53 bits of 2/pi
+* invpio2:  bits of 2/pi, 64 per word, preceded by a zero word (so that windows starting from any bit
+*           with weight up to 2^63 can be taken); bit #i of the stream has weight 2^(63-i)
+* pio2:     pi/2 * 2^63, rounded to nearest
+* invpio2 (fp):  53 bits of 2/pi
 * pio2_1:   first 25 bits of pi/2
 * pio2_1t:  pi/2 - pio2_1
 */
 #ifndef sixit_dmath_math_operations___rem_pio2f_h_included
 #define sixit_dmath_math_operations___rem_pio2f_h_included
 
+#include <bit>
+#include <limits>
 #include "__utils.h"
-#include "__rem_pio2_large.h"
 
 namespace sixit::dmath::mathf
 {
-    template <typename fp>
     struct __rem_pio2f_data {
+        static constexpr uint64_t invpio2[] = {
+            0x0000000000000000, 0xa2f9836e4e441529, 0xfc2757d1f534ddc0, 0xdb6295993c439041, 0xfe5163abdebbc561,
+        };
+        static constexpr uint64_t pio2 = 0xc90fdaa22168c235;
+    };
+
+    template <typename fp>
+    struct __rem_pio2f_medium_data {
         static constexpr fp toint = fp(float(1.5 / std::numeric_limits<float /*must_be_double*/>::epsilon() ));                      // must_be_double
         static constexpr fp pio4  = fp(float(0x1.921fb6p-1));                // must_be_double
         static constexpr fp invpio2 = fp(float(6.36619772367581382433e-01)); /* 0x3FE45F30, 0x6DC9C883 */  // must_be_double
@@ -43,58 +65,124 @@ namespace sixit::dmath::mathf
         static constexpr fp pio2_1t = fp(float(1.58932547735281966916e-08)); /* 0x3E5110b4, 0x611A6263 */  // must_be_double
     };
 
+    /* returns hi and stores lo to *lo, so that hi:lo = |x|*2/pi mod 4, scaled by 2^126; ix = bits of |x|,
+       which must be finite and >= 2^-39 */
+    constexpr uint64_t __mul_2opi_mod4_bits(uint32_t ix, uint64_t *lo)
+    {
+        using d = __rem_pio2f_data;
+
+        /* |x| = m*2^e, e in [-62, 104] */
+        uint64_t m = (ix & 0x007fffff) | 0x00800000;
+        int e = int(ix >> 23) - (0x7f+23);
+
+        /* w1:w0 = 128 bits of 2/pi, starting from the one with weight 2^(1-e) */
+        int i = e + 62;
+        int q = i >> 6;
+        int r = i & 63;
+        uint64_t w1 = (d::invpio2[q] << r) | ((d::invpio2[q+1] >> 1) >> (63-r));
+        uint64_t w0 = (d::invpio2[q+1] << r) | ((d::invpio2[q+2] >> 1) >> (63-r));
+
+        /* hi:lo = m*(w1:w0) mod 2^128 */
+        uint64_t hi = __umul64x64(m, w0, lo);
+        return hi + m * w1;
+    }
+
+    /* same as __rem_pio2f(), on bits of x and y; x must be finite */
+    constexpr int __rem_pio2f_bits(uint32_t ui, uint32_t *uy)
+    {
+        using d = __rem_pio2f_data;
+        uint64_t m, hi, lo, n, neg, top;
+        uint32_t ix, sign, ey;
+        int lz;
+
+        ix = ui & 0x7fffffff;
+        sign = ui >> 31;
+        if (ix < 0x2c000000) {  /* |x| < 2^-39, nothing to reduce (and the window below would start too early) */
+            *uy = ui;
+            return 0;
+        }
+
+        /* hi:lo = |x|*2/pi mod 4, scaled by 2^126 */
+        hi = __mul_2opi_mod4_bits(ix, &lo);
+
+        /* n = nearest integer (mod 4), hi:lo = remainder in [-1/2, 1/2] as a signed 128 bit number */
+        n = (hi + (uint64_t(1) << 61)) >> 62;
+        hi -= n << 62;
+        neg = 0 - (hi >> 63);  /* branchless, as the sign is unpredictable */
+        lo = (lo ^ neg) - neg;
+        hi = (hi ^ neg) + (neg & (lo == 0));
+        sign ^= uint32_t(neg & 1);
+        if (predict_false((hi | lo) == 0)) {  /* only for x == 0 mod pi/2, which is not a float */
+            *uy = sign << 31;
+            return (ui >> 31) ? -int(n) : int(n);
+        }
+
+        /* top = normalized 64 upper bits of the remainder, which is top*2^(-62-lz) */
+        lz = hi ? std::countl_zero(hi) : 64 + std::countl_zero(lo);
+        top = lz < 64 ? (hi << lz) | (lo >> (64-lz)) : lo << (lz-64);
+
+        /* y = top*pio2*2^(-125-lz); normalize the upper 64 bits of the product and round them to 24 bits */
+        top = __umul64x64(top, d::pio2, &lo);
+        lz += int(~top >> 63);
+        top <<= ~top >> 63;
+        ey = uint32_t(0x7f + 2 - lz);
+        m = top >> 40;
+        lo = top & ((uint64_t(1) << 40) - 1);
+        /* if m overflows to 2^24, adding it to (ey-1)<<23 below gives 2^23 with ey+1 */
+        m += (lo > (uint64_t(1) << 39)) | ((lo == (uint64_t(1) << 39)) & m);
+        *uy = (sign << 31) + ((ey - 1) << 23) + uint32_t(m);
+        return (ui >> 31) ? -int(n) : int(n);
+    }
+
+    template <typename fp>
+    constexpr int __rem_pio2f_int(fp x, fp *y)
+    {
+        uint32_t ui = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+        uint32_t uy;
+        int n;
+
+        if ((ui & 0x7fffffff) >= 0x7f800000) {  /* x is inf or NaN */
+            *y = x-x;
+            return 0;
+        }
+        n = __rem_pio2f_bits(ui, &uy);
+        *y = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uy);
+        return n;
+    }
+
     template <typename fp>
-    int __rem_pio2f(fp x, fp *y /*must_be_double*/)
+    constexpr int __rem_pio2f(fp x, fp *y /*must_be_double*/)
     {
+        using d = __rem_pio2f_medium_data<fp>;
         uint32_t ui = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
-        fp tx[1],ty[1];  // must_be_double
         fp fn;   // must_be_double
         uint32_t ix;
-        int n, sign, e0;
+        int n;
 
         ix = ui & 0x7fffffff;
         /* 25+53 bit pi is good enough for medium size */
         if (ix < 0x4dc90fdb) {  /* |x| ~< 2^28*(pi/2), medium size */
             /* Use a specialized rint() to get fn. */
-            fn = /*(double_t) must_be_doubl*/x * __rem_pio2f_data<fp>::invpio2 + __rem_pio2f_data<fp>::toint - __rem_pio2f_data<fp>::toint;
+            fn = /*(double_t) must_be_doubl*/x * d::invpio2 + d::toint - d::toint;
             n  = int(sixit::dmath::fp_traits<fp>::fp2int64(fn));
-            *y = x - fn * __rem_pio2f_data<fp>::pio2_1 - fn * __rem_pio2f_data<fp>::pio2_1t;
+            *y = x - fn * d::pio2_1 - fn * d::pio2_1t;
             // for float conversation
             ///////////////
-            fn = *y * __rem_pio2f_data<fp>::invpio2 + __rem_pio2f_data<fp>::toint - __rem_pio2f_data<fp>::toint;
+            fn = *y * d::invpio2 + d::toint - d::toint;
             n += int(sixit::dmath::fp_traits<fp>::fp2int64(fn));
-            *y = *y - fn * __rem_pio2f_data<fp>::pio2_1 - fn * __rem_pio2f_data<fp>::pio2_1t;
+            *y = *y - fn * d::pio2_1 - fn * d::pio2_1t;
             ///////////////
             /* Matters with directed rounding. */
-            if (predict_false(*y < -__rem_pio2f_data<fp>::pio4)) {
+            if (predict_false(*y < -d::pio4)) {
                 n--;
-                // fn = fn - fp(1.f);  // TODO
-                // *y = x - fn * __rem_pio2f_data<fp>::pio2_1 - fn * __rem_pio2f_data<fp>::pio2_1t;
-                *y = *y + __rem_pio2f_data<fp>::pio2_1 + __rem_pio2f_data<fp>::pio2_1t;
-            } else if (predict_false(*y > __rem_pio2f_data<fp>::pio4)) {
+                *y = *y + d::pio2_1 + d::pio2_1t;
+            } else if (predict_false(*y > d::pio4)) {
                 n++;
-                // fn = fn + fp(1.f);  // TODO
-                // *y = x - fn * __rem_pio2f_data<fp>::pio2_1 - fn * __rem_pio2f_data<fp>::pio2_1t;
-                *y = *y - __rem_pio2f_data<fp>::pio2_1 - __rem_pio2f_data<fp>::pio2_1t;
+                *y = *y - d::pio2_1 - d::pio2_1t;
             }
             return n;
         }
-        if(ix>=0x7f800000) {  /* x is inf or NaN */
-            *y = x-x;
-            return 0;
-        }
-        /* scale x into [2^23, 2^24-1] */
-        sign = ui >> 31;
-        e0 = (ix >> 23) - (0x7f+23);  /* e0 = ilogb(|x|)-23, positive */
-        ui = ix - (e0 << 23);
-        tx[0] = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(ui);
-        n  =  __rem_pio2_large(tx, ty, e0, 1, 0);
-        if (sign) {
-            *y = -ty[0];
-            return -n;
-        }
-        *y = ty[0];
-        return n;
+        return __rem_pio2f_int(x, y);
     }
 } //  sixit::dmath::mathf
 
@@ -21,7 +21,7 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 namespace sixit::dmath::mathf
 {
     template <typename fp>
-    fp __sindf(fp x /*must_be_double*/)
+    constexpr fp __sindf(fp x /*must_be_double*/)
     {
         fp r, s, w, z;  // must_be_double
 
@@ -33,9 +33,9 @@ namespace sixit::dmath::mathf
         /* Try to optimize for parallel evaluation as in __tandf.c. */
         z = x*x;
         w = z*z;
-        r = S3 + z*S4;
+        r = __mul_add(z, S4, S3);
         s = z*x;
-        return (x + s*(S1 + z*S2)) + s*w*r;
+        return __mul_add(s*w, r, __mul_add(s, __mul_add(z, S2, S1), x));
     }
 } //  sixit::dmath::mathf
 
@@ -17,6 +17,8 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 #ifndef sixit_dmath_math_operations___tandf_h_included
 #define sixit_dmath_math_operations___tandf_h_included
 
+#include "__utils.h"
+
 namespace sixit::dmath::mathf
 {
     template <typename fp>
@@ -48,12 +50,12 @@ namespace sixit::dmath::mathf
         * and would give results as accurate as Horner's method if the
         * small terms were added from highest degree down.
         */
-        r = T[4] + z * T[5];
-        t = T[2] + z * T[3];
+        r = __mul_add(z, T[5], T[4]);
+        t = __mul_add(z, T[3], T[2]);
         w = z*z;
         s = z*x;
-        u = T[0] + z * T[1];
-        r = (x + s*u) + (s*w)*(t + w*r);
+        u = __mul_add(z, T[1], T[0]);
+        r = __mul_add(s*w, __mul_add(w, r, t), __mul_add(s, u, x));
         return odd ? fp(-1.f) / r : r;
     }
 } //  sixit::dmath::mathf
@@ -6,7 +6,10 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 #ifndef sixit_dmath_math_operations___utils_h_included
 #define sixit_dmath_math_operations___utils_h_included
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include "sixit/dmath/traits.h"
 
 #ifdef __GNUC__
@@ -22,26 +25,37 @@ namespace sixit::dmath::mathf {
     constexpr double PI2 = 1.5707963267948966;
 
     template <typename fp>
-    inline fp eval_as_fp(fp x)
+    constexpr fp eval_as_fp(fp x)
     {
         fp y = x;
         return y;
     }
 
     template <typename fp>
-    inline void force_eval_fp(const fp x)
+    constexpr void force_eval_fp(const fp x)
     {
-        volatile fp y;
-        y = x;
+        // only meant to raise FP exceptions at runtime; there is nothing to raise during constant evaluation
+        if (!std::is_constant_evaluated())
+        {
+            volatile fp y;
+            y = x;
+        }
     }
 
+    // fp with IEEE-754 binary32 bits (fixed_point and double have none, so bit-based code needs a fallback for them)
     template <typename fp>
-    inline uint32_t top12(fp x)
+    concept __has_ieee_bits = requires(fp x, uint32_t u) {
+        sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+        sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(u);
+    };
+
+    template <typename fp>
+    constexpr uint32_t top12(fp x)
     {
         return sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x) >> 20;
     }
 
-    inline float fp_barrierf(float x)
+    constexpr float fp_barrierf(float x)
     {
         // __asm__ __volatile__ ("" : "+w"(x)); 
         return x;
@@ -50,44 +64,210 @@ namespace sixit::dmath::mathf {
 
         
     template <typename fp>
-    inline fp __math_xflowf(uint32_t sign, float y)
+    constexpr fp __math_xflowf(uint32_t sign, float y)
     {
         fp rv = fp(fp_barrierf(sign ? -y : y));
-        // fp fp_y = fp(y);
-        // TODO rv = rv * fp_y;
+        rv = rv * fp(y);
         return eval_as_fp(rv);
     }
 
     template <typename fp>
-    inline fp __math_oflowf(uint32_t sign)
+    constexpr fp __math_oflowf(uint32_t sign)
     {
         return __math_xflowf<fp>(sign, 0x1p97f);
     }
 
     template <typename fp>
-    inline fp __math_uflowf(uint32_t sign)
+    constexpr fp __math_uflowf(uint32_t sign)
     {
         return __math_xflowf<fp>(sign, 0x1p-95f);
     }
 
     template <typename fp>
-    inline double asdouble(uint64_t val)
+    constexpr double asdouble(uint64_t val)
     {
         return sixit::lwa::bit_cast<double>(val);
     }
 
-    inline uint64_t asuint64(double val) {
+    constexpr uint64_t asuint64(double val) {
         return sixit::lwa::bit_cast<uint64_t>(val);
     }
 
-    inline double eval_as_double(double x)
+    constexpr double eval_as_double(double x)
     {
         double y = x;
         return y;
     }
 
+    // x * 2^n; multiplications by exact powers of 2 only, so it is deterministic on every backend
+    template <typename fp>
+    constexpr fp __scalbnf(fp x, int n)
+    {
+        fp y = x;
+
+        if (n > 127) {
+            y = y * fp(0x1p127f);
+            n -= 127;
+            if (n > 127) {
+                y = y * fp(0x1p127f);
+                n -= 127;
+                if (n > 127)
+                    n = 127;
+            }
+        } else if (n < -126) {
+            y = y * fp(0x1p-126f * 0x1p24f);
+            n += 126 - 24;
+            if (n < -126) {
+                y = y * fp(0x1p-126f * 0x1p24f);
+                n += 126 - 24;
+                if (n < -126)
+                    n = -126;
+            }
+        }
+        return y * sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(0x7f + n) << 23);
+    }
+
+    // a*b+c for polynomial kernels; by default it is two separately rounded operations (as in MUSL),
+    //   with SIXIT_DMATH_USE_FMA defined it is fp_traits<fp>::fma(), rounded once. Both ways are deterministic,
+    //   but they produce different bits, so SIXIT_DMATH_USE_FMA must be the same across all the parties involved
+    template <typename fp>
+    constexpr fp __mul_add(fp a, fp b, fp c)
+    {
+#ifdef SIXIT_DMATH_USE_FMA
+        return sixit::dmath::fp_traits<fp>::fma(a, b, c);
+#else
+        return a*b + c;
+#endif
+    }
+
+    // c0 + x*(c1 + x*(c2 + ... + x*cn)) for polynomial kernels: unlike __mul_add(), always separately rounded
+    //   operations in exactly this order; backends which can emit the whole chain at once (ieee_float_inline_asm,
+    //   as a single asm block) provide fp_traits<fp>::horner() with the very same operations
+    template <typename fp>
+    concept __has_horner = requires(fp x, const fp (&c)[2]) { sixit::dmath::fp_traits<fp>::horner(x, c); };
+
+    template <typename fp, typename... C>
+    constexpr fp __horner(fp x, fp c0, C... cs)
+    {
+        const fp c[] = { c0, fp(cs)... };
+        if constexpr (__has_horner<fp>) {
+            return sixit::dmath::fp_traits<fp>::horner(x, c);
+        } else {
+            constexpr size_t n = sizeof...(C) + 1;
+            fp r = c[n - 1];
+            for (size_t i = n - 1; i-- > 0;)
+                r = c[i] + x * r;
+            return r;
+        }
+    }
+
+    // 64x64->128 bit multiplication: returns the high 64 bits of a*b, and stores the low ones to *lo;
+    //   unlike sixit::core::cpual::umul64x64(), usable in constexpr context
+    constexpr uint64_t __umul64x64(uint64_t a, uint64_t b, uint64_t* lo)
+    {
+#ifdef __SIZEOF_INT128__
+        __extension__ unsigned __int128 p = (unsigned __int128)a * b;
+        *lo = uint64_t(p);
+        return uint64_t(p >> 64);
+#else
+        uint64_t a0 = a & 0xffffffff, a1 = a >> 32;
+        uint64_t b0 = b & 0xffffffff, b1 = b >> 32;
+        uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+        *lo = (mid << 32) | (p00 & 0xffffffff);
+        return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+    }
+
+    // signed 64x64->128 bit multiplication: returns the high 64 bits of a*b (two's complement), and stores the low ones to *lo
+    constexpr int64_t __smul64x64(int64_t a, int64_t b, uint64_t* lo)
+    {
+        /* (a mod 2^64)*(b mod 2^64) differs from a*b by 2^64*(b if a < 0, plus a if b < 0); branchless, as signs
+           are unpredictable */
+        uint64_t hi = __umul64x64(uint64_t(a), uint64_t(b), lo);
+        hi -= (uint64_t(a >> 63) & uint64_t(b)) + (uint64_t(b >> 63) & uint64_t(a));
+        return int64_t(hi);
+    }
+
+    // IEEE bits of the float nearest to (-1)^sign * m*2^e, for a normalized m (top bit set); ties to even, with
+    //   subnormals, and inf on overflow. sticky says that the exact value is a bit above m*2^e (some non-zero bits
+    //   below m were dropped)
+    constexpr uint32_t __round_normalized_to_float_bits(uint32_t sign, uint64_t m, int e, bool sticky)
+    {
+        /* m*2^e = mant*2^(e+shift), mant has 24 bits for normal results */
+        int be = e + 63 + 127;
+        if (predict_true(be > 0 && be < 0xff)) {  /* normal (or overflowing to inf when rounded up), no variable shifts */
+            uint64_t mant = m >> 40;
+            uint64_t rem = m << 24;
+            mant += (rem > (uint64_t(1) << 63)) | ((rem == (uint64_t(1) << 63)) & (sticky | (mant & 1)));
+            return (sign << 31) | uint32_t((uint64_t(be - 1) << 23) + mant);
+        }
+        if (be >= 0xff)
+            return (sign << 31) | 0x7f800000;
+        int shift = 40 + 1 - be;  /* subnormal */
+        if (shift > 64)
+            return sign << 31;
+        uint64_t mant = shift == 64 ? 0 : m >> shift;
+        uint64_t rem = shift == 64 ? m : m & ((uint64_t(1) << shift) - 1);
+        uint64_t half = uint64_t(1) << (shift - 1);
+        /* if mant rounds up to 2^23, it becomes the smallest normal, as it should */
+        mant += (rem > half) | ((rem == half) & (sticky | (mant & 1)));
+        return (sign << 31) | uint32_t(mant);
+    }
+
+    // the same for any m; reductions and combinations done on integers (instead of host doubles, which the compiler
+    //   may contract into FMA) produce their results through it, so there is no fp operation involved at all
+    constexpr uint32_t __round_to_float_bits(uint32_t sign, uint64_t m, int e, bool sticky = false)
+    {
+        if (m == 0)
+            return sign << 31;
+        int lz = std::countl_zero(m);
+        return __round_normalized_to_float_bits(sign, m << lz, e - lz, sticky);
+    }
+
+    // the same for a 128-bit (hi:lo)*2^e
+    constexpr uint32_t __round_to_float_bits(uint32_t sign, uint64_t hi, uint64_t lo, int e, bool sticky = false)
+    {
+        if (hi == 0)
+            return __round_to_float_bits(sign, lo, e, sticky);
+        int lz = std::countl_zero(hi);
+        uint64_t top = (hi << lz) | ((lo >> 1) >> (63 - lz));
+        return __round_normalized_to_float_bits(sign, top, e + 64 - lz, sticky | ((lo << lz) != 0));
+    }
+
+    // IEEE bits of a finite float -> the nearest int64_t multiple of 2^-frac_bits (ties away from zero);
+    //   the result must fit
+    constexpr int64_t __float_bits_to_fixed(uint32_t bits, int frac_bits)
+    {
+        uint32_t ex = (bits >> 23) & 0xff;
+        uint64_t m = ex ? (bits & 0x007fffff) | 0x00800000 : bits & 0x007fffff;
+        int shift = (ex ? int(ex) : 1) - 150 + frac_bits;
+        uint64_t v;
+        if (shift >= 0)
+            v = m << shift;
+        else if (shift > -32)
+            v = (m + (uint64_t(1) << (-shift - 1))) >> -shift;
+        else
+            v = 0;
+        return (bits >> 31) ? -int64_t(v) : int64_t(v);
+    }
+
+    // backends where every operation is an opaque call (ieee_float_static_lib) may provide whole functions compiled
+    //   out of line, as fp_traits<fp>::mathf_sin() etc.; these are the same _sin() etc. instantiated for fp,
+    //   so the results are the same, but it is one call instead of dozens. fixed_point provides them too, as native
+    //   integer implementations (returning fixed_point rather than fallback_type)
+    template <typename fp>
+    concept __has_out_of_line_mathf = requires(fp x) {
+        sixit::dmath::fp_traits<fp>::mathf_sin(x);
+        sixit::dmath::fp_traits<fp>::mathf_cos(x);
+        sixit::dmath::fp_traits<fp>::mathf_exp(x);
+        sixit::dmath::fp_traits<fp>::mathf_log(x);
+        sixit::dmath::fp_traits<fp>::mathf_atan2(x, x);
+        sixit::dmath::fp_traits<fp>::mathf_sqrt(x);
+    };
+
     template <typename fp>
-    inline fp __math_divzerof(uint32_t sign)
+    constexpr fp __math_divzerof(uint32_t sign)
     {
         return fp(sign ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity());
         //return fp(fp_barrierf(sign ? -1.0f : 1.0f) / 0.0f);
@@ -11,22 +11,28 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 namespace sixit::dmath::mathf
 {
     template <typename fp>
-    inline fp abs(fp val)
+    constexpr fp abs(fp val)
     {
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         if constexpr (std::is_same_v<float, fp>) {
             return std::abs(val);
         } else {
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC                   
-            return sixit::dmath::fp_traits<fp>::get_sign(val) ? -val : val;
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC                    
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            if constexpr (__has_ieee_bits<fp>) {
+                /* clearing the sign bit is exact (and leaves nans alone), so no fp operations are needed */
+                uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
+                return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(ix & 0x7fffffff);
+            } else {
+                return sixit::dmath::fp_traits<fp>::get_sign(val) ? -val : val;
+            }
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         }
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC               
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
     inline sixit::units::dimensional_scalar<fp, dim_> abs(sixit::units::dimensional_scalar<fp, dim_> val) {
-        return sixit::dmath::fp_traits<fp>::get_sign(val.value) ? -val : val;
+        return sixit::units::dimensional_scalar<fp, dim_>({ abs<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
     }
 } //  sixit::dmath::mathf
 
@@ -34,7 +34,7 @@ namespace sixit::dmath::mathf
 
         static fp R(fp z)
         {
-            fp p = z * (__acos_data<fp>::pS0 + z * (__acos_data<fp>::pS1 + z * __acos_data<fp>::pS2));
+            fp p = z * __horner(z, __acos_data<fp>::pS0, __acos_data<fp>::pS1, __acos_data<fp>::pS2);
             fp q = fp(1.0f) + z * __acos_data<fp>::qS1;
             return p/q;
         }
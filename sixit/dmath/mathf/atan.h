@@ -101,8 +101,8 @@ namespace sixit::dmath::mathf
             z = x*x;
             w = z*z;
             /* break sum from i=0 to 10 aT[i]z**(i+1) into odd and even poly */
-            s1 = z*(__atan_data<fp>::aT[0] + w * (__atan_data<fp>::aT[2] + w * __atan_data<fp>::aT[4]));
-            s2 = w*(__atan_data<fp>::aT[1] + w * __atan_data<fp>::aT[3]);
+            s1 = z*__horner(w, __atan_data<fp>::aT[0], __atan_data<fp>::aT[2], __atan_data<fp>::aT[4]);
+            s2 = w*__horner(w, __atan_data<fp>::aT[1], __atan_data<fp>::aT[3]);
             if (id < 0)
                 return x - x * (s1 + s2);
             z = __atan_data<fp>::atanhi[id] - ((x * (s1 + s2) - __atan_data<fp>::atanlo[id]) - x);
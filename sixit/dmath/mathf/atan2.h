@@ -104,7 +104,10 @@ namespace sixit::dmath::mathf
     template <typename fp>
     auto atan2(fp y, fp x)
     {
-        return _atan2(sixit::dmath::fp_traits<fp>::to_fallback(y), sixit::dmath::fp_traits<fp>::to_fallback(x));
+        if constexpr (__has_out_of_line_mathf<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_atan2(y, x);
+        else
+            return _atan2(sixit::dmath::fp_traits<fp>::to_fallback(y), sixit::dmath::fp_traits<fp>::to_fallback(x));
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
@@ -0,0 +1,483 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+* Bulk versions of mathf functions over contiguous arrays:
+*
+*     sixit::dmath::mathf::batch::sin(std::span<const fp> in, std::span<fp> out);
+*
+* out[i] is always bit-identical to the scalar mathf::X(in[i]).
+* By default, it is a plain loop over the scalar implementation, with fp_traits<> dispatch
+* resolved once per call, which leaves it to the compiler to vectorize whatever it can.
+* With SIXIT_DMATH_SIMD_USE_LANE_KERNELS defined, functions which have lane-parallel versions (see ./simd/)
+* process the bulk of the array using simd_batch_type<fp> (see sixit/dmath/gamefloat/simd_float.h),
+* and the tail element-wise; it is off by default, as on x64 the lane-parallel kernels (which have
+* to compute all the branches for all the lanes) are currently slower than the plain loop over all the
+* backends, including packed ieee_float8_inline_asm (see README for numbers).
+* So, except for ieee_float_static_lib array arithmetic, batch functions are currently NOT faster than
+* a hand-written loop over the scalar ones (which is why SIXIT_DMATH_SIMD_USE_LANE_KERNELS is not on anywhere).
+*/
+#ifndef sixit_dmath_mathf_batch_h_included
+#define sixit_dmath_mathf_batch_h_included
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "sixit/dmath/gamefloat/simd_float.h"
+#include "mathf.h"
+
+namespace sixit::dmath::mathf::batch
+{
+#ifdef SIXIT_DMATH_SIMD_USE_LANE_KERNELS
+    template <typename fp>
+    constexpr bool __use_simd = !sixit::dmath::fp_traits<fp>::is_fixed_point && !sixit::dmath::is_simd_fp_v<fp> &&
+                                !std::is_same_v<fp, float> && !__has_out_of_line_mathf<fp>;
+#else
+    template <typename fp>
+    constexpr bool __use_simd = false;
+#endif // SIXIT_DMATH_SIMD_USE_LANE_KERNELS
+
+    template <typename fp, typename out_fp, typename F>
+    inline void __apply(std::span<const fp> in, std::span<out_fp> out, F&& f)
+    {
+        assert(in.size() == out.size());
+        const fp* src = in.data();
+        out_fp* dst = out.data();
+        const size_t n = in.size();
+        for (size_t i = 0; i < n; ++i)
+            dst[i] = f(src[i]);
+    }
+
+    template <typename fp, typename out_fp, typename F>
+    inline void __apply(std::span<const fp> in1, std::span<const fp> in2, std::span<out_fp> out, F&& f)
+    {
+        assert(in1.size() == out.size() && in2.size() == out.size());
+        const fp* src1 = in1.data();
+        const fp* src2 = in2.data();
+        out_fp* dst = out.data();
+        const size_t n = out.size();
+        for (size_t i = 0; i < n; ++i)
+            dst[i] = f(src1[i], src2[i]);
+    }
+
+    template <typename fp, typename F, typename VF>
+    inline void __apply_simd(std::span<const fp> in, std::span<fp> out, F&& f, VF&& vf)
+    {
+        if constexpr (__use_simd<fp>) {
+            using vfp = typename sixit::dmath::simd_batch_type<fp>::type;
+            using vtraits = sixit::dmath::fp_traits<vfp>;
+            constexpr size_t lanes = vtraits::lanes;
+
+            assert(in.size() == out.size());
+            const fp* src = in.data();
+            fp* dst = out.data();
+            const size_t n = in.size();
+            size_t i = 0;
+            for (; i + lanes <= n; i += lanes)
+                vtraits::store(vf(vtraits::load(src + i)), dst + i);
+            for (; i < n; ++i)
+                dst[i] = f(src[i]);
+        } else {
+            __apply(in, out, std::forward<F>(f));
+        }
+    }
+
+    // output spans have the type of the scalar result: to_fallback() for most functions, but sin(), cos(), exp(), log(),
+    //   atan2() and sqrt() over fixed_point are native and return fixed_point, so those use the scalar call's type
+    template <typename fp>
+    using __result_t = decltype(sixit::dmath::fp_traits<fp>::to_fallback(std::declval<fp>()));
+
+    // lane-parallel functions
+
+    template <typename fp>
+    void sin(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::sin(std::declval<fp>()))> out)
+    {
+        if constexpr (std::is_same_v<decltype(sixit::dmath::mathf::sin(std::declval<fp>())), fp>)
+            __apply_simd(in, out, [](fp x) { return sixit::dmath::mathf::sin(x); }, [](auto x) { return _sin_simd(x); });
+        else
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::sin(x); });
+    }
+
+    template <typename fp>
+    void cos(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::cos(std::declval<fp>()))> out)
+    {
+        if constexpr (std::is_same_v<decltype(sixit::dmath::mathf::cos(std::declval<fp>())), fp>)
+            __apply_simd(in, out, [](fp x) { return sixit::dmath::mathf::cos(x); }, [](auto x) { return _cos_simd(x); });
+        else
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::cos(x); });
+    }
+
+    template <typename fp>
+    void exp(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::exp(std::declval<fp>()))> out)
+    {
+        if constexpr (std::is_same_v<decltype(sixit::dmath::mathf::exp(std::declval<fp>())), fp>)
+            __apply_simd(in, out, [](fp x) { return sixit::dmath::mathf::exp(x); }, [](auto x) { return _exp_simd(x); });
+        else
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::exp(x); });
+    }
+
+    template <typename fp>
+    void log(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::log(std::declval<fp>()))> out)
+    {
+        if constexpr (std::is_same_v<decltype(sixit::dmath::mathf::log(std::declval<fp>())), fp>)
+            __apply_simd(in, out, [](fp x) { return sixit::dmath::mathf::log(x); }, [](auto x) { return _log_simd(x); });
+        else
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::log(x); });
+    }
+
+    // element-wise functions
+
+    // sqrt(), rsqrt() and recip() run their integer-only kernels straight on the bits of the input span (to_fallback()
+    //   doesn't change them), so there is no per-element dispatch to the backend at all; that needs IEEE bits
+    //   (fixed_point has none), and is not worth it where bit casts are opaque calls themselves and the whole
+    //   scalar function is provided out of line (ieee_float_static_lib), so those get a loop over the scalar one
+    template <typename fp>
+    constexpr bool __use_bits_kernel = __has_ieee_bits<fp> && !__has_out_of_line_mathf<fp>;
+
+    template <typename fp>
+    void sqrt(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::sqrt(std::declval<fp>()))> out)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<fp, float>) {
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::sqrt(x); });
+            return;
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        using rfp = decltype(sixit::dmath::mathf::sqrt(std::declval<fp>()));
+        if constexpr (__use_bits_kernel<fp>) {
+            __apply(in, out, [](fp x) {
+                uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+                return sixit::dmath::fp_traits<rfp>::bit_cast_from_ieee_uint32(sixit::dmath::mathf::__sqrt_bits(ix));
+            });
+        } else {
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::sqrt(x); });
+        }
+    }
+
+    template <typename fp>
+    void rsqrt(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::rsqrt(std::declval<fp>()))> out)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<fp, float>) {
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::rsqrt(x); });
+            return;
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        using rfp = decltype(sixit::dmath::mathf::rsqrt(std::declval<fp>()));
+        if constexpr (__use_bits_kernel<fp>) {
+            __apply(in, out, [](fp x) {
+                uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+                return sixit::dmath::fp_traits<rfp>::bit_cast_from_ieee_uint32(sixit::dmath::mathf::__rsqrt_bits(ix));
+            });
+        } else {
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::rsqrt(x); });
+        }
+    }
+
+    template <typename fp>
+    void recip(std::span<const fp> in, std::span<decltype(sixit::dmath::mathf::recip(std::declval<fp>()))> out)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<fp, float>) {
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::recip(x); });
+            return;
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        using rfp = decltype(sixit::dmath::mathf::recip(std::declval<fp>()));
+        if constexpr (__use_bits_kernel<fp> && !__has_mathf_recip<fp>) {
+            __apply(in, out, [](fp x) {
+                uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+                return sixit::dmath::fp_traits<rfp>::bit_cast_from_ieee_uint32(sixit::dmath::mathf::__recip_bits(ix));
+            });
+        } else {
+            // including fixed_point's own mathf_recip() (integer division, returning fixed_point)
+            __apply(in, out, [](fp x) { return sixit::dmath::mathf::recip(x); });
+        }
+    }
+
+    template <typename fp>
+    void round(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::round(x); });
+    }
+
+    template <typename fp>
+    void ceil(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::ceil(x); });
+    }
+
+    template <typename fp>
+    void floor(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::floor(x); });
+    }
+
+    template <typename fp>
+    void trunc(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::trunc(x); });
+    }
+
+    template <typename fp>
+    void fmod(std::span<const fp> val, std::span<const fp> max, std::span<__result_t<fp>> out)
+    {
+        __apply(val, max, out, [](fp x, fp y) { return sixit::dmath::mathf::fmod(x, y); });
+    }
+
+    template <typename fp>
+    void sign(std::span<const fp> in, std::span<int> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::sign(x); });
+    }
+
+    template <typename fp>
+    void isfinite(std::span<const fp> in, std::span<bool> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::isfinite(x); });
+    }
+
+    template <typename fp>
+    void min(std::span<const fp> a, std::span<const fp> b, std::span<fp> out)
+    {
+        __apply(a, b, out, [](fp x, fp y) { return sixit::dmath::mathf::min(x, y); });
+    }
+
+    template <typename fp>
+    void max(std::span<const fp> a, std::span<const fp> b, std::span<fp> out)
+    {
+        __apply(a, b, out, [](fp x, fp y) { return sixit::dmath::mathf::max(x, y); });
+    }
+
+    template <typename fp>
+    void log10(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::log10(x); });
+    }
+
+    template <typename fp>
+    void asin(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::asin(x); });
+    }
+
+    template <typename fp>
+    void acos(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::acos(x); });
+    }
+
+    template <typename fp>
+    void atan(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::atan(x); });
+    }
+
+    template <typename fp>
+    void atan2(std::span<const fp> y, std::span<const fp> x, std::span<decltype(sixit::dmath::mathf::atan2(std::declval<fp>(), std::declval<fp>()))> out)
+    {
+        __apply(y, x, out, [](fp a, fp b) { return sixit::dmath::mathf::atan2(a, b); });
+    }
+
+    template <typename fp>
+    void tan(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::tan(x); });
+    }
+
+    template <typename fp>
+    void exp2(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::exp2(x); });
+    }
+
+    template <typename fp>
+    void log2(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::log2(x); });
+    }
+
+    template <typename fp>
+    void pow(std::span<const fp> x, std::span<const fp> y, std::span<__result_t<fp>> out)
+    {
+        __apply(x, y, out, [](fp a, fp b) { return sixit::dmath::mathf::pow(a, b); });
+    }
+
+    template <typename fp>
+    void cbrt(std::span<const fp> in, std::span<__result_t<fp>> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::cbrt(x); });
+    }
+
+    template <typename fp>
+    void hypot(std::span<const fp> x, std::span<const fp> y, std::span<__result_t<fp>> out)
+    {
+        __apply(x, y, out, [](fp a, fp b) { return sixit::dmath::mathf::hypot(a, b); });
+    }
+
+    template <typename fp>
+    void sincos(std::span<const fp> in, std::span<__result_t<fp>> out_sin, std::span<__result_t<fp>> out_cos)
+    {
+        assert(in.size() == out_sin.size() && in.size() == out_cos.size());
+        const fp* src = in.data();
+        __result_t<fp>* dst_sin = out_sin.data();
+        __result_t<fp>* dst_cos = out_cos.data();
+        const size_t n = in.size();
+        for (size_t i = 0; i < n; ++i) {
+            auto [s, c] = sixit::dmath::mathf::sincos(src[i]);
+            dst_sin[i] = s;
+            dst_cos[i] = c;
+        }
+    }
+
+    template <typename fp>
+    void abs(std::span<const fp> in, std::span<fp> out)
+    {
+        __apply(in, out, [](fp x) { return sixit::dmath::mathf::abs(x); });
+    }
+
+    // arithmetic: out[i] = a[i] op b[i]; bit-identical to the scalar operators. Backends where each scalar
+    //   operation is an opaque call (ieee_float_static_lib) provide fp_traits<fp>::add_n() and friends,
+    //   which take the whole array in a single call (all of them, so that every entry point below can rely on its
+    //   own); everything else is a plain loop
+
+    template <typename fp>
+    concept __has_array_ops = requires(const fp* a, fp* out, size_t n) {
+        sixit::dmath::fp_traits<fp>::add_n(a, a, out, n);
+        sixit::dmath::fp_traits<fp>::subtract_n(a, a, out, n);
+        sixit::dmath::fp_traits<fp>::multiply_n(a, a, out, n);
+        sixit::dmath::fp_traits<fp>::divide_n(a, a, out, n);
+        sixit::dmath::fp_traits<fp>::mul_add_n(a, a, a, out, n);
+        sixit::dmath::fp_traits<fp>::fma_n(a, a, a, out, n);
+        sixit::dmath::fp_traits<fp>::dot_n(a, a, n);
+    };
+
+    template <typename fp>
+    void add(std::span<const fp> a, std::span<const fp> b, std::span<fp> out)
+    {
+        assert(a.size() == out.size() && b.size() == out.size());
+        if constexpr (__has_array_ops<fp>)
+            sixit::dmath::fp_traits<fp>::add_n(a.data(), b.data(), out.data(), out.size());
+        else
+            __apply(a, b, out, [](fp x, fp y) { return x + y; });
+    }
+
+    template <typename fp>
+    void subtract(std::span<const fp> a, std::span<const fp> b, std::span<fp> out)
+    {
+        assert(a.size() == out.size() && b.size() == out.size());
+        if constexpr (__has_array_ops<fp>)
+            sixit::dmath::fp_traits<fp>::subtract_n(a.data(), b.data(), out.data(), out.size());
+        else
+            __apply(a, b, out, [](fp x, fp y) { return x - y; });
+    }
+
+    template <typename fp>
+    void multiply(std::span<const fp> a, std::span<const fp> b, std::span<fp> out)
+    {
+        assert(a.size() == out.size() && b.size() == out.size());
+        if constexpr (__has_array_ops<fp>)
+            sixit::dmath::fp_traits<fp>::multiply_n(a.data(), b.data(), out.data(), out.size());
+        else
+            __apply(a, b, out, [](fp x, fp y) { return x * y; });
+    }
+
+    template <typename fp>
+    void divide(std::span<const fp> a, std::span<const fp> b, std::span<fp> out)
+    {
+        assert(a.size() == out.size() && b.size() == out.size());
+        if constexpr (__has_array_ops<fp>)
+            sixit::dmath::fp_traits<fp>::divide_n(a.data(), b.data(), out.data(), out.size());
+        else
+            __apply(a, b, out, [](fp x, fp y) { return x / y; });
+    }
+
+    // out[i] = a[i]*b[i] + c[i], rounded twice
+    template <typename fp>
+    void mul_add(std::span<const fp> a, std::span<const fp> b, std::span<const fp> c, std::span<fp> out)
+    {
+        assert(a.size() == out.size() && b.size() == out.size() && c.size() == out.size());
+        if constexpr (__has_array_ops<fp>) {
+            sixit::dmath::fp_traits<fp>::mul_add_n(a.data(), b.data(), c.data(), out.data(), out.size());
+        } else {
+            const size_t n = out.size();
+            for (size_t i = 0; i < n; ++i) {
+                fp m = a[i] * b[i];
+                out[i] = m + c[i];
+            }
+        }
+    }
+
+    // out[i] = fp_traits<fp>::fma(a[i], b[i], c[i]), rounded once
+    template <typename fp>
+    void fma(std::span<const fp> a, std::span<const fp> b, std::span<const fp> c, std::span<fp> out)
+    {
+        assert(a.size() == out.size() && b.size() == out.size() && c.size() == out.size());
+        if constexpr (__has_array_ops<fp>) {
+            sixit::dmath::fp_traits<fp>::fma_n(a.data(), b.data(), c.data(), out.data(), out.size());
+        } else {
+            const size_t n = out.size();
+            for (size_t i = 0; i < n; ++i)
+                out[i] = sixit::dmath::fp_traits<fp>::fma(a[i], b[i], c[i]);
+        }
+    }
+
+    // ((0 + a[0]*b[0]) + a[1]*b[1]) + ..., each operation rounded separately, strictly in this order
+    template <typename fp>
+    fp dot(std::span<const fp> a, std::span<const fp> b)
+    {
+        assert(a.size() == b.size());
+        if constexpr (__has_array_ops<fp>) {
+            return sixit::dmath::fp_traits<fp>::dot_n(a.data(), b.data(), a.size());
+        } else {
+            fp acc = fp(0.0f);
+            const size_t n = a.size();
+            for (size_t i = 0; i < n; ++i) {
+                fp m = a[i] * b[i];
+                acc = acc + m;
+            }
+            return acc;
+        }
+    }
+} //  sixit::dmath::mathf::batch
+
+#endif // sixit_dmath_mathf_batch_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
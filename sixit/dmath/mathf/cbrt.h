@@ -0,0 +1,130 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_math_operations_cbrt_h_included
+#define sixit_dmath_math_operations_cbrt_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename fp>
+    struct __cbrt_data {
+        static constexpr uint32_t B1 = 709958130; /* B1 = (127-127.0/3-0.03306235651)*2**23 */
+        static constexpr uint32_t B2 = 642849266; /* B2 = (127-127.0/3-24/3-0.03306235651)*2**23 */
+
+        static constexpr fp C = fp(float( 5.4285717010e-01)); /* 19/35     = 0x3f0af8b0 */
+        static constexpr fp D = fp(float(-7.0530611277e-01)); /* -864/1225 = 0xbf348ef1 */
+        static constexpr fp E = fp(float( 1.4142856598e+00)); /* 99/70     = 0x3fb50750 */
+        static constexpr fp F = fp(float( 1.6071428061e+00)); /* 45/28     = 0x3fcdb6db */
+        static constexpr fp G = fp(float( 3.5714286566e-01)); /* 5/14      = 0x3eb6db6e */
+    };
+
+    template <typename fp>
+    constexpr fp _cbrt(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::cbrt(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __cbrt_data<fp>;
+            fp r, s, t;
+            uint32_t hx, sign, high;
+
+            hx = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            sign = hx & 0x80000000;  /* sign= sign(x) */
+            hx ^= sign;
+            if (hx >= 0x7f800000)  /* cbrt(NaN,INF) is itself */
+                return x + x;
+            if (hx == 0)
+                return x;  /* cbrt(0) is itself */
+
+            x = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(hx);  /* x <- |x| */
+            /* rough cbrt to 5 bits */
+            if (hx < 0x00800000) {  /* subnormal number */
+                t = x * fp(0x1p24f);
+                high = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(t);
+                t = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(high/3 + d::B2);
+            } else
+                t = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(hx/3 + d::B1);
+
+            /* new cbrt to 23 bits */
+            r = t*t/x;
+            s = d::C + r*t;
+            t = t * (d::G + d::F/(s + d::E + d::D/s));
+
+            /* one more iteration (as in fdlibm's double cbrt()), to get the error below 1 ulp */
+            s = t*t;
+            r = x/s;
+            r = (r-t)/(t+t+r);
+            t = t + t*r;
+
+            /* restore the sign bit */
+            high = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(t);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(high | sign);
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto cbrt(fp x)
+    {
+        return _cbrt(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> cbrt(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ cbrt<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_math_operations_cbrt_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
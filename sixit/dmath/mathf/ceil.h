@@ -10,48 +10,47 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 
 namespace sixit::dmath::mathf
 {
-    template <typename fp> 
-    inline fp _ceil(fp val) 
+    /* ceil() on bits of x: the result is exact, so no fp operations are needed */
+    constexpr uint32_t __ceil_bits(uint32_t ix)
     {
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
+        int e = int((ix >> 23) & 0xff) - 0x7f;
+        uint32_t m;
+
+        if (e >= 23)  /* integral, inf or nan */
+            return ix;
+        if (e >= 0) {
+            m = 0x007fffff >> e;
+            if ((ix & m) == 0)
+                return ix;
+            if ((ix >> 31) == 0)
+                ix += m;
+            return ix & ~m;
+        }
+        /* |x| < 1 */
+        if (ix >> 31)
+            return 0x80000000;  /* -0 */
+        if (ix)
+            return 0x3f800000;  /* 1 */
+        return ix;
+    }
+
+    template <typename fp>
+    constexpr fp _ceil(fp val)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         if constexpr (std::is_same_v<float, fp>) {
             return std::ceil(val);
         } else {
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC                   
-            int e = sixit::dmath::fp_traits<fp>::get_exp(val);
-            uint32_t vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
-            uint32_t m;
-
-            if (e >= sixit::dmath::fp_traits<float>::significant_bit_count)
-                return val;
-            if (e >= 0) {
-                m = sixit::dmath::fp_traits<float>::significand_mask >> e;
-                if ((vali & m) == 0)
-                    return val;
-                if constexpr (std::is_same<fp, float>())
-                    force_eval_fp<fp>(val + fp(0x1p120f));
-                vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
-                if (!sixit::dmath::fp_traits<fp>::get_sign(val))
-                    vali += m;
-                vali &= ~m;
-                val = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(vali);
-            } else {
-                if constexpr (std::is_same<fp, float>())
-                    force_eval_fp<fp>(val + fp(0x1p120f));
-                vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
-                if (sixit::dmath::fp_traits<fp>::get_sign(val))
-                    val = fp(-0.0);
-                else if (!sixit::dmath::fp_traits<fp>::equal_to_zero(val))
-                    val = fp(1.f);
-            }
-            return val;
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC            
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__ceil_bits(ix));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         }
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC               
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
     }
 
     template <typename fp>
-    inline auto ceil(fp val) 
+    constexpr auto ceil(fp val)
     {
         return _ceil(sixit::dmath::fp_traits<fp>::to_fallback(val));
     }
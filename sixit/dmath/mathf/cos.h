@@ -33,7 +33,7 @@ namespace sixit::dmath::mathf
     };
 
     template <typename fp>
-    fp _cos(fp x)
+    constexpr fp _cos(fp x)
     {
 #ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
         if constexpr (std::is_same_v<float, fp>) {
@@ -97,9 +97,12 @@ namespace sixit::dmath::mathf
     }
 
     template <typename fp>
-    auto cos(fp x)
+    constexpr auto cos(fp x)
     {
-        return _cos(sixit::dmath::fp_traits<fp>::to_fallback(x));
+        if constexpr (__has_out_of_line_mathf<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_cos(x);
+        else
+            return _cos(sixit::dmath::fp_traits<fp>::to_fallback(x));
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
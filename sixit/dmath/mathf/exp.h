@@ -53,7 +53,7 @@ namespace sixit::dmath::mathf
 
 
     template <typename fp>
-    fp _exp(fp x)
+    constexpr fp _exp(fp x)
     {
 #ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
         if constexpr (std::is_same_v<float, fp>) {
@@ -109,9 +109,12 @@ namespace sixit::dmath::mathf
     }
 
     template <typename fp>
-    auto exp(fp x)
+    constexpr auto exp(fp x)
     {
-        return _exp(sixit::dmath::fp_traits<fp>::to_fallback(x));
+        if constexpr (__has_out_of_line_mathf<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_exp(x);
+        else
+            return _exp(sixit::dmath::fp_traits<fp>::to_fallback(x));
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
@@ -0,0 +1,158 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_math_operations_exp2_h_included
+#define sixit_dmath_math_operations_exp2_h_included
+
+#include "__utils.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename fp>
+    struct __exp2_data {
+        static constexpr fp huge  = fp(float(1.0e30));
+        static constexpr fp tiny  = fp(float(1.0e-30));
+        static constexpr fp P1 = fp(float( 1.6666667163e-01)); /* 0x3e2aaaab */
+        static constexpr fp P2 = fp(float(-2.7777778450e-03)); /* 0xbb360b61 */
+        static constexpr fp P3 = fp(float( 6.6137559770e-05)); /* 0x388ab355 */
+        static constexpr fp P4 = fp(float(-1.6533901999e-06)); /* 0xb5ddea0e */
+        static constexpr fp P5 = fp(float( 4.1381369442e-08)); /* 0x3331bb4c */
+        static constexpr fp lg2   = fp(float(6.9314718246e-01)); /* 0x3f317218 */
+        static constexpr fp lg2_h = fp(float(6.93145752e-01));   /* 0x3f317200 */
+        static constexpr fp lg2_l = fp(float(1.42860654e-06));   /* 0x35bfbe8c */
+    };
+
+    /*
+     * 2**(p_h+p_l), for -150 < p_h+p_l < 128 and |p_l| small compared to p_h
+     * (the tail of fdlibm powf(), shared by pow() and exp2()).
+     */
+    template <typename fp>
+    constexpr fp __exp2_hilo(fp p_h, fp p_l)
+    {
+        using d = __exp2_data<fp>;
+        fp t, u, v, w, z, r, t1;
+        int32_t i, j, k, n, is;
+
+        z = p_l + p_h;
+        j = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(z));
+        i = j & 0x7fffffff;
+        k = (i>>23) - 0x7f;
+        n = 0;
+        if (i > 0x3f000000) {   /* if |z| > 0.5, set n = [z+0.5] */
+            n = j + (0x00800000>>(k+1));
+            k = ((n&0x7fffffff)>>23) - 0x7f;  /* new k for n */
+            t = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(n & ~(0x007fffff>>k)));
+            n = ((n&0x007fffff)|0x00800000)>>(23-k);
+            if (j < 0)
+                n = -n;
+            p_h = p_h - t;
+        }
+        t = p_l + p_h;
+        is = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(t));
+        t = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(is) & 0xffff8000);
+        u = t*d::lg2_h;
+        v = (p_l-(t-p_h))*d::lg2 + t*d::lg2_l;
+        z = u + v;
+        w = v - (z - u);
+        t = z*z;
+        t1 = z - t*__horner(t, d::P1, d::P2, d::P3, d::P4, d::P5);
+        r = (z*t1)/(t1-fp(2.0f)) - (w+z*w);
+        z = fp(1.0f) - (r - z);
+        j = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(z));
+        j += int32_t(uint32_t(n)<<23);
+        if ((j>>23) <= 0)  /* subnormal output */
+            z = __scalbnf(z, n);
+        else
+            z = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(j));
+        return z;
+    }
+
+    template <typename fp>
+    constexpr fp _exp2(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::exp2(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __exp2_data<fp>;
+            uint32_t ix, hx;
+
+            ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            hx = ix & 0x7fffffff;
+            if (hx >= 0x43000000) {  /* |x| >= 128 or x is nan */
+                if (hx > 0x7f800000)  /* nan */
+                    return x + x;
+                if (ix == 0xff800000)  /* exp2(-inf) == 0 */
+                    return fp(0.0f);
+                if (!(ix >> 31))  /* x >= 128 */
+                    return d::huge*d::huge;  /* overflow */
+                if (ix >= 0xc3160000)  /* x <= -150 */
+                    return d::tiny*d::tiny;  /* underflow */
+            }
+            return __exp2_hilo(x, fp(0.0f));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto exp2(fp x)
+    {
+        return _exp2(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> exp2(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ exp2<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_math_operations_exp2_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
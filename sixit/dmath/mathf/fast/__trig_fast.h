@@ -0,0 +1,86 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * Shared parts of fast::sin() and fast::cos().
+ *
+ * Argument reduction for |x| >= pi/4 is the integer-only __rem_pio2f_int() from ../__rem_pio2f.h (there is no
+ * fp, and no host double, operation in it, so nothing for the compiler to contract into FMA); kernels are
+ * shorter minimax polynomials (degree 7 for sin and degree 6 for cos, vs 9 and 8 in ../__sindf.h and
+ * ../__cosdf.h) on [-pi/4, pi/4].
+ */
+#ifndef sixit_dmath_mathf_fast___trig_fast_h_included
+#define sixit_dmath_mathf_fast___trig_fast_h_included
+
+#include "../__utils.h"
+#include "../__rem_pio2f.h"
+
+namespace sixit::dmath::mathf::fast
+{
+    template <typename fp>
+    struct __trig_fast_data {
+        /* |sin(x)/x - (1 + x^2*(S1 + x^2*(S2 + x^2*S3)))| < 2^-27.9 on [-pi/4, pi/4] */
+        static constexpr fp S1 = fp(float(-0x1.555546p-3));
+        static constexpr fp S2 = fp(float( 0x1.110734p-7));
+        static constexpr fp S3 = fp(float(-0x1.9941c2p-13));
+
+        /* |cos(x) - (1 - x^2/2 + x^4*(C1 + x^2*C2))| / cos(x) < 2^-23.5 on [-pi/4, pi/4] */
+        static constexpr fp C1 = fp(float( 0x1.554994p-5));
+        static constexpr fp C2 = fp(float(-0x1.65c958p-10));
+    };
+
+    template <typename fp>
+    constexpr fp __sindf_fast(fp x)
+    {
+        using d = __trig_fast_data<fp>;
+        fp z = x * x;
+        fp s = z * x;
+        return x + s * __horner(z, d::S1, d::S2, d::S3);
+    }
+
+    template <typename fp>
+    constexpr fp __cosdf_fast(fp x)
+    {
+        using d = __trig_fast_data<fp>;
+        fp z = x * x;
+        return fp(1.0f) - (fp(0.5f) * z - (z * z) * __horner(z, d::C1, d::C2));
+    }
+} //  sixit::dmath::mathf::fast
+
+#endif // sixit_dmath_mathf_fast___trig_fast_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,176 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * atan2(y, x) is reduced to atan(t), t = min(|x|,|y|) / max(|x|,|y|) in [0, 1]; for t > tan(pi/8),
+ * atan(t) = pi/4 + atan((min-max)/(min+max)), so there is exactly one division, and atan() is needed on
+ * [-tan(pi/8), tan(pi/8)] only, where a degree 9 minimax polynomial is used (vs 4 intervals and atan(x) call
+ * with its own division in ../atan2.h). Reduction (the comparison with tan(pi/8) and the division, both exact
+ * on the mantissas, with u rounded once) and the final pi/4, pi/2, pi offsets (in 2^-61 units) are done on
+ * integers, so only the polynomial is evaluated in fp, the result is rounded once, and there is no host double
+ * arithmetic for the compiler to contract into FMA.
+ */
+#ifndef sixit_dmath_mathf_fast_atan2_h_included
+#define sixit_dmath_mathf_fast_atan2_h_included
+
+#include "../__utils.h"
+
+namespace sixit::dmath::mathf::fast
+{
+    template <typename fp>
+    struct __atan2_fast_data {
+        static constexpr uint64_t tanpio8 = 0x3504f333f9de6484;  /* tan(pi/8) * 2^63 */
+        static constexpr int64_t pio4 = 0x1921fb54442d1847;      /* pi/4 * 2^61 */
+        static constexpr int64_t pio2 = 0x3243f6a8885a308d;      /* pi/2 * 2^61 */
+        static constexpr int64_t pi   = 0x6487ed5110b4611a;      /* pi * 2^61 */
+
+        /* |atan(u)/u - (1 + u^2*(A0 + u^2*(A1 + u^2*(A2 + u^2*A3))))| < 2^-25.5 for |u| <= tan(pi/8) */
+        static constexpr fp A0 = fp(float(-0x1.555452p-2));
+        static constexpr fp A1 = fp(float( 0x1.992450p-3));
+        static constexpr fp A2 = fp(float(-0x1.1c3222p-3));
+        static constexpr fp A3 = fp(float( 0x1.49c06cp-4));
+    };
+
+    template <typename fp>
+    constexpr fp __atan_fast(fp u)
+    {
+        using d = __atan2_fast_data<fp>;
+        fp z = u * u;
+        return u + (u * z) * __horner(z, d::A0, d::A1, d::A2, d::A3);
+    }
+
+    /* mantissa (with bit 23 set) and exponent of a positive non-zero finite float */
+    constexpr uint64_t __atan2_fast_unpack(uint32_t bits, int* e)
+    {
+        uint32_t ex = bits >> 23;
+        uint64_t m = ex ? (bits & 0x007fffff) | 0x00800000 : bits;
+        int lz = std::countl_zero(m) - 40;
+        *e = (ex ? int(ex) : 1) - 150 - lz;
+        return m << lz;
+    }
+
+    template <typename fp>
+    constexpr fp _atan2_fast(fp y, fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::atan2(y, x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __atan2_fast_data<fp>;
+            uint32_t ix, iy, ax, ay, inum, iden;
+
+            ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            iy = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(y);
+            ax = ix & 0x7fffffff;
+            ay = iy & 0x7fffffff;
+            if (ax > 0x7f800000 || ay > 0x7f800000)  /* x or y is nan */
+                return x + y;
+
+            bool swap = ay > ax;
+            inum = swap ? ax : ay;
+            iden = swap ? ay : ax;
+            if (predict_false(iden == 0x7f800000 || iden == 0)) {
+                /* atan2(+-0, +-0), atan2(+-INF, +-INF) or atan2(+-finite, +-INF) and vice versa */
+                inum = inum == 0x7f800000 ? 0x3f800000 : 0;
+                iden = 0x3f800000;
+            }
+
+            /* z = atan(num/den); num = mn*2^en <= den = md*2^ed, so en <= ed */
+            bool big = false;
+            uint32_t ubits = 0;
+            if (inum != 0) {
+                int en, ed;
+                uint64_t mn = __atan2_fast_unpack(inum, &en);
+                uint64_t md = __atan2_fast_unpack(iden, &ed);
+                if (ed - en <= 2) {  /* otherwise num/den < 1/4 */
+                    /* num > den*tan(pi/8) <=> mn*2^(63+en-ed) > md*tanpio8 */
+                    int sh = 63 + en - ed;
+                    uint64_t lo;
+                    uint64_t hi = __umul64x64(md, d::tanpio8, &lo);
+                    uint64_t nhi = mn >> (64 - sh), nlo = mn << sh;
+                    big = nhi > hi || (nhi == hi && nlo > lo);
+                }
+                if (big) {
+                    /* u = (num-den)/(num+den) <= 0, on mantissas aligned to 2^(ed-2) */
+                    uint64_t a = mn << (en - ed + 2), b = md << 2;
+                    uint64_t dif = b - a, sum = a + b;
+                    if (dif != 0) {
+                        int lz = std::countl_zero(dif) - 1;
+                        uint64_t q = (dif << lz) / sum;
+                        ubits = __round_to_float_bits(1, q, -lz, q * sum != (dif << lz));
+                    }
+                } else {
+                    /* u = num/den */
+                    uint64_t q = (mn << 40) / md;
+                    ubits = __round_to_float_bits(0, q, en - ed - 40, q * md != (mn << 40));
+                }
+            }
+            uint32_t abits = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(__atan_fast(sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(ubits)));
+            if (!big && !swap && !(ix >> 31))  /* no offsets, z is the result */
+                return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(abits ^ (iy & 0x80000000));
+
+            int64_t z = __float_bits_to_fixed(abits, 61);
+            if (big)
+                z = d::pio4 + z;
+            if (swap)  /* atan(den/num) */
+                z = d::pio2 - z;
+            if (ix >> 31)  /* x < 0 */
+                z = d::pi - z;
+            /* z > 0 here */
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__round_to_float_bits(iy >> 31, uint64_t(z), -61));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto atan2(fp y, fp x)
+    {
+        return _atan2_fast(sixit::dmath::fp_traits<fp>::to_fallback(y), sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_ / dim_> atan2(sixit::units::dimensional_scalar<fp, dim_> a, sixit::units::dimensional_scalar<fp, dim_> b)
+    {
+        return sixit::units::dimensional_scalar<fp, dim_ / dim_>({ atan2<fp>(a.value, b.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf::fast
+
+#endif // sixit_dmath_mathf_fast_atan2_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * Same reduction as in ../exp.h (x*32/ln2 = k + r, with the same 2^(i/32) table), but done on integers:
+ * the 24-bit mantissa of x is multiplied by 32/ln2 in 64 bits, so k and r come out of one 64x64->128 bit
+ * multiplication, and 2^(k/32) is rounded to float straight from the bits of the table entry; as there is
+ * no host double arithmetic, there is nothing for the compiler to contract into FMA. 2^(r/32) is a degree 2
+ * minimax polynomial (vs 3), evaluated as s + s*r*(C1 + C2*r) to avoid rounding 1 + ... separately.
+ */
+#ifndef sixit_dmath_mathf_fast_exp_h_included
+#define sixit_dmath_mathf_fast_exp_h_included
+
+#include "../__utils.h"
+#include "../exp.h"
+
+namespace sixit::dmath::mathf::fast
+{
+    template <typename fp>
+    struct __exp_fast_data {
+        static constexpr uint64_t invln2_scaled = 0xb8aa3b295c17f0bc;  /* N/ln2 * 2^58, rounded to nearest */
+
+        /* stab[i] = bits of float(2^(i/N)), i.e. of exp_data<>::tab[i] rounded to float; as long as it stays normal,
+            float(2^(k/N)) is stab[k%N] with k/N added to its exponent */
+        static constexpr uint32_t stab[1 << EXP2F_TABLE_BITS] = {
+            0x3f800000, 0x3f82cd87, 0x3f85aac3, 0x3f88980f, 0x3f8b95c2, 0x3f8ea43a, 0x3f91c3d3, 0x3f94f4f0,
+            0x3f9837f0, 0x3f9b8d3a, 0x3f9ef532, 0x3fa27043, 0x3fa5fed7, 0x3fa9a15b, 0x3fad583f, 0x3fb123f6,
+            0x3fb504f3, 0x3fb8fbaf, 0x3fbd08a4, 0x3fc12c4d, 0x3fc5672a, 0x3fc9b9be, 0x3fce248c, 0x3fd2a81e,
+            0x3fd744fd, 0x3fdbfbb8, 0x3fe0ccdf, 0x3fe5b907, 0x3feac0c7, 0x3fefe4ba, 0x3ff5257d, 0x3ffa83b3,
+        };
+
+        /* |2^(r/N) - (1 + r*(C1 + r*C2))| / 2^(r/N) < 2^-24.1 for |r| <= 1/2 */
+        static constexpr fp C1 = fp(float(0x1.62e586p-6));
+        static constexpr fp C2 = fp(float(0x1.ebfea8p-13));
+    };
+
+    template <typename fp>
+    constexpr fp _exp_fast(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::exp(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = sixit::dmath::mathf::exp_data<fp>;
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            uint64_t ki, t;
+            fp r;
+
+            if (predict_false((ix & 0x7fffffff) >= 0x42b00000)) {  /* |x| >= 88 or x is nan */
+                if (ix == 0xff800000)  /* exp(-inf) == 0 */
+                    return fp(0.0f);
+                if ((ix & 0x7fffffff) >= 0x7f800000)  /* exp(inf) == inf, nan */
+                    return x + x;
+                if (x > fp(0x1.62e42ep6f))  /* x > log(0x1p128) ~= 88.72 */
+                    return __math_oflowf<fp>(0);
+                if (x < fp(-0x1.9fe368p6f))  /* x < log(0x1p-150) ~= -103.97 */
+                    return __math_uflowf<fp>(0);
+            }
+
+            /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k; with |x| = m*2^e, hi:lo = |x|*N/Ln2 * 2^sh */
+            uint32_t ex = (ix >> 23) & 0xff;
+            uint64_t m = ex ? (ix & 0x007fffff) | 0x00800000 : ix & 0x007fffff;
+            int sh = 58 + 150 - (ex ? int(ex) : 1);  /* >= 75, as |x| < 2^7 here */
+            uint64_t lo;
+            uint64_t hi = __umul64x64(m, __exp_fast_data<fp>::invln2_scaled, &lo);
+            uint64_t k = 0;
+            if (sh < 128) {
+                /* k = round(hi:lo / 2^sh), hi:lo -= k*2^sh; sh >= 64, so k*2^sh is in the upper word only */
+                uint64_t h = hi + (uint64_t(1) << (sh - 65));
+                k = h >> (sh - 64);
+                hi -= k << (sh - 64);
+            }
+            uint64_t neg = 0 - (hi >> 63);  /* remainder is negative; branchless, as the sign is unpredictable */
+            lo = (lo ^ neg) - neg;
+            hi = (hi ^ neg) + (neg & (lo == 0));
+            uint32_t rsign = (ix >> 31) ^ uint32_t(neg & 1);
+            r = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__round_to_float_bits(rsign, hi, lo, -sh));
+            ki = (ix >> 31) ? 0 - k : k;
+
+            /* exp(x) = 2^(k/N) * 2^(r/N) ~= s + s*r*(C1 + C2*r) */
+            auto poly = [r](fp s) { return s + (s * r) * (__exp_fast_data<fp>::C1 + __exp_fast_data<fp>::C2 * r); };
+            int32_t ks = int32_t(int64_t(ki) >> EXP2F_TABLE_BITS);
+            if (predict_true(ks >= -126 && ks < 127))  /* s = float(2^(k/N)) is normal */
+                return poly(sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(
+                    __exp_fast_data<fp>::stab[ki % N] + (uint32_t(ks) << 23)));
+
+            /* t is a normal double, 2^(k/N); s = float(t) rounded from its bits (subnormal for x < ~-87.3),
+                or float(t/2) if it doesn't fit into float */
+            t = d::tab[ki % N];
+            t += ki << (52 - EXP2F_TABLE_BITS);
+            uint64_t tm = (t & ((uint64_t(1) << 52) - 1)) | (uint64_t(1) << 52);
+            int te = int((t >> 52) & 0x7ff) - 1075;
+            if (te + 52 >= 127)  /* float(2^(k/N)) may overflow even if exp(x) does not */
+                return poly(sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__round_to_float_bits(0, tm, te - 1))) * fp(2.0f);
+            return poly(sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__round_to_float_bits(0, tm, te)));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto exp(fp x)
+    {
+        return _exp_fast(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> exp(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ exp<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf::fast
+
+#endif // sixit_dmath_mathf_fast_exp_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * Same scheme as in ../log.h: x = 2^k z, log(x) = k*ln2 + log(c) + log1p(z/c - 1), but with a 64-entry table
+ * (vs 16) the reduced argument is 4 times smaller, so log1p() needs only a degree 3 polynomial. Reduction and
+ * k*ln2 + log(c) + (z/c - 1) are done on integers (z*(1/c) is exact in 128 bits, the sum is in 2^-56 units),
+ * and rounded to float once; with no host double arithmetic, there is nothing for the compiler to contract
+ * into FMA, and only 5 fp operations are left.
+ */
+#ifndef sixit_dmath_mathf_fast_log_h_included
+#define sixit_dmath_mathf_fast_log_h_included
+
+#include "../__utils.h"
+
+namespace sixit::dmath::mathf::fast
+{
+    constexpr int LOGF_FAST_TABLE_BITS = 6;
+
+    template <typename fp>
+    struct __log_fast_data {
+        /* tab[i] = { 1/c * 2^62, log(c) * 2^56 }, c is near the (harmonic) center of the ith subinterval, c = 1 for
+           the one containing 1.0; 1/c * 2^62 is exact (1/c has 53 significant bits) */
+        static constexpr int64_t tab[1 << LOGF_FAST_TABLE_BITS][2] = {
+            { 0x5b0668792d54b000, -0x5a2d26cd356ea4 }, { 0x5a065277492b1400, -0x5758f1fea87c54 },
+            { 0x590bcdc2a50a7000, -0x548ca7aa9d6978 }, { 0x5816ac5fa2f04c00, -0x51c81bfded439c },
+            { 0x5726c247a2e15000, -0x4f0b248d83216c }, { 0x563be54ea38bf400, -0x4c5598471d1e1c },
+            { 0x5555ed0a88f64c00, -0x49a74f62d9c260 }, { 0x5474b2bbeac00000, -0x470023558522cc },
+            { 0x539811384dff0800, -0x445feec399e76c }, { 0x52bfe4d5b0ffa800, -0x41c68d74eb443c },
+            { 0x51ec0b5751400000, -0x3f33dc48edb316 }, { 0x511c63db95de4400, -0x3ca7b92b94f22e },
+            { 0x5050cecb0a670400, -0x3a22030abe746c }, { 0x4f892dc8577fc400, -0x37a299cc2009fe },
+            { 0x4ec563a128569400, -0x35295e43b31578 }, { 0x4e05543fed0d5400, -0x32b6322a9526dc },
+            { 0x4d48e49e6b87f400, -0x3048f816574e7e }, { 0x4c8ffab9111c8400, -0x2de19370b5e9e4 },
+            { 0x4bda7d82f8a44c00, -0x2b7fe86fb31622 }, { 0x4b2854da9957ac00, -0x2923dc0e0e51e6 },
+            { 0x4a79697f13b6a400, -0x26cd54041433d8 }, { 0x49cda50612860800, -0x247c36c0c16cc6 },
+            { 0x4924f1d2369fa000, -0x22306b63349968 }, { 0x487f3b0a04fb7000, -0x1fe9d9b46aafcb },
+            { 0x47dc6c8f4ef29800, -0x1da86a2142159b }, { 0x473c72f70d4b3c00, -0x1b6c05b4c0ac44 },
+            { 0x469f3b81a71f8c00, -0x193496129956a6 }, { 0x4604b4139e2c2800, -0x17020571edb4d4 },
+            { 0x456ccb2e9a816800, -0x14d43e98490181 }, { 0x44d76feacffae000, -0x12ab2cd4d12c2f },
+            { 0x444491f0b8408800, -0x1086bbfbab779b }, { 0x43b421731c6d4c00, -0x0e66d861920b52 },
+            { 0x43260f2969c8bc00, -0x0c4b6ed7980c8f }, { 0x429a4c4a4d4e3800, -0x0a346ca719f7db },
+            { 0x4210ca8692023400, -0x0821bf8dd814b7 }, { 0x41897c043e579400, -0x061355ba38fb39 },
+            { 0x41045359ed243c00, -0x04091dc7b24171 }, { 0x4081438a5edc5400, -0x020306bb558138 },
+            { 0x4000000000000000,  0x00000000000000 }, { 0x3f04e4a0464a6200,  0x03f4345286f241 },
+            { 0x3e106d514c2f3000,  0x07dce3db56be3e }, { 0x3d23427c03d23200,  0x0bb6861a72a91a },
+            { 0x3c3d11acfa6bfe00,  0x0f818d4727826d }, { 0x3b5d8d38b0b2be00,  0x133e66978dc14f },
+            { 0x3a846be426eca800,  0x16ed7a8a524814 }, { 0x39b16894cda20400,  0x1a8f2d2b428d06 },
+            { 0x38e4420722da8200,  0x1e23de530cbf14 }, { 0x381cba8b57ffe800,  0x21abe9e2999d46 },
+            { 0x375a97c76e3a8200,  0x2527a7fa5c03e4 }, { 0x369da27e46b46400,  0x28976d2de98d1c },
+            { 0x35e5a65b31f0f200,  0x2bfb8ab427e50a }, { 0x353271c1958a8800,  0x2f544e94538446 },
+            { 0x3483d5a04a656e00,  0x32a203d01e4f82 }, { 0x33d9a5485eec0200,  0x35e4f28b1f0492 },
+            { 0x3333b646f1597400,  0x391d602fc55c8c }, { 0x3291e041dd9a9c00,  0x3c4b8f920243c0 },
+            { 0x31f3fcd700fafc00,  0x3f6fc10fcf771a }, { 0x3159e77ddbc91c00,  0x428a32afbe28cc },
+            { 0x30c37d6b5e6f2600,  0x459b203db0fb0c }, { 0x30309d77b43e1e00,  0x48a2c365e29ce0 },
+            { 0x2fa12805e26c0400,  0x4ba153ce579b1c }, { 0x2f14feed15967400,  0x4e97072ed77d3c },
+            { 0x2e8c05637b886c00,  0x51841167870710 }, { 0x2e061fea8a168200,  0x5468a4963b6b84 },
+        };
+        static constexpr int64_t ln2 = 0xb17217f7d1cf7a;  /* ln2 * 2^56, rounded to nearest */
+
+        /* |log1p(r) - (r + r^2*(A0 + r*A1))| / |log1p(r)| < 2^-24.3 for |r| <= 1/128 */
+        static constexpr fp A0 = fp(float(-0x1.00020cp-1));
+        static constexpr fp A1 = fp(float( 0x1.55589cp-2));
+    };
+
+    template <typename fp>
+    constexpr fp _log_fast(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::log(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __log_fast_data<fp>;
+            uint32_t ix, iz, tmp;
+            int k, i;
+
+            ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            /* Fix sign of zero with downward rounding when x==1.  */
+            if (predict_false(ix == 0x3f800000))
+                return fp(0.0f);
+            if (predict_false(ix - 0x00800000 >= 0x7f800000 - 0x00800000)) {
+                /* x < 0x1p-126 or inf or nan.  */
+                if (ix * 2 == 0)
+                    return __math_divzerof<fp>(1);
+                if (ix == 0x7f800000) /* log(inf) == inf.  */
+                    return x;
+                if ((ix & 0x80000000) || ix * 2 >= 0xff000000)
+                    return (x - x) / (x - x);
+                /* x is subnormal, normalize it.  */
+                ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x * fp(0x1p23f));
+                ix -= 23 << 23;
+            }
+
+            /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.
+            The range is split into N subintervals.
+            The ith subinterval contains z and c is near its center.  */
+            tmp = ix - 0x3f330000;
+            i = (tmp >> (23 - LOGF_FAST_TABLE_BITS)) % (1 << LOGF_FAST_TABLE_BITS);
+            k = (int32_t)tmp >> 23; /* arithmetic shift */
+            iz = ix - (tmp & 0xff800000);
+
+            /* log(x) = log1p(z/c-1) + log(c) + k*Ln2, |z/c-1| <= 1/128; z = mz*2^(ez-150), so z/c-1 = hi:lo*2^(ez-212) */
+            uint32_t ez = iz >> 23;
+            uint64_t mz = (iz & 0x007fffff) | 0x00800000;
+            uint64_t lo;
+            uint64_t hi = __umul64x64(mz, uint64_t(d::tab[i][0]), &lo);
+            hi -= uint64_t(1) << (148 - ez);
+            uint32_t rsign = uint32_t(hi >> 63);
+            uint64_t neg = 0 - (hi >> 63);  /* branchless, as the sign is unpredictable */
+            lo = (lo ^ neg) - neg;
+            hi = (hi ^ neg) + (neg & (lo == 0));
+
+            /* y = k*Ln2 + log(c) + (z/c-1), in 2^-56 units (|y| < 2^7); (z/c-1) is rounded to them, and r = float(z/c-1)
+                is rounded from the same rd: it only feeds r*r*(A0 + r*A1), where the extra 2^-57 doesn't matter */
+            int sh = 156 - int(ez);
+            uint64_t lo_r = lo + (uint64_t(1) << (sh - 1));
+            hi += lo_r < lo;
+            int64_t rd = int64_t((hi << (64 - sh)) | (lo_r >> sh));
+            fp r = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__round_to_float_bits(rsign, uint64_t(rd), -56));
+            int64_t y = int64_t(k) * d::ln2 + d::tab[i][1] + ((rd ^ int64_t(neg)) - int64_t(neg));
+            uint64_t yneg = 0 - (uint64_t(y) >> 63);
+            uint32_t ybits = __round_to_float_bits(uint32_t(yneg & 1), (uint64_t(y) ^ yneg) - yneg, -56);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(ybits) + (r * r) * (d::A0 + r * d::A1);
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto log(fp x)
+    {
+        return _log_fast(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> log(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        return sixit::units::dimensional_scalar<fp, dim_>({ log<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf::fast
+
+#endif // sixit_dmath_mathf_fast_log_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -10,81 +10,90 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 
 namespace sixit::dmath::mathf
 {
-    template <typename fp> 
-    inline fp _fmod(fp val, fp max) 
+    /* fmod() on bits of x and y: the result is exact, so no fp operations are needed */
+    constexpr uint32_t __fmod_bits(uint32_t ux, uint32_t uy)
     {
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
-        if constexpr (std::is_same_v<float, fp>) {
-            return std::fmod(val, max);
-        } else {
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC       
-            int eval = sixit::dmath::fp_traits<fp>::get_exp(val) + 0x7f;
-            int emax = sixit::dmath::fp_traits<fp>::get_exp(max) + 0x7f;
-            uint32_t sval = sixit::dmath::fp_traits<fp>::get_sign(val);
-            uint32_t i;
-            uint32_t vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
-            uint32_t maxi = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(max);
-
-            if (sixit::dmath::fp_traits<fp>::equal_to_zero(max) || 
-                sixit::dmath::fp_traits<fp>::isnan(max) || 
-                sixit::dmath::fp_traits<fp>::isinf(val))
-                return (val * max) / (val * max);
-            if (vali << 1 <= maxi << 1) {
-                if (vali << 1 == maxi << 1)
-                    return fp(0.f) * val;
-                return val;
-            }
+        int ex = (ux >> 23) & 0xff;
+        int ey = (uy >> 23) & 0xff;
+        uint32_t sx = ux & 0x80000000;
+        uint32_t i;
+
+        if (uy << 1 == 0 || (uy & 0x7fffffff) > 0x7f800000 || ex == 0xff) {
+            /* y is +-0 or nan, or x is inf or nan: nan (quieted x or y if it is a nan, as (x*y)/(x*y) would do) */
+            if ((ux & 0x7fffffff) > 0x7f800000)
+                return ux | 0x00400000;
+            if ((uy & 0x7fffffff) > 0x7f800000)
+                return uy | 0x00400000;
+            return 0x7fc00000;
+        }
+        if (ux << 1 <= uy << 1) {
+            if (ux << 1 == uy << 1)
+                return sx;
+            return ux;
+        }
 
-            /* normalize x and y */
-            if (!eval) {
-                for (i = vali << 9 ; i >> 31 == 0; eval--, i <<= 1);
-                vali <<= -eval + 1;
-            } else {
-                vali &= 0xffffffff >> 9;
-                vali |= 1U << 23;
-            }
-            if (!emax) {
-                for (i = maxi << 9; i >> 31 == 0; emax--, i <<= 1);
-                maxi <<= -emax + 1;
-            } else {
-                maxi &= 0xffffffff >> 9;
-                maxi |= 1U << 23;
-            }
+        /* normalize x and y */
+        if (!ex) {
+            for (i = ux << 9; i >> 31 == 0; ex--, i <<= 1);
+            ux <<= -ex + 1;
+        } else {
+            ux &= 0xffffffff >> 9;
+            ux |= 1U << 23;
+        }
+        if (!ey) {
+            for (i = uy << 9; i >> 31 == 0; ey--, i <<= 1);
+            uy <<= -ey + 1;
+        } else {
+            uy &= 0xffffffff >> 9;
+            uy |= 1U << 23;
+        }
 
-            /* x mod y */
-            for (; eval > emax; eval--) {
-                i = vali - maxi;
-                if (i >> 31 == 0) {
-                    if (i == 0)
-                        return fp(0.f) * val;
-                    vali = i;
-                }
-                vali <<= 1;
-            }
-            i = vali - maxi;
+        /* x mod y */
+        for (; ex > ey; ex--) {
+            i = ux - uy;
             if (i >> 31 == 0) {
                 if (i == 0)
-                    return fp(0.f) * val;
-                vali = i;
+                    return sx;
+                ux = i;
             }
-            for (; vali >> 23 == 0; vali <<= 1, eval--);
-
-            /* scale result up */
-            if (eval > 0) {
-                vali -= 1U << 23;
-                vali |= (uint32_t) eval << 23;
-            } else {
-                vali >>= -eval + 1;
-            }
-            val = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(vali);
-            return sval ? -val : val;
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC            
+            ux <<= 1;
+        }
+        i = ux - uy;
+        if (i >> 31 == 0) {
+            if (i == 0)
+                return sx;
+            ux = i;
+        }
+        for (; ux >> 23 == 0; ux <<= 1, ex--);
+
+        /* scale result up */
+        if (ex > 0) {
+            ux -= 1U << 23;
+            ux |= (uint32_t) ex << 23;
+        } else {
+            ux >>= -ex + 1;
+        }
+        return ux | sx;
+    }
+
+    template <typename fp>
+    constexpr fp _fmod(fp val, fp max)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::fmod(val, max);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
+            uint32_t maxi = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(max);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__fmod_bits(vali, maxi));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         }
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC               
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
     }
 
     template <typename fp>
-    inline auto fmod(fp val, fp max)
+    constexpr auto fmod(fp val, fp max)
     {
         return _fmod(sixit::dmath::fp_traits<fp>::to_fallback(val), sixit::dmath::fp_traits<fp>::to_fallback(max));
     }
@@ -0,0 +1,149 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/*
+ * fdlibm's float hypotf(): x*x+y*y is computed exactly enough via splitting the larger argument
+ * into hi+lo halves, so (unlike current MUSL) no double intermediates are necessary.
+ */
+#ifndef sixit_dmath_math_operations_hypot_h_included
+#define sixit_dmath_math_operations_hypot_h_included
+
+#include "__utils.h"
+#include "sqrt.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename fp>
+    constexpr fp _hypot(fp x, fp y)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::hypot(x, y);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            fp a, b, t1, t2, y1, y2, w;
+            int32_t j, k, ha, hb;
+
+            ha = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x) & 0x7fffffff);
+            hb = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(y) & 0x7fffffff);
+            if (hb > ha) {
+                j = ha; ha = hb; hb = j;
+            }
+            a = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(ha));  /* a <- |a| */
+            b = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(hb));  /* b <- |b| */
+            if (ha >= 0x7f800000) {  /* Inf or NaN */
+                if (ha == 0x7f800000)
+                    return a;
+                if (hb == 0x7f800000)
+                    return b;
+                return x + y;  /* NaN */
+            }
+            if ((ha-hb) > 0xf000000)  /* a/b > 2**30 */
+                return a+b;
+            k = 0;
+            if (ha > 0x58800000) {  /* a > 2**50 */
+                /* scale a and b by 2**-68 */
+                ha -= 0x22000000; hb -= 0x22000000; k += 68;
+                a = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(ha));
+                b = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(hb));
+            }
+            if (hb < 0x26800000) {  /* b < 2**-50 */
+                if (hb <= 0x007fffff) {  /* subnormal b or 0 */
+                    if (hb == 0)
+                        return a;
+                    t1 = fp(0x1p126f);
+                    b = b * t1;
+                    a = a * t1;
+                    k -= 126;
+                } else {  /* scale a and b by 2^68 */
+                    ha += 0x22000000;  /* a *= 2^68 */
+                    hb += 0x22000000;  /* b *= 2^68 */
+                    k -= 68;
+                    a = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(ha));
+                    b = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(hb));
+                }
+            }
+            /* medium size a and b */
+            w = a-b;
+            if (w > b) {
+                ha = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(a));
+                t1 = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(ha) & 0xfffff000);
+                t2 = a-t1;
+                w  = _sqrt(t1*t1-(b*(-b)-t2*(a+t1)));
+            } else {
+                ha = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(a));
+                hb = int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(b));
+                a  = a+a;
+                y1 = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(hb) & 0xfffff000);
+                y2 = b - y1;
+                t1 = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(ha + 0x00800000) & 0xfffff000);
+                t2 = a - t1;
+                w  = _sqrt(t1*y1-(w*(-w)-(t1*y2+t2*b)));
+            }
+            if (k != 0)
+                return w * sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(0x3f800000 + (k<<23)));
+            return w;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto hypot(fp x, fp y)
+    {
+        return _hypot(sixit::dmath::fp_traits<fp>::to_fallback(x), sixit::dmath::fp_traits<fp>::to_fallback(y));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline sixit::units::dimensional_scalar<fp, dim_> hypot(sixit::units::dimensional_scalar<fp, dim_> x, sixit::units::dimensional_scalar<fp, dim_> y)
+    {
+        return sixit::units::dimensional_scalar<fp, dim_>({ hypot<fp>(x.value, y.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_math_operations_hypot_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -99,7 +99,10 @@ namespace sixit::dmath::mathf
     template <typename fp>
     auto log(fp x)
     {
-        return _log(sixit::dmath::fp_traits<fp>::to_fallback(x));
+        if constexpr (__has_out_of_line_mathf<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_log(x);
+        else
+            return _log(sixit::dmath::fp_traits<fp>::to_fallback(x));
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
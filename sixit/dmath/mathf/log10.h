@@ -56,7 +56,7 @@ namespace sixit::dmath::mathf
                     return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(0x7fc0'0000);// (x - x) / fp(0.0f); /* log(-#) = NaN */
                 /* subnormal number, scale up x */
                 k -= 25;
-                x *= 0x1p25f;
+                x = x * fp(0x1p25f);
                 uf = x;
                 ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(uf);
             } else if (ix >= 0x7f800000) {
@@ -8,12 +8,18 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 #define sixit_dmath_mathf_mathf_h_included
 
 #include "sqrt.h"
+#include "rsqrt.h"
+#include "recip.h"
 #include "round.h"
 #include "ceil.h"
 #include "floor.h"
 #include "fmod.h"
 #include "trunc.h"
 #include "exp.h"
+#include "exp2.h"
+#include "pow.h"
+#include "cbrt.h"
+#include "hypot.h"
 
 #include "sign.h"
 #include "isfinite.h"
@@ -23,6 +29,7 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 
 #include "log.h"
 #include "log10.h"
+#include "log2.h"
 
 #include "asin.h"
 #include "acos.h"
@@ -32,9 +39,20 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 #include "sin.h"
 #include "cos.h"
 #include "tan.h"
+#include "sincos.h"
 
 #include "abs.h"
 
+#include "simd/sin.h"
+#include "simd/cos.h"
+#include "simd/exp.h"
+#include "simd/log.h"
+
+#include "fast/fast.h"
+#include "tabled/tabled.h"
+
+#include "batch.h"
+
 #endif //sixit_dmath_mathf_mathf_h_included
 
 /*
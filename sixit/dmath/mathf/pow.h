@@ -0,0 +1,298 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/*
+ * fdlibm's table-free float powf() (as in MUSL before 1.1.20): log2(|x|) is computed as a hi+lo pair
+ * of floats, multiplied by y, and 2**(hi+lo) is computed by __exp2_hilo() (see exp2.h). Newer MUSL
+ * versions compute the same in double, which is not available for all fp's.
+ */
+#ifndef sixit_dmath_math_operations_pow_h_included
+#define sixit_dmath_math_operations_pow_h_included
+
+#include "__utils.h"
+#include "exp2.h"
+#include "sqrt.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename fp>
+    struct __pow_data {
+        static constexpr fp bp[]   = {fp(1.0f), fp(1.5f),};
+        static constexpr fp dp_h[] = {fp(0.0f), fp(float(5.84960938e-01)),}; /* 0x3f15c000 */
+        static constexpr fp dp_l[] = {fp(0.0f), fp(float(1.56322085e-06)),}; /* 0x35d1cfdc */
+        static constexpr fp two24  = fp(float(16777216.0)); /* 0x4b800000 */
+        /* poly coefs for (3/2)*(log(x)-2s-2/3*s**3 */
+        static constexpr fp L1 = fp(float(6.0000002384e-01)); /* 0x3f19999a */
+        static constexpr fp L2 = fp(float(4.2857143283e-01)); /* 0x3edb6db7 */
+        static constexpr fp L3 = fp(float(3.3333334327e-01)); /* 0x3eaaaaab */
+        static constexpr fp L4 = fp(float(2.7272811532e-01)); /* 0x3e8ba305 */
+        static constexpr fp L5 = fp(float(2.3066075146e-01)); /* 0x3e6c3255 */
+        static constexpr fp L6 = fp(float(2.0697501302e-01)); /* 0x3e53f142 */
+        static constexpr fp ovt     = fp(float(4.2995665694e-08)); /* -(128-log2(ovfl+.5ulp)) */
+        static constexpr fp cp      = fp(float( 9.6179670095e-01)); /* 0x3f763aac =2/(3ln2) */
+        static constexpr fp cp_h    = fp(float( 9.6191406250e-01)); /* 0x3f764000 =12b cp */
+        static constexpr fp cp_l    = fp(float(-1.1736857402e-04)); /* 0xb8f623c6 =tail of cp_h */
+        static constexpr fp ivln2   = fp(float( 1.4426950216e+00)); /* 0x3fb8aa3b =1/ln2 */
+        static constexpr fp ivln2_h = fp(float( 1.4426879883e+00)); /* 0x3fb8aa00 =16b 1/ln2*/
+        static constexpr fp ivln2_l = fp(float( 7.0526075433e-06)); /* 0x36eca570 =1/ln2 tail*/
+    };
+
+    template <typename fp>
+    constexpr fp __pow_setword(int32_t i)
+    {
+        return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(uint32_t(i));
+    }
+
+    template <typename fp>
+    constexpr int32_t __pow_getword(fp x)
+    {
+        return int32_t(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x));
+    }
+
+    template <typename fp>
+    constexpr fp _pow(fp x, fp y)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return std::pow(x, y);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __pow_data<fp>;
+            using e = __exp2_data<fp>;
+            fp z,ax,z_h,z_l,p_h,p_l;
+            fp y1,t1,t2,r,s,sn,t,u,v,w;
+            int32_t j,k,yisint,n;
+            int32_t hx,hy,ix,iy,is;
+
+            hx = __pow_getword(x);
+            hy = __pow_getword(y);
+            ix = hx & 0x7fffffff;
+            iy = hy & 0x7fffffff;
+
+            /* x**0 = 1, even if x is NaN */
+            if (iy == 0)
+                return fp(1.0f);
+            /* 1**y = 1, even if y is NaN */
+            if (hx == 0x3f800000)
+                return fp(1.0f);
+            /* NaN if either arg is NaN */
+            if (ix > 0x7f800000 || iy > 0x7f800000)
+                return x + y;
+
+            /* determine if y is an odd int when x < 0
+             * yisint = 0       ... y is not an integer
+             * yisint = 1       ... y is an odd int
+             * yisint = 2       ... y is an even int
+             */
+            yisint  = 0;
+            if (hx < 0) {
+                if (iy >= 0x4b800000)
+                    yisint = 2; /* even integer y */
+                else if (iy >= 0x3f800000) {
+                    k = (iy>>23) - 0x7f;         /* exponent */
+                    j = iy>>(23-k);
+                    if ((j<<(23-k)) == iy)
+                        yisint = 2 - (j & 1);
+                }
+            }
+
+            /* special value of y */
+            if (iy == 0x7f800000) {  /* y is +-inf */
+                if (ix == 0x3f800000)      /* (-1)**+-inf is 1 */
+                    return fp(1.0f);
+                else if (ix > 0x3f800000)  /* (|x|>1)**+-inf = inf,0 */
+                    return hy >= 0 ? y : fp(0.0f);
+                else                       /* (|x|<1)**+-inf = 0,inf */
+                    return hy >= 0 ? fp(0.0f) : -y;
+            }
+            if (iy == 0x3f800000)    /* y is +-1 */
+                return hy >= 0 ? x : fp(1.0f)/x;
+            if (hy == 0x40000000)    /* y is 2 */
+                return x*x;
+            if (hy == 0x3f000000) {  /* y is  0.5 */
+                if (hx >= 0)     /* x >= +0 */
+                    return _sqrt(x);
+            }
+
+            ax = __pow_setword<fp>(ix);
+            /* special value of x */
+            if (ix == 0x7f800000 || ix == 0 || ix == 0x3f800000) { /* x is +-0,+-inf,+-1 */
+                z = ax;
+                if (hy < 0)  /* z = (1/|x|) */
+                    z = fp(1.0f)/z;
+                if (hx < 0) {
+                    if (((ix-0x3f800000)|yisint) == 0) {
+                        z = (z-z)/(z-z); /* (-1)**non-int is NaN */
+                    } else if (yisint == 1)
+                        z = -z;          /* (x<0)**odd = -(|x|**odd) */
+                }
+                return z;
+            }
+
+            sn = fp(1.0f); /* sign of result */
+            if (hx < 0) {
+                if (yisint == 0) /* (x<0)**(non-int) is NaN */
+                    return (x-x)/(x-x);
+                if (yisint == 1) /* (x<0)**(odd int) */
+                    sn = fp(-1.0f);
+            }
+
+            /* |y| is huge */
+            if (iy > 0x4d000000) { /* if |y| > 2**27 */
+                /* over/underflow if x is not close to one */
+                if (ix < 0x3f7ffff8)
+                    return hy < 0 ? sn*e::huge*e::huge : sn*e::tiny*e::tiny;
+                if (ix > 0x3f800007)
+                    return hy > 0 ? sn*e::huge*e::huge : sn*e::tiny*e::tiny;
+                /* now |1-x| is tiny <= 2**-20, suffice to compute
+                   log(x) by x-x^2/2+x^3/3-x^4/4 */
+                t = ax - fp(1.0f);     /* t has 20 trailing zeros */
+                w = (t*t)*(fp(0.5f) - t*(fp(float(0.333333333333)) - t*fp(0.25f)));
+                u = d::ivln2_h*t;  /* ivln2_h has 16 sig. bits */
+                v = t*d::ivln2_l - w*d::ivln2;
+                t1 = u + v;
+                is = __pow_getword(t1);
+                t1 = __pow_setword<fp>(is & 0xfffff000);
+                t2 = v - (t1-u);
+            } else {
+                fp s2,s_h,s_l,t_h,t_l;
+                n = 0;
+                /* take care subnormal number */
+                if (ix < 0x00800000) {
+                    ax = ax * d::two24;
+                    n -= 24;
+                    ix = __pow_getword(ax);
+                }
+                n += ((ix)>>23) - 0x7f;
+                j = ix & 0x007fffff;
+                /* determine interval */
+                ix = j | 0x3f800000;     /* normalize ix */
+                if (j <= 0x1cc471)       /* |x|<sqrt(3/2) */
+                    k = 0;
+                else if (j < 0x5db3d7)   /* |x|<sqrt(3)   */
+                    k = 1;
+                else {
+                    k = 0;
+                    n += 1;
+                    ix -= 0x00800000;
+                }
+                ax = __pow_setword<fp>(ix);
+
+                /* compute s = s_h+s_l = (x-1)/(x+1) or (x-1.5)/(x+1.5) */
+                u = ax - d::bp[k];   /* bp[0]=1.0, bp[1]=1.5 */
+                v = fp(1.0f)/(ax+d::bp[k]);
+                s = u*v;
+                s_h = s;
+                is = __pow_getword(s_h);
+                s_h = __pow_setword<fp>(is & 0xfffff000);
+                /* t_h=ax+bp[k] High */
+                is = ((ix>>1) & 0xfffff000) | 0x20000000;
+                t_h = __pow_setword<fp>(is + 0x00400000 + (k<<21));
+                t_l = ax - (t_h - d::bp[k]);
+                s_l = v*((u - s_h*t_h) - s_h*t_l);
+                /* compute log(ax) */
+                s2 = s*s;
+                r = s2*s2*(d::L1+s2*(d::L2+s2*(d::L3+s2*(d::L4+s2*(d::L5+s2*d::L6)))));
+                r = r + s_l*(s_h+s);
+                s2 = s_h*s_h;
+                t_h = fp(3.0f) + s2 + r;
+                is = __pow_getword(t_h);
+                t_h = __pow_setword<fp>(is & 0xfffff000);
+                t_l = r - ((t_h - fp(3.0f)) - s2);
+                /* u+v = s*(1+...) */
+                u = s_h*t_h;
+                v = s_l*t_h + t_l*s;
+                /* 2/(3log2)*(s+...) */
+                p_h = u + v;
+                is = __pow_getword(p_h);
+                p_h = __pow_setword<fp>(is & 0xfffff000);
+                p_l = v - (p_h - u);
+                z_h = d::cp_h*p_h;  /* cp_h+cp_l = 2/(3*log2) */
+                z_l = d::cp_l*p_h + p_l*d::cp+d::dp_l[k];
+                /* log2(ax) = (s+..)*2/(3*log2) = n + dp_h + z_h + z_l */
+                t = fp(float(n));
+                t1 = (((z_h + z_l) + d::dp_h[k]) + t);
+                is = __pow_getword(t1);
+                t1 = __pow_setword<fp>(is & 0xfffff000);
+                t2 = z_l - (((t1 - t) - d::dp_h[k]) - z_h);
+            }
+
+            /* split up y into y1+y2 and compute (y1+y2)*(t1+t2) */
+            is = __pow_getword(y);
+            y1 = __pow_setword<fp>(is & 0xfffff000);
+            p_l = (y-y1)*t1 + y*t2;
+            p_h = y1*t1;
+            z = p_l + p_h;
+            j = __pow_getword(z);
+            if (j > 0x43000000)          /* if z > 128 */
+                return sn*e::huge*e::huge;  /* overflow */
+            else if (j == 0x43000000) {  /* if z == 128 */
+                if (p_l + d::ovt > z - p_h)
+                    return sn*e::huge*e::huge;  /* overflow */
+            } else if ((j&0x7fffffff) > 0x43160000)  /* z < -150 */
+                return sn*e::tiny*e::tiny;  /* underflow */
+            else if (uint32_t(j) == 0xc3160000) {  /* z == -150 */
+                if (p_l <= z-p_h)
+                    return sn*e::tiny*e::tiny;  /* underflow */
+            }
+
+            /* compute 2**(p_h+p_l) */
+            return sn*__exp2_hilo(p_h, p_l);
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto pow(fp x, fp y)
+    {
+        return _pow(sixit::dmath::fp_traits<fp>::to_fallback(x), sixit::dmath::fp_traits<fp>::to_fallback(y));
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_math_operations_pow_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * recip(x) = 1/x, correctly rounded (to nearest), on integers only: SoftFloat's softfloat_approxRecip32_1()
+ * (the same one f32_div() uses) gives 1/m with 32 bits, and an exact check of which side of the midpoint
+ * between two candidate floats 1/m is fixes the last bit. So the result is bit-identical to fp(1.f)/x
+ * for all the fp classes (including subnormal and infinite results), without going through the division.
+ */
+#ifndef sixit_dmath_mathf_recip_h_included
+#define sixit_dmath_mathf_recip_h_included
+
+#include <bit>
+#include <cstdint>
+#include "__utils.h"
+#include "sixit/dmath/softfloat/softfloat_functions.h"
+
+namespace sixit::dmath::mathf
+{
+    constexpr uint32_t __recip_bits(uint32_t ix)
+    {
+        uint32_t sign = ix & 0x80000000;
+        uint64_t M, q;
+        int e;
+
+        ix &= 0x7fffffff;
+        e = int(ix >> 23) - 0x7f;
+        if (predict_false(ix - 0x00800000 >= 0x7f800000 - 0x00800000)) {
+            /* x < 0x1p-126 or inf or nan.  */
+            if (ix == 0)
+                return sign | 0x7f800000;
+            if (ix == 0x7f800000)
+                return sign;
+            if (ix > 0x7f800000)
+                return sign | ix | 0x00400000;
+            /* x is subnormal (and 1/x > 2^126), normalize it.  */
+            int shift = std::countl_zero(ix) - 8;
+            e = -126 - shift;
+            ix <<= shift;
+        }
+
+        /* x = M*2^(e-23), M in [2^23, 2^24); 1/x = 2^24/M * 2^(-24-e) */
+        M = (ix & 0x007fffff) | 0x00800000;
+        if (predict_false(e >= 126)) {
+            /* subnormal (or the smallest normal) result: round 2^(172-e)/M to integer, no ties */
+            uint64_t n = uint64_t(1) << (172 - e);
+            return sign | uint32_t((2*n + M) / (2*M));
+        }
+        if (predict_false(e <= -129))  /* 1/x >= 2^128 */
+            return sign | 0x7f800000;
+
+        /* q ~ 2^24/M * 2^23 is either floor() of it, or one less, so rounding it up iff
+           2^47/M > q + 1/2, i.e. iff 2^48 > (2q+1)*M, gives correct result; no ties.  */
+        using namespace sixit::dmath::softfloat;  // softfloat_approxRecip32_1 may be a macro
+        q = softfloat_approxRecip32_1(uint32_t(M << 8)) >> 8;
+        q += ((2*q + 1) * M) < (uint64_t(1) << 48);
+
+        /* if q rounded up to 2^24 (M == 2^23), or e == -128 overflows, adding it to the exponent
+           gives the right power of 2 and infinity, respectively */
+        return sign | ((uint32_t(0x7f - 2 - e) << 23) + uint32_t(q));
+    }
+
+    template <typename fp>
+    constexpr fp _recip(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return 1.f / x;
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__recip_bits(ix));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    // fixed_point provides its own (integer division, returning fixed_point) as fp_traits<fp>::mathf_recip()
+    template <typename fp>
+    concept __has_mathf_recip = requires(fp x) { sixit::dmath::fp_traits<fp>::mathf_recip(x); };
+
+    template <typename fp>
+    constexpr auto recip(fp x)
+    {
+        if constexpr (__has_mathf_recip<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_recip(x);
+        else
+            return _recip(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline auto recip(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        return sixit::units::dimensional_scalar<fp, (dim_ / dim_) / dim_>({ recip<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf
+
+#endif //sixit_dmath_mathf_recip_h_included
+
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -10,45 +10,41 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 
 namespace sixit::dmath::mathf
 {
+    /* round() (halfway cases away from zero) on bits of x: the result is exact, so no fp operations are needed */
+    constexpr uint32_t __round_bits(uint32_t ix)
+    {
+        int e = int((ix >> 23) & 0xff) - 0x7f;
+        uint32_t m;
+
+        if (e >= 23)  /* integral, inf or nan */
+            return ix;
+        if (e < -1)  /* |x| < 0.5 */
+            return ix & 0x80000000;
+        if (e == -1)  /* 0.5 <= |x| < 1 */
+            return (ix & 0x80000000) | 0x3f800000;
+        /* adding 0.5 to |x| may carry into the exponent, which is still right */
+        m = 0x007fffff >> e;
+        ix += 0x00400000 >> e;
+        return ix & ~m;
+    }
+
     template <typename fp>
-    inline fp _round(fp val)
+    constexpr fp _round(fp val)
     {
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
-        if constexpr (std::is_same_v<float, fp>)
-        {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
             return std::round(val);
         } else {
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC                  
-
-            int e = sixit::dmath::fp_traits<fp>::get_exp(val);
-            fp y;
-
-            if (e >= 23)
-                return val;
-            if (sixit::dmath::fp_traits<fp>::get_sign(val))
-                val = -val;
-            if (e < -1) {
-                if constexpr (std::is_same<fp, float>())
-                    force_eval_fp<fp>(val + fp(0x1p120f));
-                return  fp(0.f) * val;
-            }
-            y = val + fp(0x1p120f) - fp(0x1p120f) - val;
-            if (y > fp(0.5f))
-                y = y + val - fp(1.f);
-            else if (y <= fp(-0.5f))
-                y = y + val + fp(1.f);
-            else
-                y = y + val;
-            if (sixit::dmath::fp_traits<fp>::get_sign(val))
-                y = -y;
-            return y;
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC            
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__round_bits(ix));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         }
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC               
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
     }
 
     template <typename fp>
-    inline auto round(fp val)
+    constexpr auto round(fp val)
     {
         return _round(sixit::dmath::fp_traits<fp>::to_fallback(val));
     }
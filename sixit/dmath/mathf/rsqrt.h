@@ -0,0 +1,149 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * rsqrt(x) = 1/sqrt(x), correctly rounded (to nearest), on integers only: the same __rsqrt_tab and Goldschmidt
+ * iterations as in ./sqrt.h (with one more iteration for r ~ 1/sqrt(m)), followed by an exact check of which
+ * side of the midpoint between two candidate floats 1/sqrt(m) is. So the result is fully defined by IEEE
+ * (and is the same for all the fp classes, and both faster and more accurate than 1/sqrt(x) in fp):
+ *   rsqrt(+-0) = +-inf, rsqrt(+inf) = +0, rsqrt(x < 0) = default nan (0x7fc00000), rsqrt(nan) = quieted nan.
+ */
+#ifndef sixit_dmath_mathf_rsqrt_h_included
+#define sixit_dmath_mathf_rsqrt_h_included
+
+#include <bit>
+#include <cstdint>
+#include "__utils.h"
+#include "sqrt.h"
+
+namespace sixit::dmath::mathf
+{
+    constexpr uint32_t __rsqrt_bits(uint32_t ix)
+    {
+        uint32_t m, m1, m0, even;
+        int e, k;
+
+        auto mul32 = [](uint32_t a, uint32_t b)
+        {
+            return uint32_t(((uint64_t)a * b) >> 32);
+        };
+
+        e = int(ix >> 23) - 0x7f;
+        if (predict_false(ix - 0x00800000 >= 0x7f800000 - 0x00800000)) {
+            /* x < 0x1p-126 or inf or nan.  */
+            if (ix * 2 == 0)  /* +-0 */
+                return ix | 0x7f800000;
+            if (ix == 0x7f800000)
+                return 0;
+            if ((ix & 0x7fffffff) > 0x7f800000)
+                return ix | 0x00400000;
+            if (ix > 0x7f800000)  /* x < 0 */
+                return 0x7fc00000;
+            /* x is subnormal, normalize it.  */
+            int shift = std::countl_zero(ix) - 8;
+            e = -126 - shift;
+            ix = ((ix << shift) & 0x007fffff) | (uint32_t(e + 0x7f) & 1) << 23;
+        }
+
+        /* x = 4^k m; with int k and m in [1, 4), 1/sqrt(x) = 2^-k/sqrt(m), 1/sqrt(m) in (1/2, 1].  */
+        k = e >> 1;
+        even = ix & 0x00800000;
+        m1 = (ix << 8) | 0x80000000;
+        m0 = (ix << 7) & 0x7fffffff;
+        m = even ? m0 : m1;
+
+        /* compute r ~ 1/sqrt(m) with 3 goldschmidt iterations (s ~ sqrt(m) is needed for them).  */
+        constexpr uint32_t three = 0xc0000000;
+        uint32_t r, s, d, u, i;
+        i = (ix >> 17) % 128;
+        r = (uint32_t)__rsqrt_tab[i] << 16;
+        /* |r*sqrt(m) - 1| < 0x1p-8 */
+        s = mul32(m, r);
+        d = mul32(s, r);
+        u = three - d;
+        r = mul32(r, u) << 1;
+        s = mul32(s, u) << 1;
+        /* |r*sqrt(m) - 1| < 0x1.7bp-16 */
+        d = mul32(s, r);
+        u = three - d;
+        r = mul32(r, u) << 1;
+        /* |r*2^-32 - 1/sqrt(m)| < 2^-29, i.e. less than 1/32 of the result's ulp */
+
+        /* q ~ 1/sqrt(m) * 2^24 is either floor() of it, or off by one (when it is within 1/32 from an integer),
+           so rounding it up iff 1/sqrt(m) * 2^24 > q + 1/2, i.e. iff 2^50 > (2q+1)^2 * m, gives correct result;
+           with m = M*2^-23 (or M*2^-22 for odd exponents), it is 2^73 > (2q+1)^2 * M * (1 or 2), no ties.  */
+        uint64_t q = r >> 8;
+        uint64_t M = ((uint64_t(ix) & 0x007fffff) | 0x00800000) << (even ? 0 : 1);
+        uint64_t lo, hi = __umul64x64((2*q + 1) * (2*q + 1), M, &lo);
+        q += hi < (uint64_t(1) << 9);
+
+        /* 2^-k * q*2^-24; if q rounded up to 2^24, adding it to the exponent gives the right power of 2 */
+        return (uint32_t(0x7f - 2 - k) << 23) + uint32_t(q);
+    }
+
+    template <typename fp>
+    constexpr fp _rsqrt(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return 1.f / std::sqrt(x);
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__rsqrt_bits(ix));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+    constexpr auto rsqrt(fp x)
+    {
+        return _rsqrt(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline auto rsqrt(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        return sixit::units::dimensional_scalar<fp, (dim_ / dim_) / sixit::units::sqrt<dim_>()>({ rsqrt<fp>(val.value), sixit::units::internal_constructor_of_dimensional_scalar_from_fp() });
+    }
+} //  sixit::dmath::mathf
+
+#endif //sixit_dmath_mathf_rsqrt_h_included
+
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -12,10 +12,18 @@ namespace sixit::dmath::mathf
 {
 
 
+    /* on bits of val where it has IEEE bits, so no fp comparisons are needed; +-0 and nans give 0 */
     template <typename fp>
-    int sign(fp val)
+    constexpr int sign(fp val)
     {
-        return (val > fp(0.f)) - (val < fp(0.f));
+        if constexpr (__has_ieee_bits<fp>) {
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
+            if ((ix & 0x7fffffff) - 1 >= 0x7f800000)
+                return 0;
+            return (ix >> 31) ? -1 : 1;
+        } else {
+            return (val > fp(0.f)) - (val < fp(0.f));
+        }
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
@@ -0,0 +1,117 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathf_simd___simd_utils_h_included
+#define sixit_dmath_mathf_simd___simd_utils_h_included
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sixit/dmath/gamefloat/simd_float.h"
+#include "../__utils.h"
+
+namespace sixit::dmath::mathf
+{
+    /* lane kernels (_sin_simd() etc.) compute all the branches for all the lanes, and on all the current backends
+       they are slower than the scalar functions applied lane by lane (see README); so mathf:: functions over
+       SIMD fp types (and mathf::batch::) use them only with SIXIT_DMATH_SIMD_USE_LANE_KERNELS defined */
+#ifdef SIXIT_DMATH_SIMD_USE_LANE_KERNELS
+    constexpr bool __simd_use_lane_kernels = true;
+#else
+    constexpr bool __simd_use_lane_kernels = false;
+#endif // SIXIT_DMATH_SIMD_USE_LANE_KERNELS
+
+    inline uint32_t __simd_mask_lane(bool val)
+    {
+        return val ? UINT32_C(0xffffffff) : 0;
+    }
+
+    template <size_t N>
+    inline bool __simd_any(const sixit::dmath::simd_mask<N>& mask)
+    {
+        uint32_t rv = 0;
+        for (size_t i = 0; i < N; ++i)
+            rv |= mask[i];
+        return rv != 0;
+    }
+
+    template <size_t N>
+    inline bool __simd_all(const sixit::dmath::simd_mask<N>& mask)
+    {
+        uint32_t rv = UINT32_C(0xffffffff);
+        for (size_t i = 0; i < N; ++i)
+            rv &= mask[i];
+        return rv != 0;
+    }
+
+    /* builds lanes from bit patterns of floats; same as fp(float(...)) for each lane */
+    template <typename vfp>
+    inline vfp __simd_from_float_bits(const sixit::dmath::simd_uint32<sixit::dmath::fp_traits<vfp>::lanes>& bits)
+    {
+        return sixit::dmath::fp_traits<vfp>::bit_cast_from_ieee_uint32(bits);
+    }
+
+    template <typename vfp>
+    inline vfp __simd_broadcast(typename sixit::dmath::fp_traits<vfp>::lane_type val)
+    {
+        return sixit::dmath::fp_traits<vfp>::broadcast(val);
+    }
+
+    /* applies scalar f to the lanes selected by mask, keeping other lanes of rv intact */
+    template <typename vfp, typename F>
+    inline void __simd_scalar_fixup(vfp& rv, const vfp& x, const sixit::dmath::simd_mask<sixit::dmath::fp_traits<vfp>::lanes>& mask, F&& f)
+    {
+        using traits = sixit::dmath::fp_traits<vfp>;
+        for (size_t i = 0; i < traits::lanes; ++i)
+            if (mask[i])
+                traits::set_lane(rv, i, f(traits::get_lane(x, i)));
+    }
+
+    /* applies scalar f to all the lanes */
+    template <typename vfp, typename F>
+    inline vfp __simd_per_lane(const vfp& x, F&& f)
+    {
+        using traits = sixit::dmath::fp_traits<vfp>;
+        vfp rv = x;
+        for (size_t i = 0; i < traits::lanes; ++i)
+            traits::set_lane(rv, i, f(traits::get_lane(x, i)));
+        return rv;
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_mathf_simd___simd_utils_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
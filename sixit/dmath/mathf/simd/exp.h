@@ -0,0 +1,122 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+* Lane-parallel exp() for SIMD fp types (see sixit/dmath/gamefloat/simd_float.h).
+*
+* Bit-identical to the scalar _exp() from ../exp.h; lanes with |x| >= 88 or NaN go through the scalar code.
+*/
+#ifndef sixit_dmath_mathf_simd_exp_h_included
+#define sixit_dmath_mathf_simd_exp_h_included
+
+#include "__simd_utils.h"
+#include "../exp.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename vfp>
+    vfp _exp_simd(vfp x)
+    {
+        using traits = sixit::dmath::fp_traits<vfp>;
+        using lane_fp = typename traits::lane_type;
+        constexpr size_t lanes = traits::lanes;
+
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, lane_fp>) {
+            vfp rv = x;
+            for (size_t i = 0; i < lanes; ++i)
+                traits::set_lane(rv, i, std::exp(traits::get_lane(x, i)));
+            return rv;
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            const uint32_t top12_88 = top12(88.0f);
+
+            sixit::dmath::simd_uint32<lanes> ux = traits::bit_cast_to_ieee_uint32(x);
+            sixit::dmath::simd_uint32<lanes> r_bits, s_bits;
+            sixit::dmath::simd_mask<lanes> m_special;
+
+            for (size_t i = 0; i < lanes; ++i) {
+                uint32_t abstop = (ux[i] >> 20) & 0x7ff;
+                bool special = abstop >= top12_88;  /* |x| >= 88 or x is nan, handled by _exp() */
+                m_special[i] = __simd_mask_lane(special);
+
+                double xd = sixit::lwa::bit_cast<float>(special ? 0 : ux[i]);
+
+                /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  */
+                double z = exp_data<lane_fp>::invln2_scaled * xd;
+                double kd = eval_as_double(z + exp_data<lane_fp>::shift);
+                uint64_t ki = sixit::dmath::mathf::asuint64(kd);
+                kd -= exp_data<lane_fp>::shift;
+                r_bits[i] = sixit::lwa::bit_cast<uint32_t>(float(z - kd));
+
+                uint64_t t = exp_data<lane_fp>::tab[ki % N];
+                t += ki << (52 - EXP2F_TABLE_BITS);
+                s_bits[i] = sixit::lwa::bit_cast<uint32_t>(float(sixit::dmath::mathf::asdouble<lane_fp>(t)));
+            }
+
+            vfp r = __simd_from_float_bits<vfp>(r_bits);   // must_be_double
+            vfp s = __simd_from_float_bits<vfp>(s_bits);   // must_be_double
+
+            /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+            vfp z1 = __simd_broadcast<vfp>(exp_data<lane_fp>::poly_scaled[0]) * r + __simd_broadcast<vfp>(exp_data<lane_fp>::poly_scaled[1]);
+            vfp r2 = r * r;
+            vfp y = __simd_broadcast<vfp>(exp_data<lane_fp>::poly_scaled[2]) * r + __simd_broadcast<vfp>(lane_fp(1.f));
+            y = z1 * r2 + y;
+            y = y * s;
+
+            if (predict_false(__simd_any(m_special)))
+                __simd_scalar_fixup(y, x, m_special, [](lane_fp v) { return _exp(v); });
+            return y;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+        requires sixit::dmath::is_simd_fp_v<fp>
+    auto exp(fp x)
+    {
+        if constexpr (__simd_use_lane_kernels)
+            return _exp_simd(x);
+        else
+            return __simd_per_lane(x, [](typename sixit::dmath::fp_traits<fp>::lane_type v) { return exp(v); });
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_mathf_simd_exp_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+* Lane-parallel log() for SIMD fp types (see sixit/dmath/gamefloat/simd_float.h).
+*
+* Bit-identical to the scalar _log() from ../log.h; lanes with x == 1, x < 0x1p-126, inf or nan
+* go through the scalar code.
+*/
+#ifndef sixit_dmath_mathf_simd_log_h_included
+#define sixit_dmath_mathf_simd_log_h_included
+
+#include "__simd_utils.h"
+#include "../log.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename vfp>
+    vfp _log_simd(vfp x)
+    {
+        using traits = sixit::dmath::fp_traits<vfp>;
+        using lane_fp = typename traits::lane_type;
+        constexpr size_t lanes = traits::lanes;
+
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, lane_fp>) {
+            vfp rv = x;
+            for (size_t i = 0; i < lanes; ++i)
+                traits::set_lane(rv, i, std::log(traits::get_lane(x, i)));
+            return rv;
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            sixit::dmath::simd_uint32<lanes> ux = traits::bit_cast_to_ieee_uint32(x);
+            sixit::dmath::simd_uint32<lanes> z_bits, k_bits;
+            sixit::dmath::simd_mask<lanes> m_special;
+            lane_fp invc_lanes[lanes], logc_lanes[lanes]; // must_be_double
+
+            for (size_t i = 0; i < lanes; ++i) {
+                uint32_t ix = ux[i];
+                bool special = ix == 0x3f800000 || ix - 0x00800000 >= 0x7f800000 - 0x00800000;
+                m_special[i] = __simd_mask_lane(special);
+                ix = special ? 0x3f800000 : ix;
+
+                /* x = 2^k z; where z is in range [OFF,2*OFF] and exact. */
+                uint32_t tmp = ix - 0x3f330000;
+                int j = (tmp >> (23 - LOGF_TABLE_BITS)) % (1 << LOGF_TABLE_BITS);
+                int k = (int32_t)tmp >> 23; /* arithmetic shift */
+                z_bits[i] = ix - (tmp & 0xff800000);
+                k_bits[i] = sixit::lwa::bit_cast<uint32_t>(float(k));
+                invc_lanes[i] = __log_data<lane_fp>::tab[j][0];
+                logc_lanes[i] = __log_data<lane_fp>::tab[j][1];
+            }
+
+            vfp z = __simd_from_float_bits<vfp>(z_bits);  // must_be_double
+            vfp invc = traits::load(invc_lanes);
+            vfp logc = traits::load(logc_lanes);
+
+            /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
+            vfp r = z * invc - __simd_broadcast<vfp>(lane_fp(1.f));
+            vfp y0 = logc + __simd_from_float_bits<vfp>(k_bits) * __simd_broadcast<vfp>(__log_data<lane_fp>::ln2);
+
+            /* Pipelined polynomial evaluation to approximate log1p(r).  */
+            vfp r2 = r * r;
+            vfp y = __simd_broadcast<vfp>(__log_data<lane_fp>::poly[1]) * r + __simd_broadcast<vfp>(__log_data<lane_fp>::poly[2]);
+            y = __simd_broadcast<vfp>(__log_data<lane_fp>::poly[0]) * r2 + y;
+            y = y * r2 + (y0 + r);
+
+            if (predict_false(__simd_any(m_special)))
+                __simd_scalar_fixup(y, x, m_special, [](lane_fp v) { return _log(v); });
+            return y;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+        requires sixit::dmath::is_simd_fp_v<fp>
+    auto log(fp x)
+    {
+        if constexpr (__simd_use_lane_kernels)
+            return _log_simd(x);
+        else
+            return __simd_per_lane(x, [](typename sixit::dmath::fp_traits<fp>::lane_type v) { return log(v); });
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_mathf_simd_log_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
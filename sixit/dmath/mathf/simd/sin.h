@@ -0,0 +1,156 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+* Lane-parallel sin() for SIMD fp types (see sixit/dmath/gamefloat/simd_float.h).
+*
+* The branch ladder of ../sin.h is replaced by per-lane integer classification and masked selects;
+* every lane goes through exactly the same sequence of fp operations as the scalar _sin(),
+* so results are bit-identical to it. Lanes which need __rem_pio2f() (rare) are reduced one by one.
+*/
+#ifndef sixit_dmath_mathf_simd_sin_h_included
+#define sixit_dmath_mathf_simd_sin_h_included
+
+#include "__simd_utils.h"
+#include "../sin.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename vfp>
+    vfp _sin_simd(vfp x)
+    {
+        using traits = sixit::dmath::fp_traits<vfp>;
+        using lane_fp = typename traits::lane_type;
+        using lane_traits = sixit::dmath::fp_traits<lane_fp>;
+        constexpr size_t lanes = traits::lanes;
+
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, lane_fp>) {
+            vfp rv = x;
+            for (size_t i = 0; i < lanes; ++i)
+                traits::set_lane(rv, i, std::sin(traits::get_lane(x, i)));
+            return rv;
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            const uint32_t s1 = lane_traits::bit_cast_to_ieee_uint32(__sin_data<lane_fp>::s1pio2);
+            const uint32_t s2 = lane_traits::bit_cast_to_ieee_uint32(__sin_data<lane_fp>::s2pio2);
+            const uint32_t s3 = lane_traits::bit_cast_to_ieee_uint32(__sin_data<lane_fp>::s3pio2);
+            const uint32_t s4 = lane_traits::bit_cast_to_ieee_uint32(__sin_data<lane_fp>::s4pio2);
+
+            sixit::dmath::simd_uint32<lanes> ux = traits::bit_cast_to_ieee_uint32(x);
+            sixit::dmath::simd_uint32<lanes> off;
+            sixit::dmath::simd_mask<lanes> m_direct, m_neg_arg, m_cos, m_neg_res, m_keep_x, m_nan, m_reduce;
+
+            /* same classification as in _sin(); offsets are +-k*pi/2 so that x - k*pi/2 == x + off */
+            for (size_t i = 0; i < lanes; ++i) {
+                uint32_t sign = ux[i] >> 31;
+                uint32_t ix = ux[i] & 0x7fffffff;
+
+                bool pio4 = ix <= 0x3f490fda;                       /* |x| ~<= pi/4 */
+                bool pio4_3 = !pio4 && ix <= 0x4016cbe3;            /* |x| ~<= 3pi/4 */
+                bool pio4_5 = ix > 0x4016cbe3 && ix <= 0x407b53d1;  /* |x| ~<= 5*pi/4 */
+                bool pio4_7 = ix > 0x407b53d1 && ix <= 0x40afeddf;  /* |x| ~<= 7*pi/4 */
+                bool pio4_9 = ix > 0x40afeddf && ix <= 0x40e231d5;  /* |x| ~<= 9*pi/4 */
+                bool nan = ix >= 0x7f800000;
+                bool reduce = !pio4 && !pio4_3 && !pio4_5 && !pio4_7 && !pio4_9 && !nan;
+
+                uint32_t k = pio4_3 ? s1 : pio4_5 ? s2 : pio4_7 ? s3 : s4;
+                off[i] = sign ? k : k ^ 0x80000000;
+
+                m_direct[i] = __simd_mask_lane(pio4 || reduce);
+                m_neg_arg[i] = __simd_mask_lane(pio4_5);
+                m_cos[i] = __simd_mask_lane(pio4_3 || pio4_7);
+                m_neg_res[i] = __simd_mask_lane((pio4_3 && sign) || (pio4_7 && !sign));
+                m_keep_x[i] = __simd_mask_lane(ix < 0x39800000);    /* |x| < 2**-12 */
+                m_nan[i] = __simd_mask_lane(nan);
+                m_reduce[i] = __simd_mask_lane(reduce);
+            }
+
+            vfp arg = x;
+            if (predict_false(__simd_any(m_reduce))) {
+                /* general argument reduction needed */
+                for (size_t i = 0; i < lanes; ++i) {
+                    if (!m_reduce[i])
+                        continue;
+                    lane_fp y; // must_be_double
+                    int n = __rem_pio2f(traits::get_lane(x, i), &y);
+                    traits::set_lane(arg, i, (n&3) == 2 ? -y : y);
+                    m_cos[i] = __simd_mask_lane(n&1);
+                    m_neg_res[i] = __simd_mask_lane((n&3) == 3);
+                }
+            }
+
+            if (!__simd_all(m_direct)) {
+                vfp t = x + __simd_from_float_bits<vfp>(off);
+                t = traits::select(m_neg_arg, -t, t);
+                arg = traits::select(m_direct, arg, t);
+            }
+
+            vfp rv;
+            if (!__simd_any(m_cos))
+                rv = __sindf(arg);
+            else if (__simd_all(m_cos))
+                rv = __cosdf(arg);
+            else
+                rv = traits::select(m_cos, __cosdf(arg), __sindf(arg));
+
+            rv = traits::select(m_neg_res, -rv, rv);
+            rv = traits::select(m_keep_x, x, rv);
+
+            /* sin(Inf or NaN) is NaN */
+            if (predict_false(__simd_any(m_nan)))
+                rv = traits::select(m_nan, x - x, rv);
+            return rv;
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    template <typename fp>
+        requires sixit::dmath::is_simd_fp_v<fp>
+    auto sin(fp x)
+    {
+        if constexpr (__simd_use_lane_kernels)
+            return _sin_simd(x);
+        else
+            return __simd_per_lane(x, [](typename sixit::dmath::fp_traits<fp>::lane_type v) { return sin(v); });
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_mathf_simd_sin_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
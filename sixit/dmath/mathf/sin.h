@@ -33,7 +33,7 @@ namespace sixit::dmath::mathf
     };
     
     template <typename fp>
-    fp _sin(fp x)
+    constexpr fp _sin(fp x)
     {
 #ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         if constexpr (std::is_same_v<float, fp>)
@@ -96,9 +96,12 @@ namespace sixit::dmath::mathf
     }
 
     template <typename fp>
-    auto sin(fp x)
+    constexpr auto sin(fp x)
     {
-        return _sin(sixit::dmath::fp_traits<fp>::to_fallback(x));
+        if constexpr (__has_out_of_line_mathf<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_sin(x);
+        else
+            return _sin(sixit::dmath::fp_traits<fp>::to_fallback(x));
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
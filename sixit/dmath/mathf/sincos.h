@@ -0,0 +1,152 @@
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+/*
+ * sin(x) and cos(x) at once, with a single argument reduction. Every branch mirrors the
+ * corresponding branches of _sin() and _cos(), so results are bit-identical to separate
+ * sin(x) and cos(x) calls.
+ */
+#ifndef sixit_dmath_math_operations_sincos_h_included
+#define sixit_dmath_math_operations_sincos_h_included
+
+#include <utility>
+#include "__utils.h"
+#include "__sindf.h"
+#include "__cosdf.h"
+#include "__rem_pio2f.h"
+#include "sin.h"
+#include "cos.h"
+
+namespace sixit::dmath::mathf
+{
+    template <typename fp>
+    constexpr std::pair<fp, fp> _sincos(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return { std::sin(x), std::cos(x) };
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using sd = __sin_data<fp>;
+            using cd = __cos_data<fp>;
+            fp y; // must_be_double
+            fp c;
+            uint32_t ix;
+            unsigned n, sign;
+
+            ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            sign = ix >> 31;
+            ix &= 0x7fffffff;
+
+            if (ix <= 0x3f490fda) {  /* |x| ~<= pi/4 */
+                if (ix < 0x39800000) {  /* |x| < 2**-12 */
+                    /* raise inexact if x!=0 and underflow if subnormal */
+                    if constexpr (std::is_same_v<fp, float>)
+                        force_eval_fp(ix < 0x00800000 ? x/0x1p120f : x+0x1p120f);
+                    return { x, fp(1.0f) };
+                }
+                return { __sindf(x), __cosdf(x) };
+            }
+            if (ix <= 0x407b53d1) {  /* |x| ~<= 5*pi/4 */
+                if (ix <= 0x4016cbe3) {  /* |x| ~<= 3pi/4 */
+                    if (sign)
+                        return { -__cosdf(x + sd::s1pio2), __sindf(x + cd::c1pio2) };
+                    else
+                        return { __cosdf(x - sd::s1pio2), __sindf(cd::c1pio2 - x) };
+                }
+                y = sign ? x + sd::s2pio2 : x - sd::s2pio2;
+                return { __sindf(-y), -__cosdf(y) };
+            }
+            if (ix <= 0x40e231d5) {  /* |x| ~<= 9*pi/4 */
+                if (ix <= 0x40afeddf) {  /* |x| ~<= 7*pi/4 */
+                    if (sign)
+                        return { __cosdf(x + sd::s3pio2), __sindf(-x - cd::c3pio2) };
+                    else
+                        return { -__cosdf(x - sd::s3pio2), __sindf(x - cd::c3pio2) };
+                }
+                y = sign ? x + sd::s4pio2 : x - sd::s4pio2;
+                return { __sindf(y), __cosdf(y) };
+            }
+
+            /* sin(Inf or NaN) is NaN */
+            if (ix >= 0x7f800000)
+                return { x - x, x - x };
+
+            /* general argument reduction needed */
+            n = __rem_pio2f(x, &y);
+            c = __cosdf(y);
+            switch (n&3) {
+            case 0: return { __sindf(y), c };
+            case 1: return { c, __sindf(-y) };
+            case 2: return { __sindf(-y), -c };
+            default:
+                return { -c, __sindf(y) };
+            }
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    // returns { sin(x), cos(x) }
+    template <typename fp>
+    constexpr auto sincos(fp x)
+    {
+        return _sincos(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline std::pair<sixit::units::dimensional_scalar<fp, dim_>, sixit::units::dimensional_scalar<fp, dim_>> sincos(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        auto [s, c] = sincos<fp>(val.value);
+        return { sixit::units::dimensional_scalar<fp, dim_>({ s, sixit::units::internal_constructor_of_dimensional_scalar_from_fp() }),
+                 sixit::units::dimensional_scalar<fp, dim_>({ c, sixit::units::internal_constructor_of_dimensional_scalar_from_fp() }) };
+    }
+} //  sixit::dmath::mathf
+
+#endif // sixit_dmath_math_operations_sincos_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
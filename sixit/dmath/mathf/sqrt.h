@@ -7,13 +7,14 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 #ifndef sixit_dmath_mathf_sqrt_h_included
 #define sixit_dmath_mathf_sqrt_h_included
 
+#include <bit>
 #include <cstdint>
 #include "__utils.h"
 #include "iostream"
 
 namespace sixit::dmath::mathf
 {
-    const uint16_t __rsqrt_tab[128] = {
+    inline constexpr uint16_t __rsqrt_tab[128] = {
         0xb451,0xb2f0,0xb196,0xb044,0xaef9,0xadb6,0xac79,0xab43,
         0xaa14,0xa8eb,0xa7c8,0xa6aa,0xa592,0xa480,0xa373,0xa26b,
         0xa168,0xa06a,0x9f70,0x9e7b,0x9d8a,0x9c9d,0x9bb5,0x9ad1,
@@ -32,100 +33,101 @@ namespace sixit::dmath::mathf
         0xba91,0xb9cc,0xb90a,0xb84a,0xb78c,0xb6d0,0xb617,0xb560,
     };
         
+    /*
+     * sqrt() on bits of x, correctly rounded (to nearest); integers only, so the cost is the same on all backends.
+     * Subnormals are normalized on bits, and the final fp addition of MUSL's sqrtf() (which only matters for
+     * non-default rounding modes and the inexact flag) is dropped.
+     */
+    constexpr uint32_t __sqrt_bits(uint32_t ix)
+    {
+        uint32_t m, m1, m0, even, ey;
+
+        auto mul32 = [](uint32_t a, uint32_t b)
+        {
+            return uint32_t(((uint64_t)a * b) >> 32);
+        };
+
+        if (predict_false(ix - 0x00800000 >= 0x7f800000 - 0x00800000)) {
+            /* x < 0x1p-126 or inf or nan.  */
+            if (ix * 2 == 0)
+                return ix;
+            if (ix == 0x7f800000)
+                return ix;
+            if ((ix & 0x7fffffff) > 0x7f800000)  /* nan: quiet it, as (x - x) / (x - x) would do */
+                return ix | 0x00400000;
+            if (ix > 0x7f800000)  /* x < 0 */
+                return 0x7fc00000;
+            /* x is subnormal, normalize it; the exponent field wraps around, which is fixed by ey below.  */
+            int shift = std::countl_zero(ix) - 8;
+            ix = ((ix << shift) & 0x007fffff) + (uint32_t(1 - shift) << 23);
+        }
+
+        /* x = 4^e m; with int e and m in [1, 4).  */
+        even = ix & 0x00800000;
+        m1 = (ix << 8) | 0x80000000;
+        m0 = (ix << 7) & 0x7fffffff;
+        m = even ? m0 : m1;
+
+        /* 2^e is the exponent part of the return value.  */
+        ey = ix >> 1;
+        ey += 0x3f800000 >> 1;
+        ey &= 0x7f800000;
+
+        /* compute r ~ 1/sqrt(m), s ~ sqrt(m) with 2 goldschmidt iterations.  */
+        constexpr uint32_t three = 0xc0000000;
+        uint32_t r, s, d, u, i;
+        i = (ix >> 17) % 128;
+        r = (uint32_t)__rsqrt_tab[i] << 16;
+        /* |r*sqrt(m) - 1| < 0x1p-8 */
+        s = mul32(m, r);
+        /* |s/sqrt(m) - 1| < 0x1p-8 */
+        d = mul32(s, r);
+        u = three - d;
+        r = mul32(r, u) << 1;
+        /* |r*sqrt(m) - 1| < 0x1.7bp-16 */
+        s = mul32(s, u) << 1;
+        /* |s/sqrt(m) - 1| < 0x1.7bp-16 */
+        d = mul32(s, r);
+        u = three - d;
+        s = mul32(s, u);
+        /* -0x1.03p-28 < s/sqrt(m) - 1 < 0x1.fp-31 */
+        s = (s - 1)>>6;
+        /* s < sqrt(m) < s + 0x1.08p-23 */
+
+        /* compute nearest rounded result.  */
+        uint32_t d0, d1;
+        d0 = (m << 16) - s*s;
+        d1 = s - d0;
+        s += d1 >> 31;
+        s &= 0x007fffff;
+        s |= ey;
+        return s;
+    }
+
     template <typename fp>
-    inline fp _sqrt(fp x)
+    constexpr fp _sqrt(fp x)
     {
-        // if constexpr (std::is_same_v<float, fp>)
-        //     return std::sqrt(x);
 #ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         if constexpr (std::is_same_v<fp, float>) {
             volatile uint32_t rvu = sixit::lwa::bit_cast<uint32_t>(x);
-            // rvu += 1 << 31;
-            // rvu += 1 << 31;
             volatile float rvf = std::sqrt(sixit::lwa::bit_cast<float>(rvu));
             return rvf;
         } else {
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC                   
-
-            uint32_t ix, m, m1, m0, even, ey;
-
-            auto mul32 = [](uint32_t a, uint32_t b)
-            {
-                return uint32_t(((uint64_t)a * b) >> 32);
-            };
-
-            ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
-            if (predict_false(ix - 0x00800000 >= 0x7f800000 - 0x00800000)) {
-                /* x < 0x1p-126 or inf or nan.  */
-                if (ix * 2 == 0)
-                    return x;
-                if (ix == 0x7f800000)
-                    return x;
-                if (ix > 0x7f800000)
-                    return (x - x) / (x - x);
-                /* x is subnormal, normalize it.  */
-                ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x * fp(0x1p23f));
-                ix -= 23 << 23;
-            }
-
-            /* x = 4^e m; with int e and m in [1, 4).  */
-            even = ix & 0x00800000;
-            m1 = (ix << 8) | 0x80000000;
-            m0 = (ix << 7) & 0x7fffffff;
-            m = even ? m0 : m1;
-
-            /* 2^e is the exponent part of the return value.  */
-            ey = ix >> 1;
-            ey += 0x3f800000 >> 1;
-            ey &= 0x7f800000;
-
-            /* compute r ~ 1/sqrt(m), s ~ sqrt(m) with 2 goldschmidt iterations.  */
-            static const uint32_t three = 0xc0000000;
-            uint32_t r, s, d, u, i;
-            i = (ix >> 17) % 128;
-            r = (uint32_t)__rsqrt_tab[i] << 16;
-            /* |r*sqrt(m) - 1| < 0x1p-8 */
-            s = mul32(m, r);
-            /* |s/sqrt(m) - 1| < 0x1p-8 */
-            d = mul32(s, r);
-            u = three - d;
-            r = mul32(r, u) << 1;
-            /* |r*sqrt(m) - 1| < 0x1.7bp-16 */
-            s = mul32(s, u) << 1;
-            /* |s/sqrt(m) - 1| < 0x1.7bp-16 */
-            d = mul32(s, r);
-            u = three - d;
-            s = mul32(s, u);
-            /* -0x1.03p-28 < s/sqrt(m) - 1 < 0x1.fp-31 */
-            s = (s - 1)>>6;
-            /* s < sqrt(m) < s + 0x1.08p-23 */
-
-            /* compute nearest rounded result.  */
-            uint32_t d0, d1, d2;
-            fp y, t;
-            d0 = (m << 16) - s*s;
-            d1 = s - d0;
-            d2 = d1 + s + 1;
-            s += d1 >> 31;
-            s &= 0x007fffff;
-            s |= ey;
-            y = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(s);
-            /* handle rounding and inexact exception. */
-            uint32_t tiny = predict_false(d2==0) ? 0 : 0x01000000;
-            tiny |= (d1^d2) & 0x80000000;
-            t = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(tiny);
-            y = eval_as_fp(y + t);
-
-            return y;
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC            
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__sqrt_bits(ix));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         }
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC               
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
     }
 
     template <typename fp>
-    inline auto sqrt(fp x)
+    constexpr auto sqrt(fp x)
     {
-        return _sqrt(sixit::dmath::fp_traits<fp>::to_fallback(x));
+        if constexpr (__has_out_of_line_mathf<fp>)
+            return sixit::dmath::fp_traits<fp>::mathf_sqrt(x);
+        else
+            return _sqrt(sixit::dmath::fp_traits<fp>::to_fallback(x));
     }
 
     template <typename fp, sixit::units::physical_dimension dim_>
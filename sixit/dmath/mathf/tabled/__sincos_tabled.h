@@ -0,0 +1,140 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+
+/*
+ * Shared parts of tabled::sin(), cos() and sincos().
+ *
+ * x = j*pi/32 + r, |r| <= pi/64; then
+ *     sin(x) = sin(j*pi/32) + (sin(j*pi/32)*(cos(r)-1) + cos(j*pi/32)*sin(r))
+ *     cos(x) = cos(j*pi/32) + (cos(j*pi/32)*(cos(r)-1) - sin(j*pi/32)*sin(r))
+ * Reduction is done on integers: x*32/pi mod 64 comes from the same 128-bit window of 2/pi as in
+ * ../__rem_pio2f.h (x*2/pi mod 4 scaled by 2^126 is x*32/pi mod 64 scaled by 2^122), and r is kept in
+ * 2^-64 units. The final combination with table values (sin(j*pi/32) in 2^-62 units) is exact in 128 bits
+ * and rounded to float once, so there is no host double arithmetic which the compiler could contract into
+ * FMA. Only sin(r)-r and cos(r)-1 are evaluated in fp; with |r| <= pi/64, Taylor polynomials of degree 5
+ * and 4 are accurate to 2^-38 (relative) and 2^-35 (absolute) respectively.
+ *
+ * Unlike ../sin.h, there is no branch ladder on |x|: all |x| in [2^-12, 2^24*pi/2) go through the same path.
+ */
+#ifndef sixit_dmath_mathf_tabled___sincos_tabled_h_included
+#define sixit_dmath_mathf_tabled___sincos_tabled_h_included
+
+#include "../__utils.h"
+#include "../__rem_pio2f.h"
+
+namespace sixit::dmath::mathf::tabled
+{
+    constexpr int SINCOS_TABLE_BITS = 6;
+
+    template <typename fp>
+    struct __sincos_tabled_data {
+        /* tab[j] = sin(j*pi/32) * 2^62, rounded to nearest; cos(j*pi/32) == tab[(j + 16) % 64] */
+        static constexpr int64_t tab[1 << SINCOS_TABLE_BITS] = {
+            0x0000000000000000, 0x0645e9af0a6d0af8, 0x0c7c5c1e34d3055b, 0x1294062ed59f05a9,
+            0x187de2a6aea962d2, 0x1e2b5d3806f63b1e, 0x238e76735cd190d9, 0x2899e64a123bac30,
+            0x2d413cccfe779921, 0x317900d62a2e816a, 0x3536cc521d434606, 0x387165e3017b61a4,
+            0x3b20d79e651a8c51, 0x3d3e82ad8c5bb4bb, 0x3ec52f9feeb96056, 0x3fb11b47a24a4b3c,
+            0x4000000000000000, 0x3fb11b47a24a4b3c, 0x3ec52f9feeb96056, 0x3d3e82ad8c5bb4bb,
+            0x3b20d79e651a8c51, 0x387165e3017b61a4, 0x3536cc521d434606, 0x317900d62a2e816a,
+            0x2d413cccfe779921, 0x2899e64a123bac30, 0x238e76735cd190d9, 0x1e2b5d3806f63b1e,
+            0x187de2a6aea962d2, 0x1294062ed59f05a9, 0x0c7c5c1e34d3055b, 0x0645e9af0a6d0af8,
+            0x0000000000000000, -0x0645e9af0a6d0af8, -0x0c7c5c1e34d3055b, -0x1294062ed59f05a9,
+            -0x187de2a6aea962d2, -0x1e2b5d3806f63b1e, -0x238e76735cd190d9, -0x2899e64a123bac30,
+            -0x2d413cccfe779921, -0x317900d62a2e816a, -0x3536cc521d434606, -0x387165e3017b61a4,
+            -0x3b20d79e651a8c51, -0x3d3e82ad8c5bb4bb, -0x3ec52f9feeb96056, -0x3fb11b47a24a4b3c,
+            -0x4000000000000000, -0x3fb11b47a24a4b3c, -0x3ec52f9feeb96056, -0x3d3e82ad8c5bb4bb,
+            -0x3b20d79e651a8c51, -0x387165e3017b61a4, -0x3536cc521d434606, -0x317900d62a2e816a,
+            -0x2d413cccfe779921, -0x2899e64a123bac30, -0x238e76735cd190d9, -0x1e2b5d3806f63b1e,
+            -0x187de2a6aea962d2, -0x1294062ed59f05a9, -0x0c7c5c1e34d3055b, -0x0645e9af0a6d0af8,
+        };
+        static constexpr uint64_t pi_scaled = 0x3243f6a8885a308d;  /* pi * 2^60, rounded to nearest */
+        /* sin(r) ~= r + r^3*(S1 + r^2*S2), cos(r) - 1 ~= r^2*(C1 + r^2*C2) */
+        static constexpr fp S1 = fp(float(-1.0 / 6));
+        static constexpr fp S2 = fp(float(1.0 / 120));
+        static constexpr fp C1 = fp(-0.5f);
+        static constexpr fp C2 = fp(float(1.0 / 24));
+    };
+
+    /* for 2^-12 <= |x| < 2^24*pi/2: returns j, and { sin(r), cos(r)-1 } in 2^-64 units for r = x - j*pi/32 */
+    template <typename fp>
+    constexpr int __sincos_tabled_reduce(fp x, int64_t* sinr, int64_t* cosrm1)
+    {
+        using d = __sincos_tabled_data<fp>;
+        uint32_t ui = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x);
+
+        /* hi:lo = |x|*32/pi mod 64, scaled by 2^122; j = nearest integer, hi:lo -= j (signed, |hi:lo| <= 2^121) */
+        uint64_t lo;
+        uint64_t hi = __mul_2opi_mod4_bits(ui & 0x7fffffff, &lo);
+        uint64_t j = (hi + (uint64_t(1) << 57)) >> 58;
+        hi -= j << 58;
+
+        /* rq = r * 2^64 for |x|: the remainder is taken in 2^-63 units and multiplied by pi/32; then x's sign is applied */
+        uint64_t plo;
+        int64_t rq = __smul64x64(int64_t((hi << 5) | (lo >> 59)), int64_t(d::pi_scaled), &plo);
+        uint64_t xneg = 0 - uint64_t(ui >> 31);  /* branchless, as the sign is unpredictable */
+        rq = int64_t((uint64_t(rq) ^ xneg) - xneg);
+        j = (j ^ xneg) - xneg;
+
+        /* r itself is kept in integers, fp r is used for higher-order terms only */
+        uint64_t rneg = 0 - (uint64_t(rq) >> 63);
+        fp r = sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(
+            __round_to_float_bits(uint32_t(rneg & 1), (uint64_t(rq) ^ rneg) - rneg, -64));
+        fp z = r * r;
+        *sinr = rq + __float_bits_to_fixed(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32((r * z) * (d::S1 + z * d::S2)), 64);
+        *cosrm1 = __float_bits_to_fixed(sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(z * (d::C1 + z * d::C2)), 64);
+        return int(j & ((1 << SINCOS_TABLE_BITS) - 1));
+    }
+
+    /* IEEE bits of a + (a*cosrm1 + b*sinr) for a, b in 2^-62 units and sinr, cosrm1 in 2^-64 ones; the sum is
+       exact in 128 bits (2^-126 units), so it is rounded only once */
+    constexpr uint32_t __sincos_tabled_combine(int64_t a, int64_t b, int64_t sinr, int64_t cosrm1)
+    {
+        uint64_t lo1, lo2;
+        uint64_t hi1 = uint64_t(__smul64x64(a, cosrm1, &lo1));
+        uint64_t hi2 = uint64_t(__smul64x64(b, sinr, &lo2));
+        uint64_t lo = lo1 + lo2;
+        uint64_t hi = hi1 + hi2 + (lo < lo1) + uint64_t(a);
+        uint64_t neg = 0 - (hi >> 63);  /* branchless, as the sign is unpredictable */
+        lo = (lo ^ neg) - neg;
+        hi = (hi ^ neg) + (neg & (lo == 0));
+        return __round_to_float_bits(uint32_t(neg & 1), hi, lo, -126);
+    }
+} //  sixit::dmath::mathf::tabled
+
+#endif // sixit_dmath_mathf_tabled___sincos_tabled_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -0,0 +1,93 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+*/
+#ifndef sixit_dmath_mathf_tabled_sincos_h_included
+#define sixit_dmath_mathf_tabled_sincos_h_included
+
+#include <utility>
+#include "__sincos_tabled.h"
+#include "../sincos.h"
+
+namespace sixit::dmath::mathf::tabled
+{
+    template <typename fp>
+    constexpr std::pair<fp, fp> _sincos_tabled(fp x)
+    {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
+            return { std::sin(x), std::cos(x) };
+        } else {
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            using d = __sincos_tabled_data<fp>;
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(x) & 0x7fffffff;
+
+            if (predict_false(ix < 0x39800000))  /* |x| < 2**-12 */
+                return { x, fp(1.0f) };
+            if (predict_false(ix >= 0x4bc90fdb))  /* |x| ~>= 2^24*pi/2, inf or nan */
+                return sixit::dmath::mathf::_sincos(x);
+
+            /* the same reduction and polynomials for both, so the results are the same as tabled::sin() and cos() */
+            int64_t sinr, cosrm1;
+            int j = __sincos_tabled_reduce(x, &sinr, &cosrm1);
+            int64_t s = d::tab[j];
+            int64_t c = d::tab[(j + (1 << (SINCOS_TABLE_BITS - 2))) % (1 << SINCOS_TABLE_BITS)];
+            return { sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__sincos_tabled_combine(s, c, sinr, cosrm1)),
+                     sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__sincos_tabled_combine(c, -s, sinr, cosrm1)) };
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        }
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+    }
+
+    // returns { sin(x), cos(x) }
+    template <typename fp>
+    constexpr auto sincos(fp x)
+    {
+        return _sincos_tabled(sixit::dmath::fp_traits<fp>::to_fallback(x));
+    }
+
+    template <typename fp, sixit::units::physical_dimension dim_>
+    inline std::pair<sixit::units::dimensional_scalar<fp, dim_>, sixit::units::dimensional_scalar<fp, dim_>> sincos(sixit::units::dimensional_scalar<fp, dim_> val)
+    {
+        static_assert(dim_ == dim_ * dim_);
+        auto [s, c] = sincos<fp>(val.value);
+        return { sixit::units::dimensional_scalar<fp, dim_>({ s, sixit::units::internal_constructor_of_dimensional_scalar_from_fp() }),
+                 sixit::units::dimensional_scalar<fp, dim_>({ c, sixit::units::internal_constructor_of_dimensional_scalar_from_fp() }) };
+    }
+} //  sixit::dmath::mathf::tabled
+
+#endif // sixit_dmath_mathf_tabled_sincos_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Serhii Iliukhin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
@@ -11,39 +11,35 @@ Contributors: Sherry Ignatchenko, Serhii Iliukhin
 
 namespace sixit::dmath::mathf
 {
+    /* trunc() on bits of x: the result is exact, so no fp operations are needed */
+    constexpr uint32_t __trunc_bits(uint32_t ix)
+    {
+        int e = int((ix >> 23) & 0xff) - 0x7f;
+
+        if (e >= 23)  /* integral, inf or nan */
+            return ix;
+        if (e < 0)  /* |x| < 1 */
+            return ix & 0x80000000;
+        return ix & ~(0x007fffff >> e);
+    }
+
     template <typename fp>
-    inline fp _trunc(fp val)
+    constexpr fp _trunc(fp val)
     {
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC        
-        if constexpr (std::is_same_v<float, fp>)
-        {
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+        if constexpr (std::is_same_v<float, fp>) {
             return std::trunc(val);
         } else {
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC                   
-
-            int e = sixit::dmath::fp_traits<fp>::get_exp(val) + 9;
-            uint32_t vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
-            uint32_t m;
-
-            if (e >= 23 + 9)
-                return val;
-            if (e < 9)
-                e = 1;
-            m = 0xffffffff >> e;
-            if ((vali & m) == 0)
-                return val;
-            if constexpr (std::is_same<fp, float>())
-                force_eval_fp<fp>(val + fp(0x1p120f));
-            vali = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
-            vali &= ~m;
-            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(vali);
-#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC            
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
+            uint32_t ix = sixit::dmath::fp_traits<fp>::bit_cast_to_ieee_uint32(val);
+            return sixit::dmath::fp_traits<fp>::bit_cast_from_ieee_uint32(__trunc_bits(ix));
+#ifndef SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
         }
-#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC               
+#endif // SIXIT_DMATH_USE_SIXIT_FOR_NON_DETERMINISTIC
     }
 
     template <typename fp>
-    inline auto trunc(fp val)
+    constexpr auto trunc(fp val)
     {
         return _trunc(sixit::dmath::fp_traits<fp>::to_fallback(val));
     }
@@ -59,75 +59,68 @@ namespace sixit::dmath::softfloat
 {
 
 template <typename UnsignedT, typename = std::enable_if<std::is_unsigned_v<UnsignedT>>>
-inline UnsignedT neg_unsigned(UnsignedT i)
+constexpr UnsignedT neg_unsigned(UnsignedT i)
 {
     return UnsignedT(0) - i;  // suppresses a warning
 }
 
-inline float32_t f32_add( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr float32_t f32_add( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 1)
-    float32_t (*magsFuncPtr)( uint_fast32_t, uint_fast32_t );
+    float32_t (*magsFuncPtr)( uint_fast32_t, uint_fast32_t, Ctx& );
 #endif
 
-    uA.f = a;
-    uiA = uA.ui;
-    uB.f = b;
-    uiB = uB.ui;
+    uiA = a.v;
+    uiB = b.v;
 #if defined INLINE_LEVEL && (1 <= INLINE_LEVEL)
     if ( signF32UI( uiA ^ uiB ) ) {
-        return softfloat_subMagsF32( uiA, uiB );
+        return softfloat_subMagsF32( uiA, uiB, ctx );
     } else {
-        return softfloat_addMagsF32( uiA, uiB );
+        return softfloat_addMagsF32( uiA, uiB, ctx );
     }
 #else
     magsFuncPtr =
-        signF32UI( uiA ^ uiB ) ? softfloat_subMagsF32 : softfloat_addMagsF32;
-    return (*magsFuncPtr)( uiA, uiB );
+        signF32UI( uiA ^ uiB ) ? softfloat_subMagsF32<Ctx> : softfloat_addMagsF32<Ctx>;
+    return (*magsFuncPtr)( uiA, uiB, ctx );
 #endif
 
 }
 
-inline float32_t f32_sub( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr float32_t f32_sub( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 1)
-    float32_t (*magsFuncPtr)( uint_fast32_t, uint_fast32_t );
+    float32_t (*magsFuncPtr)( uint_fast32_t, uint_fast32_t, Ctx& );
 #endif
 
-    uA.f = a;
-    uiA = uA.ui;
-    uB.f = b;
-    uiB = uB.ui;
+    uiA = a.v;
+    uiB = b.v;
 #if defined INLINE_LEVEL && (1 <= INLINE_LEVEL)
     if ( signF32UI( uiA ^ uiB ) ) {
-        return softfloat_addMagsF32( uiA, uiB );
+        return softfloat_addMagsF32( uiA, uiB, ctx );
     } else {
-        return softfloat_subMagsF32( uiA, uiB );
+        return softfloat_subMagsF32( uiA, uiB, ctx );
     }
 #else
     magsFuncPtr =
-        signF32UI( uiA ^ uiB ) ? softfloat_addMagsF32 : softfloat_subMagsF32;
-    return (*magsFuncPtr)( uiA, uiB );
+        signF32UI( uiA ^ uiB ) ? softfloat_addMagsF32<Ctx> : softfloat_subMagsF32<Ctx>;
+    return (*magsFuncPtr)( uiA, uiB, ctx );
 #endif
 
 }
 
-inline float32_t f32_mul( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr float32_t f32_mul( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
     bool signA;
     int_fast16_t expA;
     uint_fast32_t sigA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
     bool signB;
     int_fast16_t expB;
@@ -136,44 +129,54 @@ inline float32_t f32_mul( float32_t a, float32_t b )
     uint_fast32_t magBits;
     struct exp16_sig32 normExpSig;
     int_fast16_t expZ;
-    uint_fast32_t sigZ, uiZ;
-    union ui32_f32 uZ;
+    uint_fast32_t sigZ;
+    float32_t uZ;
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    uA.f = a;
-    uiA = uA.ui;
+    uiA = a.v;
     signA = signF32UI( uiA );
     expA  = expF32UI( uiA );
     sigA  = fracF32UI( uiA );
-    uB.f = b;
-    uiB = uB.ui;
+    uiB = b.v;
     signB = signF32UI( uiB );
     expB  = expF32UI( uiB );
     sigB  = fracF32UI( uiB );
     signZ = signA ^ signB;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    if ( expA == 0xFF ) {
-        if ( sigA || ((expB == 0xFF) && sigB) ) goto propagateNaN;
-        magBits = expB | sigB;
-        goto infArg;
-    }
-    if ( expB == 0xFF ) {
-        if ( sigB ) goto propagateNaN;
-        magBits = expA | sigA;
-        goto infArg;
+    if ( (expA == 0xFF) || (expB == 0xFF) ) {
+        if ( (expA == 0xFF) ? (sigA || ((expB == 0xFF) && sigB)) : sigB ) {
+            /*----------------------------------------------------------------
+            | propagate NaN
+            *----------------------------------------------------------------*/
+            uZ.v = softfloat_propagateNaNF32UI( uiA, uiB, ctx );
+            return uZ;
+        }
+        /*--------------------------------------------------------------------
+        | infinite argument
+        *--------------------------------------------------------------------*/
+        magBits = (expA == 0xFF) ? (expB | sigB) : (expA | sigA);
+        if ( ! magBits ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF32UI;
+        } else {
+            uZ.v = packToF32UI( signZ, 0xFF, 0 );
+        }
+        return uZ;
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
+    if ( (! expA && ! sigA) || (! expB && ! sigB) ) {
+        uZ.v = packToF32UI( signZ, 0, 0 );
+        return uZ;
+    }
     if ( ! expA ) {
-        if ( ! sigA ) goto zero;
         normExpSig = softfloat_normSubnormalF32Sig( sigA );
         expA = normExpSig.exp;
         sigA = normExpSig.sig;
     }
     if ( ! expB ) {
-        if ( ! sigB ) goto zero;
         normExpSig = softfloat_normSubnormalF32Sig( sigB );
         expB = normExpSig.exp;
         sigB = normExpSig.sig;
@@ -188,40 +191,23 @@ inline float32_t f32_mul( float32_t a, float32_t b )
         --expZ;
         sigZ <<= 1;
     }
-    return softfloat_roundPackToF32( signZ, expZ, sigZ );
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
-    goto uiZ;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- infArg:
-    if ( ! magBits ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
-        uiZ = defaultNaNF32UI;
-    } else {
-        uiZ = packToF32UI( signZ, 0xFF, 0 );
-    }
-    goto uiZ;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- zero:
-    uiZ = packToF32UI( signZ, 0, 0 );
- uiZ:
-    uZ.ui = uiZ;
-    return uZ.f;
+    return softfloat_roundPackToF32( signZ, expZ, sigZ, ctx );
+
+}
 
+template <typename Ctx>
+constexpr float32_t f32_mulAdd( float32_t a, float32_t b, float32_t c, Ctx& ctx )
+{
+    return softfloat_mulAddF32( a.v, b.v, c.v, 0, ctx );
 }
 
-inline float32_t f32_div( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr float32_t f32_div( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
     bool signA;
     int_fast16_t expA;
     uint_fast32_t sigA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
     bool signB;
     int_fast16_t expB;
@@ -236,18 +222,15 @@ inline float32_t f32_div( float32_t a, float32_t b )
     uint_fast32_t sigZ;
     uint_fast64_t rem;
 #endif
-    uint_fast32_t uiZ;
-    union ui32_f32 uZ;
+    float32_t uZ;
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    uA.f = a;
-    uiA = uA.ui;
+    uiA = a.v;
     signA = signF32UI( uiA );
     expA  = expF32UI( uiA );
     sigA  = fracF32UI( uiA );
-    uB.f = b;
-    uiB = uB.ui;
+    uiB = b.v;
     signB = signF32UI( uiB );
     expB  = expF32UI( uiB );
     sigB  = fracF32UI( uiB );
@@ -255,31 +238,46 @@ inline float32_t f32_div( float32_t a, float32_t b )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( expA == 0xFF ) {
-        if ( sigA ) goto propagateNaN;
-        if ( expB == 0xFF ) {
-            if ( sigB ) goto propagateNaN;
-            goto invalid;
+        if ( sigA || ((expB == 0xFF) && sigB) ) {
+            uZ.v = softfloat_propagateNaNF32UI( uiA, uiB, ctx );
+        } else if ( expB == 0xFF ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF32UI;
+        } else {
+            uZ.v = packToF32UI( signZ, 0xFF, 0 );
         }
-        goto infinity;
+        return uZ;
     }
     if ( expB == 0xFF ) {
-        if ( sigB ) goto propagateNaN;
-        goto zero;
+        if ( sigB ) {
+            uZ.v = softfloat_propagateNaNF32UI( uiA, uiB, ctx );
+        } else {
+            uZ.v = packToF32UI( signZ, 0, 0 );
+        }
+        return uZ;
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( ! expB ) {
         if ( ! sigB ) {
-            if ( ! (expA | sigA) ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
-            goto infinity;
+            if ( ! (expA | sigA) ) {
+                ctx.raiseFlags( softfloat_flag_invalid );
+                uZ.v = defaultNaNF32UI;
+            } else {
+                ctx.raiseFlags( softfloat_flag_infinite );
+                uZ.v = packToF32UI( signZ, 0xFF, 0 );
+            }
+            return uZ;
         }
         normExpSig = softfloat_normSubnormalF32Sig( sigB );
         expB = normExpSig.exp;
         sigB = normExpSig.sig;
     }
     if ( ! expA ) {
-        if ( ! sigA ) goto zero;
+        if ( ! sigA ) {
+            uZ.v = packToF32UI( signZ, 0, 0 );
+            return uZ;
+        }
         normExpSig = softfloat_normSubnormalF32Sig( sigA );
         expA = normExpSig.exp;
         sigA = normExpSig.sig;
@@ -324,47 +322,21 @@ inline float32_t f32_div( float32_t a, float32_t b )
         }
     }
 #endif
-    return softfloat_roundPackToF32( signZ, expZ, sigZ );
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
-    goto uiZ;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
-    uiZ = defaultNaNF32UI;
-    goto uiZ;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- infinity:
-    uiZ = packToF32UI( signZ, 0xFF, 0 );
-    goto uiZ;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- zero:
-    uiZ = packToF32UI( signZ, 0, 0 );
- uiZ:
-    uZ.ui = uiZ;
-    return uZ.f;
+    return softfloat_roundPackToF32( signZ, expZ, sigZ, ctx );
 
 }
 
-inline bool f32_lt( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr bool f32_lt( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
     bool signA, signB;
 
-    uA.f = a;
-    uiA = uA.ui;
-    uB.f = b;
-    uiB = uB.ui;
+    uiA = a.v;
+    uiB = b.v;
     if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        ctx.raiseFlags( softfloat_flag_invalid );
         return false;
     }
     signA = signF32UI( uiA );
@@ -375,20 +347,17 @@ inline bool f32_lt( float32_t a, float32_t b )
 
 }
 
-inline bool f32_le( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr bool f32_le( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
     bool signA, signB;
 
-    uA.f = a;
-    uiA = uA.ui;
-    uB.f = b;
-    uiB = uB.ui;
+    uiA = a.v;
+    uiB = b.v;
     if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        ctx.raiseFlags( softfloat_flag_invalid );
         return false;
     }
     signA = signF32UI( uiA );
@@ -399,22 +368,19 @@ inline bool f32_le( float32_t a, float32_t b )
 
 }
 
-inline bool f32_eq( float32_t a, float32_t b )
+template <typename Ctx>
+constexpr bool f32_eq( float32_t a, float32_t b, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
-    union ui32_f32 uB;
     uint_fast32_t uiB;
 
-    uA.f = a;
-    uiA = uA.ui;
-    uB.f = b;
-    uiB = uB.ui;
+    uiA = a.v;
+    uiB = b.v;
     if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
         if (
             softfloat_isSigNaNF32UI( uiA ) || softfloat_isSigNaNF32UI( uiB )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            ctx.raiseFlags( softfloat_flag_invalid );
         }
         return false;
     }
@@ -422,36 +388,33 @@ inline bool f32_eq( float32_t a, float32_t b )
 
 }
 
-inline bool f32_isSignalingNaN( float32_t a )
+constexpr bool f32_isSignalingNaN( float32_t a )
 {
-    union ui32_f32 uA;
-
-    uA.f = a;
-    return softfloat_isSigNaNF32UI( uA.ui );
+    return softfloat_isSigNaNF32UI( a.v );
 }
 
-inline float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
+template <typename Ctx>
+constexpr float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
     int_fast16_t exp;
     uint_fast32_t uiZ, lastBitMask, roundBitsMask;
-    union ui32_f32 uZ;
+    float32_t uZ;
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    uA.f = a;
-    uiA = uA.ui;
+    uiA = a.v;
     exp = expF32UI( uiA );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( exp <= 0x7E ) {
         if ( !(uint32_t) (uiA<<1) ) return a;
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctx.raiseFlags( softfloat_flag_inexact );
         uiZ = uiA & packToF32UI( 1, 0, 0 );
         switch ( roundingMode ) {
          case softfloat_round_near_even:
             if ( !fracF32UI( uiA ) ) break;
+            [[fallthrough]];
          case softfloat_round_near_maxMag:
             if ( exp == 0x7E ) uiZ |= packToF32UI( 0, 0x7F, 0 );
             break;
@@ -467,14 +430,15 @@ inline float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool ex
             break;
 #endif
         }
-        goto uiZ;
+        uZ.v = uiZ;
+        return uZ;
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( 0x96 <= exp ) {
         if ( (exp == 0xFF) && fracF32UI( uiA ) ) {
-            uiZ = softfloat_propagateNaNF32UI( uiA, 0 );
-            goto uiZ;
+            uZ.v = softfloat_propagateNaNF32UI( uiA, 0, ctx );
+            return uZ;
         }
         return a;
     }
@@ -499,16 +463,15 @@ inline float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool ex
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) uiZ |= lastBitMask;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctx.raiseFlags( softfloat_flag_inexact );
     }
- uiZ:
-    uZ.ui = uiZ;
-    return uZ.f;
+    uZ.v = uiZ;
+    return uZ;
 }
 
-inline int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
+template <typename Ctx>
+constexpr int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx )
 {
-    union ui32_f32 uA;
     uint_fast32_t uiA;
     bool sign;
     int_fast16_t exp;
@@ -523,8 +486,7 @@ inline int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exa
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    uA.f = a;
-    uiA = uA.ui;
+    uiA = a.v;
     sign = signF32UI( uiA );
     exp  = expF32UI( uiA );
     sig  = fracF32UI( uiA );
@@ -532,7 +494,7 @@ inline int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exa
     *------------------------------------------------------------------------*/
     shiftDist = 0xBE - exp;
     if ( shiftDist < 0 ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        ctx.raiseFlags( softfloat_flag_invalid );
         return
             (exp == 0xFF) && sig ? i64_fromNaN
                 : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
@@ -548,33 +510,583 @@ inline int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exa
         sig64 = sig64Extra.v;
         extra = sig64Extra.extra;
     }
-    return softfloat_roundToI64( sign, sig64, extra, roundingMode, exact );
+    return softfloat_roundToI64( sign, sig64, extra, roundingMode, exact, ctx );
 #else
     extSig[indexWord( 3, 2 )] = sig<<8;
     extSig[indexWord( 3, 1 )] = 0;
     extSig[indexWord( 3, 0 )] = 0;
     if ( shiftDist ) softfloat_shiftRightJam96M( extSig, shiftDist, extSig );
-    return softfloat_roundMToI64( sign, extSig, roundingMode, exact );
+    return softfloat_roundMToI64( sign, extSig, roundingMode, exact, ctx );
+#endif
+
+}
+
+template <typename Ctx>
+constexpr float64_t f64_add( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    bool signA;
+    uint_fast64_t uiB;
+    bool signB;
+#if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
+    float64_t (*magsFuncPtr)( uint_fast64_t, uint_fast64_t, bool, Ctx& );
+#endif
+
+    uiA = a.v;
+    signA = signF64UI( uiA );
+    uiB = b.v;
+    signB = signF64UI( uiB );
+#if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
+    if ( signA == signB ) {
+        return softfloat_addMagsF64( uiA, uiB, signA, ctx );
+    } else {
+        return softfloat_subMagsF64( uiA, uiB, signA, ctx );
+    }
+#else
+    magsFuncPtr =
+        (signA == signB) ? softfloat_addMagsF64<Ctx> : softfloat_subMagsF64<Ctx>;
+    return (*magsFuncPtr)( uiA, uiB, signA, ctx );
+#endif
+
+}
+
+template <typename Ctx>
+constexpr float64_t f64_sub( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    bool signA;
+    uint_fast64_t uiB;
+    bool signB;
+#if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
+    float64_t (*magsFuncPtr)( uint_fast64_t, uint_fast64_t, bool, Ctx& );
+#endif
+
+    uiA = a.v;
+    signA = signF64UI( uiA );
+    uiB = b.v;
+    signB = signF64UI( uiB );
+#if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
+    if ( signA == signB ) {
+        return softfloat_subMagsF64( uiA, uiB, signA, ctx );
+    } else {
+        return softfloat_addMagsF64( uiA, uiB, signA, ctx );
+    }
+#else
+    magsFuncPtr =
+        (signA == signB) ? softfloat_subMagsF64<Ctx> : softfloat_addMagsF64<Ctx>;
+    return (*magsFuncPtr)( uiA, uiB, signA, ctx );
+#endif
+
+}
+
+template <typename Ctx>
+constexpr float64_t f64_mul( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    bool signA;
+    int_fast16_t expA;
+    uint_fast64_t sigA;
+    uint_fast64_t uiB;
+    bool signB;
+    int_fast16_t expB;
+    uint_fast64_t sigB;
+    bool signZ;
+    uint_fast64_t magBits;
+    struct exp16_sig64 normExpSig;
+    int_fast16_t expZ;
+#ifdef SOFTFLOAT_FAST_INT64
+    struct uint128 sig128Z;
+#else
+    uint32_t sig128Z[4];
+#endif
+    uint_fast64_t sigZ;
+    float64_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uiA = a.v;
+    signA = signF64UI( uiA );
+    expA  = expF64UI( uiA );
+    sigA  = fracF64UI( uiA );
+    uiB = b.v;
+    signB = signF64UI( uiB );
+    expB  = expF64UI( uiB );
+    sigB  = fracF64UI( uiB );
+    signZ = signA ^ signB;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x7FF ) {
+        if ( sigA || ((expB == 0x7FF) && sigB) ) {
+            uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+            return uZ;
+        }
+        magBits = expB | sigB;
+        if ( ! magBits ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF64UI;
+        } else {
+            uZ.v = packToF64UI( signZ, 0x7FF, 0 );
+        }
+        return uZ;
+    }
+    if ( expB == 0x7FF ) {
+        if ( sigB ) {
+            uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+            return uZ;
+        }
+        magBits = expA | sigA;
+        if ( ! magBits ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF64UI;
+        } else {
+            uZ.v = packToF64UI( signZ, 0x7FF, 0 );
+        }
+        return uZ;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expA ) {
+        if ( ! sigA ) {
+            uZ.v = packToF64UI( signZ, 0, 0 );
+            return uZ;
+        }
+        normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        if ( ! sigB ) {
+            uZ.v = packToF64UI( signZ, 0, 0 );
+            return uZ;
+        }
+        normExpSig = softfloat_normSubnormalF64Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expZ = expA + expB - 0x3FF;
+    sigA = (sigA | UINT64_C( 0x0010000000000000 ))<<10;
+    sigB = (sigB | UINT64_C( 0x0010000000000000 ))<<11;
+#ifdef SOFTFLOAT_FAST_INT64
+    sig128Z = softfloat_mul64To128( sigA, sigB );
+    sigZ = sig128Z.v64 | (sig128Z.v0 != 0);
+#else
+    softfloat_mul64To128M( sigA, sigB, sig128Z );
+    sigZ =
+        (uint64_t) sig128Z[indexWord( 4, 3 )]<<32 | sig128Z[indexWord( 4, 2 )];
+    if ( sig128Z[indexWord( 4, 1 )] || sig128Z[indexWord( 4, 0 )] ) sigZ |= 1;
+#endif
+    if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return softfloat_roundPackToF64( signZ, expZ, sigZ, ctx );
+
+}
+
+template <typename Ctx>
+constexpr float64_t f64_div( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    bool signA;
+    int_fast16_t expA;
+    uint_fast64_t sigA;
+    uint_fast64_t uiB;
+    bool signB;
+    int_fast16_t expB;
+    uint_fast64_t sigB;
+    bool signZ;
+    struct exp16_sig64 normExpSig;
+    int_fast16_t expZ;
+    uint32_t recip32, sig32Z, doubleTerm;
+    uint_fast64_t rem;
+    uint32_t q;
+    uint_fast64_t sigZ;
+    float64_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uiA = a.v;
+    signA = signF64UI( uiA );
+    expA  = expF64UI( uiA );
+    sigA  = fracF64UI( uiA );
+    uiB = b.v;
+    signB = signF64UI( uiB );
+    expB  = expF64UI( uiB );
+    sigB  = fracF64UI( uiB );
+    signZ = signA ^ signB;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x7FF ) {
+        if ( sigA ) {
+            uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+            return uZ;
+        }
+        if ( expB == 0x7FF ) {
+            if ( sigB ) {
+                uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                return uZ;
+            }
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF64UI;
+            return uZ;
+        }
+        uZ.v = packToF64UI( signZ, 0x7FF, 0 );
+        return uZ;
+    }
+    if ( expB == 0x7FF ) {
+        if ( sigB ) {
+            uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+            return uZ;
+        }
+        uZ.v = packToF64UI( signZ, 0, 0 );
+        return uZ;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        if ( ! sigB ) {
+            if ( ! (expA | sigA) ) {
+                ctx.raiseFlags( softfloat_flag_invalid );
+                uZ.v = defaultNaNF64UI;
+                return uZ;
+            }
+            ctx.raiseFlags( softfloat_flag_infinite );
+            uZ.v = packToF64UI( signZ, 0x7FF, 0 );
+            return uZ;
+        }
+        normExpSig = softfloat_normSubnormalF64Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        if ( ! sigA ) {
+            uZ.v = packToF64UI( signZ, 0, 0 );
+            return uZ;
+        }
+        normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expZ = expA - expB + 0x3FE;
+    sigA |= UINT64_C( 0x0010000000000000 );
+    sigB |= UINT64_C( 0x0010000000000000 );
+    if ( sigA < sigB ) {
+        --expZ;
+        sigA <<= 11;
+    } else {
+        sigA <<= 10;
+    }
+    sigB <<= 11;
+    recip32 = softfloat_approxRecip32_1( sigB>>32 ) - 2;
+    sig32Z = ((uint32_t) (sigA>>32) * (uint_fast64_t) recip32)>>32;
+    doubleTerm = sig32Z<<1;
+    rem =
+        ((sigA - (uint_fast64_t) doubleTerm * (uint32_t) (sigB>>32))<<28)
+            - (uint_fast64_t) doubleTerm * ((uint32_t) sigB>>4);
+    q = (((uint32_t) (rem>>32) * (uint_fast64_t) recip32)>>32) + 4;
+    sigZ = ((uint_fast64_t) sig32Z<<32) + ((uint_fast64_t) q<<4);
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (sigZ & 0x1FF) < 4<<4 ) {
+        q &= ~7;
+        sigZ &= ~(uint_fast64_t) 0x7F;
+        doubleTerm = q<<1;
+        rem =
+            ((rem - (uint_fast64_t) doubleTerm * (uint32_t) (sigB>>32))<<28)
+                - (uint_fast64_t) doubleTerm * ((uint32_t) sigB>>4);
+        if ( rem & UINT64_C( 0x8000000000000000 ) ) {
+            sigZ -= 1<<7;
+        } else {
+            if ( rem ) sigZ |= 1;
+        }
+    }
+    return softfloat_roundPackToF64( signZ, expZ, sigZ, ctx );
+
+}
+
+template <typename Ctx>
+constexpr bool f64_lt( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    uint_fast64_t uiB;
+    bool signA, signB;
+
+    uiA = a.v;
+    uiB = b.v;
+    if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
+        ctx.raiseFlags( softfloat_flag_invalid );
+        return false;
+    }
+    signA = signF64UI( uiA );
+    signB = signF64UI( uiB );
+    return
+        (signA != signB)
+            ? signA && ((uiA | uiB) & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            : (uiA != uiB) && (signA ^ (uiA < uiB));
+
+}
+
+template <typename Ctx>
+constexpr bool f64_le( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    uint_fast64_t uiB;
+    bool signA, signB;
+
+    uiA = a.v;
+    uiB = b.v;
+    if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
+        ctx.raiseFlags( softfloat_flag_invalid );
+        return false;
+    }
+    signA = signF64UI( uiA );
+    signB = signF64UI( uiB );
+    return
+        (signA != signB)
+            ? signA || ! ((uiA | uiB) & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            : (uiA == uiB) || (signA ^ (uiA < uiB));
+
+}
+
+template <typename Ctx>
+constexpr bool f64_eq( float64_t a, float64_t b, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    uint_fast64_t uiB;
+
+    uiA = a.v;
+    uiB = b.v;
+    if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
+        if (
+            softfloat_isSigNaNF64UI( uiA ) || softfloat_isSigNaNF64UI( uiB )
+        ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+        }
+        return false;
+    }
+    return
+        (uiA == uiB) || ! ((uiA | uiB) & UINT64_C( 0x7FFFFFFFFFFFFFFF ));
+
+}
+
+constexpr bool f64_isSignalingNaN( float64_t a )
+{
+    return softfloat_isSigNaNF64UI( a.v );
+}
+
+template <typename Ctx>
+constexpr float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    int_fast16_t exp;
+    uint_fast64_t uiZ, lastBitMask, roundBitsMask;
+    float64_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uiA = a.v;
+    exp = expF64UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( exp <= 0x3FE ) {
+        if ( ! (uiA & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ) return a;
+        if ( exact ) ctx.raiseFlags( softfloat_flag_inexact );
+        uiZ = uiA & packToF64UI( 1, 0, 0 );
+        switch ( roundingMode ) {
+         case softfloat_round_near_even:
+            if ( ! fracF64UI( uiA ) ) break;
+            [[fallthrough]];
+         case softfloat_round_near_maxMag:
+            if ( exp == 0x3FE ) uiZ |= packToF64UI( 0, 0x3FF, 0 );
+            break;
+         case softfloat_round_min:
+            if ( uiZ ) uiZ = packToF64UI( 1, 0x3FF, 0 );
+            break;
+         case softfloat_round_max:
+            if ( ! uiZ ) uiZ = packToF64UI( 0, 0x3FF, 0 );
+            break;
+#ifdef SOFTFLOAT_ROUND_ODD
+         case softfloat_round_odd:
+            uiZ |= packToF64UI( 0, 0x3FF, 0 );
+            break;
+#endif
+        }
+        uZ.v = uiZ;
+        return uZ;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( 0x433 <= exp ) {
+        if ( (exp == 0x7FF) && fracF64UI( uiA ) ) {
+            uZ.v = softfloat_propagateNaNF64UI( uiA, 0, ctx );
+            return uZ;
+        }
+        return a;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uiZ = uiA;
+    lastBitMask = (uint_fast64_t) 1<<(0x433 - exp);
+    roundBitsMask = lastBitMask - 1;
+    if ( roundingMode == softfloat_round_near_maxMag ) {
+        uiZ += lastBitMask>>1;
+    } else if ( roundingMode == softfloat_round_near_even ) {
+        uiZ += lastBitMask>>1;
+        if ( ! (uiZ & roundBitsMask) ) uiZ &= ~lastBitMask;
+    } else if (
+        roundingMode
+            == (signF64UI( uiZ ) ? softfloat_round_min : softfloat_round_max)
+    ) {
+        uiZ += roundBitsMask;
+    }
+    uiZ &= ~roundBitsMask;
+    if ( uiZ != uiA ) {
+#ifdef SOFTFLOAT_ROUND_ODD
+        if ( roundingMode == softfloat_round_odd ) uiZ |= lastBitMask;
+#endif
+        if ( exact ) ctx.raiseFlags( softfloat_flag_inexact );
+    }
+    uZ.v = uiZ;
+    return uZ;
+}
+
+template <typename Ctx>
+constexpr int_fast64_t f64_to_i64( float64_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx )
+{
+    uint_fast64_t uiA;
+    bool sign;
+    int_fast16_t exp;
+    uint_fast64_t sig;
+    int_fast16_t shiftDist;
+#ifdef SOFTFLOAT_FAST_INT64
+    struct uint64_extra sigExtra;
+#else
+    uint32_t extSig[3];
+#endif
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uiA = a.v;
+    sign = signF64UI( uiA );
+    exp  = expF64UI( uiA );
+    sig  = fracF64UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( exp ) sig |= UINT64_C( 0x0010000000000000 );
+    shiftDist = 0x433 - exp;
+    if ( shiftDist < -11 ) {
+        ctx.raiseFlags( softfloat_flag_invalid );
+        return
+            (exp == 0x7FF) && fracF64UI( uiA ) ? i64_fromNaN
+                : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
+    }
+#ifdef SOFTFLOAT_FAST_INT64
+    if ( shiftDist <= 0 ) {
+        sigExtra.v = sig<<-shiftDist;
+        sigExtra.extra = 0;
+    } else {
+        sigExtra = softfloat_shiftRightJam64Extra( sig, 0, shiftDist );
+    }
+    return
+        softfloat_roundToI64(
+            sign, sigExtra.v, sigExtra.extra, roundingMode, exact, ctx );
+#else
+    extSig[indexWord( 3, 0 )] = 0;
+    if ( shiftDist <= 0 ) {
+        sig <<= -shiftDist;
+        extSig[indexWord( 3, 2 )] = sig>>32;
+        extSig[indexWord( 3, 1 )] = sig;
+    } else {
+        extSig[indexWord( 3, 2 )] = sig>>32;
+        extSig[indexWord( 3, 1 )] = sig;
+        softfloat_shiftRightJam96M( extSig, shiftDist, extSig );
+    }
+    return softfloat_roundMToI64( sign, extSig, roundingMode, exact, ctx );
 #endif
 
 }
 
+/*----------------------------------------------------------------------------
+| Versions of the above which use thread-local rounding mode, tininess mode and
+| exception flags (see softfloat_types.h), as in the original SoftFloat.
+*----------------------------------------------------------------------------*/
+constexpr float32_t f32_add( float32_t a, float32_t b )
+    { tls_context ctx; return f32_add( a, b, ctx ); }
+
+constexpr float32_t f32_sub( float32_t a, float32_t b )
+    { tls_context ctx; return f32_sub( a, b, ctx ); }
+
+constexpr float32_t f32_mul( float32_t a, float32_t b )
+    { tls_context ctx; return f32_mul( a, b, ctx ); }
+
+constexpr float32_t f32_mulAdd( float32_t a, float32_t b, float32_t c )
+    { tls_context ctx; return f32_mulAdd( a, b, c, ctx ); }
+
+constexpr float32_t f32_div( float32_t a, float32_t b )
+    { tls_context ctx; return f32_div( a, b, ctx ); }
+
+constexpr bool f32_lt( float32_t a, float32_t b )
+    { tls_context ctx; return f32_lt( a, b, ctx ); }
+
+constexpr bool f32_le( float32_t a, float32_t b )
+    { tls_context ctx; return f32_le( a, b, ctx ); }
+
+constexpr bool f32_eq( float32_t a, float32_t b )
+    { tls_context ctx; return f32_eq( a, b, ctx ); }
+
+constexpr float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
+    { tls_context ctx; return f32_roundToInt( a, roundingMode, exact, ctx ); }
+
+constexpr int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
+    { tls_context ctx; return f32_to_i64( a, roundingMode, exact, ctx ); }
+
+constexpr float64_t f64_add( float64_t a, float64_t b )
+    { tls_context ctx; return f64_add( a, b, ctx ); }
+
+constexpr float64_t f64_sub( float64_t a, float64_t b )
+    { tls_context ctx; return f64_sub( a, b, ctx ); }
+
+constexpr float64_t f64_mul( float64_t a, float64_t b )
+    { tls_context ctx; return f64_mul( a, b, ctx ); }
+
+constexpr float64_t f64_div( float64_t a, float64_t b )
+    { tls_context ctx; return f64_div( a, b, ctx ); }
+
+constexpr bool f64_lt( float64_t a, float64_t b )
+    { tls_context ctx; return f64_lt( a, b, ctx ); }
+
+constexpr bool f64_le( float64_t a, float64_t b )
+    { tls_context ctx; return f64_le( a, b, ctx ); }
+
+constexpr bool f64_eq( float64_t a, float64_t b )
+    { tls_context ctx; return f64_eq( a, b, ctx ); }
+
+constexpr float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
+    { tls_context ctx; return f64_roundToInt( a, roundingMode, exact, ctx ); }
+
+constexpr int_fast64_t f64_to_i64( float64_t a, uint_fast8_t roundingMode, bool exact )
+    { tls_context ctx; return f64_to_i64( a, roundingMode, exact, ctx ); }
+
 // ----------- private implementation below --------------
 
-inline float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
+template <typename Ctx>
+constexpr float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB, Ctx& ctx )
 {
     int_fast16_t expA;
     uint_fast32_t sigA;
     int_fast16_t expB;
     uint_fast32_t sigB;
     int_fast16_t expDiff;
-    uint_fast32_t uiZ;
     int_fast32_t sigDiff;
     bool signZ;
     int_fast8_t shiftDist;
     int_fast16_t expZ;
     uint_fast32_t sigX, sigY;
-    union ui32_f32 uZ;
+    float32_t uZ;
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -589,17 +1101,20 @@ inline float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
         if ( expA == 0xFF ) {
-            if ( sigA | sigB ) goto propagateNaN;
-            softfloat_raiseFlags( softfloat_flag_invalid );
-            uiZ = defaultNaNF32UI;
-            goto uiZ;
+            if ( sigA | sigB ) {
+                uZ.v = softfloat_propagateNaNF32UI( uiA, uiB, ctx );
+                return uZ;
+            }
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF32UI;
+            return uZ;
         }
         sigDiff = sigA - sigB;
         if ( ! sigDiff ) {
-            uiZ =
+            uZ.v =
                 packToF32UI(
-                    (softfloat_roundingMode == softfloat_round_min), 0, 0 );
-            goto uiZ;
+                    (ctx.roundingMode() == softfloat_round_min), 0, 0 );
+            return uZ;
         }
         if ( expA ) --expA;
         signZ = signF32UI( uiA );
@@ -613,8 +1128,8 @@ inline float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
             shiftDist = static_cast<int_fast8_t>(expA);
             expZ = 0;
         }
-        uiZ = packToF32UI( signZ, expZ, sigDiff<<shiftDist );
-        goto uiZ;
+        uZ.v = packToF32UI( signZ, expZ, sigDiff<<shiftDist );
+        return uZ;
     } else {
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
@@ -626,9 +1141,8 @@ inline float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
             *----------------------------------------------------------------*/
             signZ = ! signZ;
             if ( expB == 0xFF ) {
-                if ( sigB ) goto propagateNaN;
-                uiZ = packToF32UI( signZ, 0xFF, 0 );
-                goto uiZ;
+                uZ.v = sigB ? softfloat_propagateNaNF32UI( uiA, uiB, ctx ) : packToF32UI( signZ, 0xFF, 0 );
+                return uZ;
             }
             expZ = expB - 1;
             sigX = sigB | 0x40000000;
@@ -638,9 +1152,8 @@ inline float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
             if ( expA == 0xFF ) {
-                if ( sigA ) goto propagateNaN;
-                uiZ = uiA;
-                goto uiZ;
+                uZ.v = sigA ? softfloat_propagateNaNF32UI( uiA, uiB, ctx ) : uiA;
+                return uZ;
             }
             expZ = expA - 1;
             sigX = sigA | 0x40000000;
@@ -648,52 +1161,45 @@ inline float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
         }
         return
             softfloat_normRoundPackToF32(
-                signZ, expZ, sigX - softfloat_shiftRightJam32( sigY, expDiff )
+                signZ, expZ, sigX - softfloat_shiftRightJam32( sigY, expDiff ), ctx
             );
     }
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
- uiZ:
-    uZ.ui = uiZ;
-    return uZ.f;
 
 }
 
 #ifdef SOFTFLOAT_BUILTIN_CLZ
 
-inline uint_fast8_t softfloat_countLeadingZeros16( uint16_t a )
+constexpr uint_fast8_t softfloat_countLeadingZeros16( uint16_t a )
     { return a ? __builtin_clz( a ) - 16 : 16; }
 
-inline uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
+constexpr uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
     { return a ? __builtin_clz( a ) : 32; }
 
-inline uint_fast8_t softfloat_countLeadingZeros64( uint64_t a )
+constexpr uint_fast8_t softfloat_countLeadingZeros64( uint64_t a )
     { return a ? __builtin_clzll( a ) : 64; }
 #else
 
-inline uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
+inline constexpr uint_least8_t softfloat_countLeadingZeros8[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+constexpr uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
 {
-    static constexpr uint_least8_t softfloat_countLeadingZeros8[256] = {
-        8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
-        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-    };
-
     uint_fast8_t count = 0;
     if ( a < 0x10000 ) {
         count = 16;
@@ -707,20 +1213,47 @@ inline uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
     return count;
 }
 
+constexpr uint_fast8_t softfloat_countLeadingZeros64( uint64_t a )
+{
+    uint_fast8_t count;
+    uint32_t a32;
+
+    count = 0;
+    a32 = a>>32;
+    if ( ! a32 ) {
+        count = 32;
+        a32 = a;
+    }
+    /*------------------------------------------------------------------------
+    | From here, result is current count + count leading zeros of `a32'.
+    *------------------------------------------------------------------------*/
+    if ( a32 < 0x10000 ) {
+        count += 16;
+        a32 <<= 16;
+    }
+    if ( a32 < 0x1000000 ) {
+        count += 8;
+        a32 <<= 8;
+    }
+    count += softfloat_countLeadingZeros8[a32>>24];
+    return count;
+
+}
+
 #endif
 
-inline float32_t softfloat_addMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
+template <typename Ctx>
+constexpr float32_t softfloat_addMagsF32( uint_fast32_t uiA, uint_fast32_t uiB, Ctx& ctx )
 {
     int_fast16_t expA;
     uint_fast32_t sigA;
     int_fast16_t expB;
     uint_fast32_t sigB;
     int_fast16_t expDiff;
-    uint_fast32_t uiZ;
     bool signZ;
     int_fast16_t expZ;
     uint_fast32_t sigZ;
-    union ui32_f32 uZ;
+    float32_t uZ;
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -730,106 +1263,281 @@ inline float32_t softfloat_addMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
     sigB = fracF32UI( uiB );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    expDiff = expA - expB;
-    if ( ! expDiff ) {
+    expDiff = expA - expB;
+    if ( ! expDiff ) {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        if ( ! expA ) {
+            uZ.v = uiA + sigB;
+            return uZ;
+        }
+        if ( expA == 0xFF ) {
+            uZ.v = (sigA | sigB) ? softfloat_propagateNaNF32UI( uiA, uiB, ctx ) : uiA;
+            return uZ;
+        }
+        signZ = signF32UI( uiA );
+        expZ = expA;
+        sigZ = 0x01000000 + sigA + sigB;
+        if ( ! (sigZ & 1) && (expZ < 0xFE) ) {
+            uZ.v = packToF32UI( signZ, expZ, sigZ>>1 );
+            return uZ;
+        }
+        sigZ <<= 6;
+    } else {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        signZ = signF32UI( uiA );
+        sigA <<= 6;
+        sigB <<= 6;
+        if ( expDiff < 0 ) {
+            if ( expB == 0xFF ) {
+                uZ.v = sigB ? softfloat_propagateNaNF32UI( uiA, uiB, ctx ) : packToF32UI( signZ, 0xFF, 0 );
+                return uZ;
+            }
+            expZ = expB;
+            sigA += expA ? 0x20000000 : sigA;
+            sigA = softfloat_shiftRightJam32( sigA, -expDiff );
+        } else {
+            if ( expA == 0xFF ) {
+                uZ.v = sigA ? softfloat_propagateNaNF32UI( uiA, uiB, ctx ) : uiA;
+                return uZ;
+            }
+            expZ = expA;
+            sigB += expB ? 0x20000000 : sigB;
+            sigB = softfloat_shiftRightJam32( sigB, expDiff );
+        }
+        sigZ = 0x20000000 + sigA + sigB;
+        if ( sigZ < 0x40000000 ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    }
+    return softfloat_roundPackToF32( signZ, expZ, sigZ, ctx );
+
+}
+
+/*----------------------------------------------------------------------------
+| Shifts 'a' right by the number of bits given in 'dist', which must not
+| be zero.  If any nonzero bits are shifted off, they are "jammed" into the
+| least-significant bit of the shifted value by setting the least-significant
+| bit to 1.  This shifted-and-jammed value is returned.
+|   The value of 'dist' can be arbitrarily large.  In particular, if 'dist' is
+| greater than 32, the result will be either 0 or 1, depending on whether 'a'
+| is zero or nonzero.
+*----------------------------------------------------------------------------*/
+constexpr uint32_t softfloat_shiftRightJam32( uint32_t a, uint_fast16_t dist )
+{
+    return (dist < 31) ? a>>dist | ((uint32_t) (a<<(neg_unsigned(dist) & 31)) != 0) : (a != 0);
+}
+
+/*----------------------------------------------------------------------------
+| Shifts 'a' right by the number of bits given in 'dist', which must be in
+| the range 1 to 63.  If any nonzero bits are shifted off, they are "jammed"
+| into the least-significant bit of the shifted value by setting the least-
+| significant bit to 1.  This shifted-and-jammed value is returned.
+*----------------------------------------------------------------------------*/
+constexpr uint64_t softfloat_shortShiftRightJam64( uint64_t a, uint_fast8_t dist )
+{
+    return a>>dist | ((a & (((uint_fast64_t) 1<<dist) - 1)) != 0);
+}
+
+template <typename Ctx>
+constexpr float32_t
+ softfloat_mulAddF32(
+     uint_fast32_t uiA, uint_fast32_t uiB, uint_fast32_t uiC, uint_fast8_t op, Ctx& ctx )
+{
+    bool signA;
+    int_fast16_t expA;
+    uint_fast32_t sigA;
+    bool signB;
+    int_fast16_t expB;
+    uint_fast32_t sigB;
+    bool signC;
+    int_fast16_t expC;
+    uint_fast32_t sigC;
+    bool signProd;
+    uint_fast32_t magBits, uiZ;
+    struct exp16_sig32 normExpSig;
+    int_fast16_t expProd;
+    uint_fast64_t sigProd;
+    bool signZ;
+    int_fast16_t expZ;
+    uint_fast32_t sigZ;
+    int_fast16_t expDiff;
+    uint_fast64_t sig64Z, sig64C;
+    int_fast8_t shiftDist;
+    float32_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signA = signF32UI( uiA );
+    expA  = expF32UI( uiA );
+    sigA  = fracF32UI( uiA );
+    signB = signF32UI( uiB );
+    expB  = expF32UI( uiB );
+    sigB  = fracF32UI( uiB );
+    signC = signF32UI( uiC ) ^ (op == softfloat_mulAdd_subC);
+    expC  = expF32UI( uiC );
+    sigC  = fracF32UI( uiC );
+    signProd = signA ^ signB ^ (op == softfloat_mulAdd_subProd);
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0xFF) || (expB == 0xFF) ) {
+        if ( (expA == 0xFF) ? (sigA || ((expB == 0xFF) && sigB)) : sigB ) {
+            /*----------------------------------------------------------------
+            | propagate NaN from A, B (and then C)
+            *----------------------------------------------------------------*/
+            uZ.v = softfloat_propagateNaNF32UI(
+                       softfloat_propagateNaNF32UI( uiA, uiB, ctx ), uiC, ctx );
+            return uZ;
+        }
+        /*--------------------------------------------------------------------
+        | infinite product
+        *--------------------------------------------------------------------*/
+        magBits = (expA == 0xFF) ? (expB | sigB) : (expA | sigA);
+        if ( magBits ) {
+            uiZ = packToF32UI( signProd, 0xFF, 0 );
+            if ( expC != 0xFF ) {
+                uZ.v = uiZ;
+                return uZ;
+            }
+            if ( sigC ) {
+                uZ.v = softfloat_propagateNaNF32UI( uiZ, uiC, ctx );
+                return uZ;
+            }
+            if ( signProd == signC ) {
+                uZ.v = uiZ;
+                return uZ;
+            }
+        }
+        ctx.raiseFlags( softfloat_flag_invalid );
+        uZ.v = softfloat_propagateNaNF32UI( defaultNaNF32UI, uiC, ctx );
+        return uZ;
+    }
+    if ( expC == 0xFF ) {
+        uZ.v = sigC ? softfloat_propagateNaNF32UI( 0, uiC, ctx ) : uiC;
+        return uZ;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (! expA && ! sigA) || (! expB && ! sigB) ) {
+        /*--------------------------------------------------------------------
+        | zero product
+        *--------------------------------------------------------------------*/
+        uZ.v = uiC;
+        if ( ! (expC | sigC) && (signProd != signC) ) {
+            uZ.v =
+                packToF32UI(
+                    (ctx.roundingMode() == softfloat_round_min), 0, 0 );
+        }
+        return uZ;
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expProd = expA + expB - 0x7E;
+    sigA = (sigA | 0x00800000)<<7;
+    sigB = (sigB | 0x00800000)<<7;
+    sigProd = (uint_fast64_t) sigA * sigB;
+    if ( sigProd < UINT64_C( 0x2000000000000000 ) ) {
+        --expProd;
+        sigProd <<= 1;
+    }
+    signZ = signProd;
+    if ( ! expC ) {
+        if ( ! sigC ) {
+            expZ = expProd - 1;
+            sigZ = static_cast<uint_fast32_t>(softfloat_shortShiftRightJam64( sigProd, 31 ));
+            return softfloat_roundPackToF32( signZ, expZ, sigZ, ctx );
+        }
+        normExpSig = softfloat_normSubnormalF32Sig( sigC );
+        expC = normExpSig.exp;
+        sigC = normExpSig.sig;
+    }
+    sigC = (sigC | 0x00800000)<<6;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expDiff = expProd - expC;
+    if ( signProd == signC ) {
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
-        if ( ! expA ) {
-            uiZ = uiA + sigB;
-            goto uiZ;
-        }
-        if ( expA == 0xFF ) {
-            if ( sigA | sigB ) goto propagateNaN;
-            uiZ = uiA;
-            goto uiZ;
+        if ( expDiff <= 0 ) {
+            expZ = expC;
+            sigZ = static_cast<uint_fast32_t>(sigC + softfloat_shiftRightJam64( sigProd, 32 - expDiff ));
+        } else {
+            expZ = expProd;
+            sig64Z =
+                sigProd
+                    + softfloat_shiftRightJam64(
+                          (uint_fast64_t) sigC<<32, expDiff );
+            sigZ = static_cast<uint_fast32_t>(softfloat_shortShiftRightJam64( sig64Z, 32 ));
         }
-        signZ = signF32UI( uiA );
-        expZ = expA;
-        sigZ = 0x01000000 + sigA + sigB;
-        if ( ! (sigZ & 1) && (expZ < 0xFE) ) {
-            uiZ = packToF32UI( signZ, expZ, sigZ>>1 );
-            goto uiZ;
+        if ( sigZ < 0x40000000 ) {
+            --expZ;
+            sigZ <<= 1;
         }
-        sigZ <<= 6;
     } else {
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
-        signZ = signF32UI( uiA );
-        sigA <<= 6;
-        sigB <<= 6;
+        sig64C = (uint_fast64_t) sigC<<32;
         if ( expDiff < 0 ) {
-            if ( expB == 0xFF ) {
-                if ( sigB ) goto propagateNaN;
-                uiZ = packToF32UI( signZ, 0xFF, 0 );
-                goto uiZ;
+            signZ = signC;
+            expZ = expC;
+            sig64Z = sig64C - softfloat_shiftRightJam64( sigProd, -expDiff );
+        } else if ( ! expDiff ) {
+            expZ = expProd;
+            sig64Z = sigProd - sig64C;
+            if ( ! sig64Z ) {
+                /*------------------------------------------------------------
+                | complete cancellation
+                *------------------------------------------------------------*/
+                uZ.v =
+                    packToF32UI(
+                        (ctx.roundingMode() == softfloat_round_min), 0, 0 );
+                return uZ;
             }
-            expZ = expB;
-            sigA += expA ? 0x20000000 : sigA;
-            sigA = softfloat_shiftRightJam32( sigA, -expDiff );
-        } else {
-            if ( expA == 0xFF ) {
-                if ( sigA ) goto propagateNaN;
-                uiZ = uiA;
-                goto uiZ;
+            if ( sig64Z & UINT64_C( 0x8000000000000000 ) ) {
+                signZ = ! signZ;
+                sig64Z = neg_unsigned( sig64Z );
             }
-            expZ = expA;
-            sigB += expB ? 0x20000000 : sigB;
-            sigB = softfloat_shiftRightJam32( sigB, expDiff );
+        } else {
+            expZ = expProd;
+            sig64Z = sigProd - softfloat_shiftRightJam64( sig64C, expDiff );
         }
-        sigZ = 0x20000000 + sigA + sigB;
-        if ( sigZ < 0x40000000 ) {
-            --expZ;
-            sigZ <<= 1;
+        shiftDist = softfloat_countLeadingZeros64( sig64Z ) - 1;
+        expZ -= shiftDist;
+        shiftDist -= 32;
+        if ( shiftDist < 0 ) {
+            sigZ = static_cast<uint_fast32_t>(softfloat_shortShiftRightJam64( sig64Z, -shiftDist ));
+        } else {
+            sigZ = (uint_fast32_t) sig64Z<<shiftDist;
         }
     }
-    return softfloat_roundPackToF32( signZ, expZ, sigZ );
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
- uiZ:
-    uZ.ui = uiZ;
-    return uZ.f;
-
-}
-
-/*----------------------------------------------------------------------------
-| Shifts 'a' right by the number of bits given in 'dist', which must not
-| be zero.  If any nonzero bits are shifted off, they are "jammed" into the
-| least-significant bit of the shifted value by setting the least-significant
-| bit to 1.  This shifted-and-jammed value is returned.
-|   The value of 'dist' can be arbitrarily large.  In particular, if 'dist' is
-| greater than 32, the result will be either 0 or 1, depending on whether 'a'
-| is zero or nonzero.
-*----------------------------------------------------------------------------*/
-inline uint32_t softfloat_shiftRightJam32( uint32_t a, uint_fast16_t dist )
-{
-    return (dist < 31) ? a>>dist | ((uint32_t) (a<<(neg_unsigned(dist) & 31)) != 0) : (a != 0);
-}
+    return softfloat_roundPackToF32( signZ, expZ, sigZ, ctx );
 
-/*----------------------------------------------------------------------------
-| Shifts 'a' right by the number of bits given in 'dist', which must be in
-| the range 1 to 63.  If any nonzero bits are shifted off, they are "jammed"
-| into the least-significant bit of the shifted value by setting the least-
-| significant bit to 1.  This shifted-and-jammed value is returned.
-*----------------------------------------------------------------------------*/
-inline uint64_t softfloat_shortShiftRightJam64( uint64_t a, uint_fast8_t dist )
-{ 
-    return a>>dist | ((a & (((uint_fast64_t) 1<<dist) - 1)) != 0); 
 }
 
-inline float32_t softfloat_roundPackToF32( bool sign, int_fast16_t exp, uint_fast32_t sig )
+template <typename Ctx>
+constexpr float32_t softfloat_roundPackToF32( bool sign, int_fast16_t exp, uint_fast32_t sig, Ctx& ctx )
 {
     uint_fast8_t roundingMode;
     bool roundNearEven;
     uint_fast8_t roundIncrement, roundBits;
     bool isTiny;
-    uint_fast32_t uiZ;
-    union ui32_f32 uZ;
+    float32_t uZ;
 
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    roundingMode = softfloat_roundingMode;
+    roundingMode = ctx.roundingMode();
     roundNearEven = (roundingMode == softfloat_round_near_even);
     roundIncrement = 0x40;
     if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
@@ -847,32 +1555,33 @@ inline float32_t softfloat_roundPackToF32( bool sign, int_fast16_t exp, uint_fas
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
             isTiny =
-                (softfloat_detectTininess == softfloat_tininess_beforeRounding)
+                (ctx.detectTininess() == softfloat_tininess_beforeRounding)
                     || (exp < -1) || (sig + roundIncrement < 0x80000000);
             sig = softfloat_shiftRightJam32( sig, -exp );
             exp = 0;
             roundBits = sig & 0x7F;
             if ( isTiny && roundBits ) {
-                softfloat_raiseFlags( softfloat_flag_underflow );
+                ctx.raiseFlags( softfloat_flag_underflow );
             }
         } else if ( (0xFD < exp) || (0x80000000 <= sig + roundIncrement) ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
-            softfloat_raiseFlags(
+            ctx.raiseFlags(
                 softfloat_flag_overflow | softfloat_flag_inexact );
-            uiZ = packToF32UI( sign, 0xFF, 0 ) - ! roundIncrement;
-            goto uiZ;
+            uZ.v = packToF32UI( sign, 0xFF, 0 ) - ! roundIncrement;
+            return uZ;
         }
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     sig = (sig + roundIncrement)>>7;
     if ( roundBits ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctx.raiseFlags( softfloat_flag_inexact );
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig |= 1;
-            goto packReturn;
+            uZ.v = packToF32UI( sign, exp, sig );
+            return uZ;
         }
 #endif
     }
@@ -880,33 +1589,29 @@ inline float32_t softfloat_roundPackToF32( bool sign, int_fast16_t exp, uint_fas
     if ( ! sig ) exp = 0;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-#ifdef SOFTFLOAT_ROUND_ODD
- packReturn:
-#endif
-    uiZ = packToF32UI( sign, exp, sig );
- uiZ:
-    uZ.ui = uiZ;
-    return uZ.f;
+    uZ.v = packToF32UI( sign, exp, sig );
+    return uZ;
 
 }
 
-inline float32_t softfloat_normRoundPackToF32( bool sign, int_fast16_t exp, uint_fast32_t sig )
+template <typename Ctx>
+constexpr float32_t softfloat_normRoundPackToF32( bool sign, int_fast16_t exp, uint_fast32_t sig, Ctx& ctx )
 {
     int_fast8_t shiftDist;
-    union ui32_f32 uZ;
+    float32_t uZ;
 
     shiftDist = softfloat_countLeadingZeros32( sig ) - 1;
     exp -= shiftDist;
     if ( (7 <= shiftDist) && ((unsigned int) exp < 0xFD) ) {
-        uZ.ui = packToF32UI( sign, sig ? exp : 0, sig<<(shiftDist - 7) );
-        return uZ.f;
+        uZ.v = packToF32UI( sign, sig ? exp : 0, sig<<(shiftDist - 7) );
+        return uZ;
     } else {
-        return softfloat_roundPackToF32( sign, exp, sig<<shiftDist );
+        return softfloat_roundPackToF32( sign, exp, sig<<shiftDist, ctx );
     }
 
 }
 
-inline exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t sig )
+constexpr exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t sig )
 {
     int_fast8_t shiftDist;
     struct exp16_sig32 z;
@@ -919,6 +1624,15 @@ inline exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t sig )
 }
 
 #ifndef softfloat_approxRecip32_1
+inline constexpr uint16_t softfloat_approxRecip_1k0s[16] = {
+    0xFFC4, 0xF0BE, 0xE363, 0xD76F, 0xCCAD, 0xC2F0, 0xBA16, 0xB201,
+    0xAA97, 0xA3C6, 0x9D7A, 0x97A6, 0x923C, 0x8D32, 0x887E, 0x8417
+};
+inline constexpr uint16_t softfloat_approxRecip_1k1s[16] = {
+    0xF0F1, 0xD62C, 0xBFA1, 0xAC77, 0x9C0A, 0x8DDB, 0x8185, 0x76BA,
+    0x6D3B, 0x64D4, 0x5D5C, 0x56B1, 0x50B6, 0x4B55, 0x4679, 0x4211
+};
+
 /*----------------------------------------------------------------------------
 | Returns an approximation to the reciprocal of the number represented by 'a',
 | where 'a' is interpreted as an unsigned fixed-point number with one integer
@@ -930,17 +1644,8 @@ inline exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t sig )
 | reciprocal 1/A, and it differs from the true reciprocal by at most 2.006 ulp
 | (units in the last place).
 *----------------------------------------------------------------------------*/
-inline uint32_t softfloat_approxRecip32_1( uint32_t a )
+constexpr uint32_t softfloat_approxRecip32_1( uint32_t a )
 {
-    static constexpr uint16_t softfloat_approxRecip_1k0s[16] = {
-        0xFFC4, 0xF0BE, 0xE363, 0xD76F, 0xCCAD, 0xC2F0, 0xBA16, 0xB201,
-        0xAA97, 0xA3C6, 0x9D7A, 0x97A6, 0x923C, 0x8D32, 0x887E, 0x8417
-    };
-    static constexpr uint16_t softfloat_approxRecip_1k1s[16] = {
-        0xF0F1, 0xD62C, 0xBFA1, 0xAC77, 0x9C0A, 0x8DDB, 0x8185, 0x76BA,
-        0x6D3B, 0x64D4, 0x5D5C, 0x56B1, 0x50B6, 0x4B55, 0x4679, 0x4211
-    };
-
     int index;
     uint16_t eps, r0;
     uint32_t sigma0;
@@ -962,7 +1667,7 @@ inline uint32_t softfloat_approxRecip32_1( uint32_t a )
 
 #ifndef softfloat_shiftRightJamM
 #define softfloat_shiftRightJamM softfloat_shiftRightJamM
-inline void
+constexpr void
  softfloat_shiftRightJamM(
      uint_fast8_t size_words,
      const uint32_t *aPtr,
@@ -996,7 +1701,8 @@ inline void
                 innerDist,
                 zPtr + indexMultiwordLoBut( size_words, wordDist )
             );
-            if ( ! wordDist ) goto wordJam;
+            // nothing was shifted off entirely, so there is nothing to zero or jam
+            if ( ! wordDist ) return;
         } else {
             aPtr += indexWordLo( size_words - wordDist );
             ptr = zPtr + indexWordLo( size_words );
@@ -1012,14 +1718,13 @@ inline void
         *ptr++ = 0;
         --wordDist;
     } while ( wordDist );
- wordJam:
     if ( wordJam ) zPtr[indexWordLo( size_words )] |= 1;
 
 }
 
 #endif // softfloat_shiftRightJamM
 
-inline void
+constexpr void
  softfloat_shiftRightJam256M(
      const uint64_t *aPtr, uint_fast32_t dist, uint64_t *zPtr )
 {
@@ -1051,7 +1756,8 @@ inline void
                 innerDist,
                 zPtr + indexMultiwordLoBut( 4, wordDist )
             );
-            if ( ! wordDist ) goto wordJam;
+            // nothing was shifted off entirely, so there is nothing to zero or jam
+            if ( ! wordDist ) return;
         } else {
             aPtr += indexWordLo( 4 - wordDist );
             ptr = zPtr + indexWordLo( 4 );
@@ -1067,7 +1773,6 @@ inline void
         *ptr++ = 0;
         --wordDist;
     } while ( wordDist );
- wordJam:
     if ( wordJam ) zPtr[indexWordLo( 4 )] |= 1;
 
 }
@@ -1090,7 +1795,7 @@ inline void
 | field of the result.  The fractional part of the shifted value is modified
 | as described above and returned in the 'extra' field of the result.)
 *----------------------------------------------------------------------------*/
-inline
+constexpr
 struct uint64_extra
  softfloat_shiftRightJam64Extra(
      uint64_t a, uint64_t extra, uint_fast32_t dist )
@@ -1107,16 +1812,18 @@ struct uint64_extra
     return z;
 }
 
-inline int_fast64_t
+template <typename Ctx>
+constexpr int_fast64_t
  softfloat_roundToI64(
      bool sign,
      uint_fast64_t sig,
      uint_fast64_t sigExtra,
      uint_fast8_t roundingMode,
-     bool exact
+     bool exact,
+     Ctx& ctx
  )
 {
-    union { uint64_t ui; int64_t i; } uZ;
+    bool increment;
     int_fast64_t z;
 
     /*------------------------------------------------------------------------
@@ -1125,53 +1832,53 @@ inline int_fast64_t
         (roundingMode == softfloat_round_near_maxMag)
             || (roundingMode == softfloat_round_near_even)
     ) {
-        if ( UINT64_C( 0x8000000000000000 ) <= sigExtra ) goto increment;
+        increment = (UINT64_C( 0x8000000000000000 ) <= sigExtra);
     } else {
-        if (
+        increment =
             sigExtra
                 && (sign
                         ? (roundingMode == softfloat_round_min)
 #ifdef SOFTFLOAT_ROUND_ODD
                               || (roundingMode == softfloat_round_odd)
 #endif
-                        : (roundingMode == softfloat_round_max))
+                        : (roundingMode == softfloat_round_max));
+    }
+    if ( increment ) {
+        ++sig;
+        if ( !sig ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+            return sign ? i64_fromNegOverflow : i64_fromPosOverflow;
+        }
+        if (
+            (sigExtra == UINT64_C( 0x8000000000000000 ))
+                && (roundingMode == softfloat_round_near_even)
         ) {
- increment:
-            ++sig;
-            if ( !sig ) goto invalid;
-            if (
-                (sigExtra == UINT64_C( 0x8000000000000000 ))
-                    && (roundingMode == softfloat_round_near_even)
-            ) {
-                sig &= ~(uint_fast64_t) 1;
-            }
+            sig &= ~(uint_fast64_t) 1;
         }
     }
-    uZ.ui = sign ? neg_unsigned(sig) : sig;
-    z = uZ.i;
-    if ( z && ((z < 0) ^ sign) ) goto invalid;
+    z = static_cast<int64_t>( sign ? neg_unsigned(sig) : sig );
+    if ( z && ((z < 0) ^ sign) ) {
+        ctx.raiseFlags( softfloat_flag_invalid );
+        return sign ? i64_fromNegOverflow : i64_fromPosOverflow;
+    }
     if ( sigExtra ) {
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) z |= 1;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctx.raiseFlags( softfloat_flag_inexact );
     }
     return z;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
-    return sign ? i64_fromNegOverflow : i64_fromPosOverflow;
 
 }
 #else // non-SOFTFLOAT_FAST_INT64
-inline int_fast64_t
+template <typename Ctx>
+constexpr int_fast64_t
  softfloat_roundMToI64(
-     bool sign, uint32_t *extSigPtr, uint_fast8_t roundingMode, bool exact )
+     bool sign, uint32_t *extSigPtr, uint_fast8_t roundingMode, bool exact, Ctx& ctx )
 {
     uint64_t sig;
     uint32_t sigExtra;
-    union { uint64_t ui; int64_t i; } uZ;
+    bool increment;
     int64_t z;
 
     /*------------------------------------------------------------------------
@@ -1184,43 +1891,42 @@ inline int_fast64_t
         (roundingMode == softfloat_round_near_maxMag)
             || (roundingMode == softfloat_round_near_even)
     ) {
-        if ( 0x80000000 <= sigExtra ) goto increment;
+        increment = (0x80000000 <= sigExtra);
     } else {
-        if (
+        increment =
             sigExtra
                 && (sign
                         ? (roundingMode == softfloat_round_min)
 #ifdef SOFTFLOAT_ROUND_ODD
                               || (roundingMode == softfloat_round_odd)
 #endif
-                        : (roundingMode == softfloat_round_max))
+                        : (roundingMode == softfloat_round_max));
+    }
+    if ( increment ) {
+        ++sig;
+        if ( !sig ) {
+            ctx.raiseFlags( softfloat_flag_invalid );
+            return sign ? i64_fromNegOverflow : i64_fromPosOverflow;
+        }
+        if (
+            (sigExtra == 0x80000000)
+                && (roundingMode == softfloat_round_near_even)
         ) {
- increment:
-            ++sig;
-            if ( !sig ) goto invalid;
-            if (
-                (sigExtra == 0x80000000)
-                    && (roundingMode == softfloat_round_near_even)
-            ) {
-                sig &= ~(uint_fast64_t) 1;
-            }
+            sig &= ~(uint_fast64_t) 1;
         }
     }
-    uZ.ui = sign ? -sig : sig;
-    z = uZ.i;
-    if ( z && ((z < 0) ^ sign) ) goto invalid;
+    z = static_cast<int64_t>( sign ? neg_unsigned(sig) : sig );
+    if ( z && ((z < 0) ^ sign) ) {
+        ctx.raiseFlags( softfloat_flag_invalid );
+        return sign ? i64_fromNegOverflow : i64_fromPosOverflow;
+    }
     if ( sigExtra ) {
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) z |= 1;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctx.raiseFlags( softfloat_flag_inexact );
     }
     return z;
-    /*------------------------------------------------------------------------
-    *------------------------------------------------------------------------*/
- invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
-    return sign ? i64_fromNegOverflow : i64_fromPosOverflow;
 
 }
 #endif // SOFTFLOAT_FAST_INT64
@@ -1236,7 +1942,7 @@ inline int_fast64_t
 | to a 'size_words'-long array of 32-bit elements that concatenate in the
 | platform's normal endian order to form an N-bit integer.
 *----------------------------------------------------------------------------*/
-inline void softfloat_shortShiftRightJamM(
+constexpr void softfloat_shortShiftRightJamM(
      uint_fast8_t size_words,
      const uint32_t *aPtr,
      uint_fast8_t dist,
@@ -1263,7 +1969,7 @@ inline void softfloat_shortShiftRightJamM(
 
 }
 
-inline
+constexpr
  void
   softfloat_shortShiftRightJamM(
       uint_fast8_t size_words,
@@ -1292,6 +1998,369 @@ inline
 
 }
 
+template <typename Ctx>
+constexpr float64_t
+ softfloat_addMagsF64( uint_fast64_t uiA, uint_fast64_t uiB, bool signZ, Ctx& ctx )
+{
+    int_fast16_t expA;
+    uint_fast64_t sigA;
+    int_fast16_t expB;
+    uint_fast64_t sigB;
+    int_fast16_t expDiff;
+    int_fast16_t expZ;
+    uint_fast64_t sigZ;
+    float64_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expA = expF64UI( uiA );
+    sigA = fracF64UI( uiA );
+    expB = expF64UI( uiB );
+    sigB = fracF64UI( uiB );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expDiff = expA - expB;
+    if ( ! expDiff ) {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        if ( ! expA ) {
+            uZ.v = uiA + sigB;
+            return uZ;
+        }
+        if ( expA == 0x7FF ) {
+            if ( sigA | sigB ) {
+                uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                return uZ;
+            }
+            uZ.v = uiA;
+            return uZ;
+        }
+        expZ = expA;
+        sigZ = UINT64_C( 0x0020000000000000 ) + sigA + sigB;
+        sigZ <<= 9;
+    } else {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        sigA <<= 9;
+        sigB <<= 9;
+        if ( expDiff < 0 ) {
+            if ( expB == 0x7FF ) {
+                if ( sigB ) {
+                    uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                    return uZ;
+                }
+                uZ.v = packToF64UI( signZ, 0x7FF, 0 );
+                return uZ;
+            }
+            expZ = expB;
+            if ( expA ) {
+                sigA += UINT64_C( 0x2000000000000000 );
+            } else {
+                sigA <<= 1;
+            }
+            sigA = softfloat_shiftRightJam64( sigA, -expDiff );
+        } else {
+            if ( expA == 0x7FF ) {
+                if ( sigA ) {
+                    uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                    return uZ;
+                }
+                uZ.v = uiA;
+                return uZ;
+            }
+            expZ = expA;
+            if ( expB ) {
+                sigB += UINT64_C( 0x2000000000000000 );
+            } else {
+                sigB <<= 1;
+            }
+            sigB = softfloat_shiftRightJam64( sigB, expDiff );
+        }
+        sigZ = UINT64_C( 0x2000000000000000 ) + sigA + sigB;
+        if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    }
+    return softfloat_roundPackToF64( signZ, expZ, sigZ, ctx );
+
+}
+
+template <typename Ctx>
+constexpr float64_t
+ softfloat_subMagsF64( uint_fast64_t uiA, uint_fast64_t uiB, bool signZ, Ctx& ctx )
+{
+    int_fast16_t expA;
+    uint_fast64_t sigA;
+    int_fast16_t expB;
+    uint_fast64_t sigB;
+    int_fast16_t expDiff;
+    int_fast64_t sigDiff;
+    int_fast8_t shiftDist;
+    int_fast16_t expZ;
+    uint_fast64_t sigZ;
+    float64_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expA = expF64UI( uiA );
+    sigA = fracF64UI( uiA );
+    expB = expF64UI( uiB );
+    sigB = fracF64UI( uiB );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expDiff = expA - expB;
+    if ( ! expDiff ) {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        if ( expA == 0x7FF ) {
+            if ( sigA | sigB ) {
+                uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                return uZ;
+            }
+            ctx.raiseFlags( softfloat_flag_invalid );
+            uZ.v = defaultNaNF64UI;
+            return uZ;
+        }
+        sigDiff = sigA - sigB;
+        if ( ! sigDiff ) {
+            uZ.v =
+                packToF64UI(
+                    (ctx.roundingMode() == softfloat_round_min), 0, 0 );
+            return uZ;
+        }
+        if ( expA ) --expA;
+        if ( sigDiff < 0 ) {
+            signZ = ! signZ;
+            sigDiff = -sigDiff;
+        }
+        shiftDist = softfloat_countLeadingZeros64( sigDiff ) - 11;
+        expZ = expA - shiftDist;
+        if ( expZ < 0 ) {
+            shiftDist = expA;
+            expZ = 0;
+        }
+        uZ.v = packToF64UI( signZ, expZ, sigDiff<<shiftDist );
+        return uZ;
+    } else {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        sigA <<= 10;
+        sigB <<= 10;
+        if ( expDiff < 0 ) {
+            signZ = ! signZ;
+            if ( expB == 0x7FF ) {
+                if ( sigB ) {
+                    uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                    return uZ;
+                }
+                uZ.v = packToF64UI( signZ, 0x7FF, 0 );
+                return uZ;
+            }
+            sigA += expA ? UINT64_C( 0x4000000000000000 ) : sigA;
+            sigA = softfloat_shiftRightJam64( sigA, -expDiff );
+            sigB |= UINT64_C( 0x4000000000000000 );
+            expZ = expB;
+            sigZ = sigB - sigA;
+        } else {
+            if ( expA == 0x7FF ) {
+                if ( sigA ) {
+                    uZ.v = softfloat_propagateNaNF64UI( uiA, uiB, ctx );
+                    return uZ;
+                }
+                uZ.v = uiA;
+                return uZ;
+            }
+            sigB += expB ? UINT64_C( 0x4000000000000000 ) : sigB;
+            sigB = softfloat_shiftRightJam64( sigB, expDiff );
+            sigA |= UINT64_C( 0x4000000000000000 );
+            expZ = expA;
+            sigZ = sigA - sigB;
+        }
+        return softfloat_normRoundPackToF64( signZ, expZ - 1, sigZ, ctx );
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Shifts 'a' right by the number of bits given in 'dist', which must not
+| be zero.  If any nonzero bits are shifted off, they are "jammed" into the
+| least-significant bit of the shifted value by setting the least-significant
+| bit to 1.  This shifted-and-jammed value is returned.
+|   The value of 'dist' can be arbitrarily large.  In particular, if 'dist' is
+| greater than 64, the result will be either 0 or 1, depending on whether 'a'
+| is zero or nonzero.
+*----------------------------------------------------------------------------*/
+constexpr uint64_t softfloat_shiftRightJam64( uint64_t a, uint_fast32_t dist )
+{
+    return
+        (dist < 63) ? a>>dist | ((uint64_t) (a<<(neg_unsigned(dist) & 63)) != 0) : (a != 0);
+}
+
+template <typename Ctx>
+constexpr float64_t
+ softfloat_roundPackToF64( bool sign, int_fast16_t exp, uint_fast64_t sig, Ctx& ctx )
+{
+    uint_fast8_t roundingMode;
+    bool roundNearEven;
+    uint_fast16_t roundIncrement, roundBits;
+    bool isTiny;
+    float64_t uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundingMode = ctx.roundingMode();
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrement = 0x200;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? 0x3FF
+                : 0;
+    }
+    roundBits = sig & 0x3FF;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( 0x7FD <= (uint16_t) exp ) {
+        if ( exp < 0 ) {
+            /*----------------------------------------------------------------
+            *----------------------------------------------------------------*/
+            isTiny =
+                (ctx.detectTininess() == softfloat_tininess_beforeRounding)
+                    || (exp < -1)
+                    || (sig + roundIncrement < UINT64_C( 0x8000000000000000 ));
+            sig = softfloat_shiftRightJam64( sig, -exp );
+            exp = 0;
+            roundBits = sig & 0x3FF;
+            if ( isTiny && roundBits ) {
+                ctx.raiseFlags( softfloat_flag_underflow );
+            }
+        } else if (
+            (0x7FD < exp)
+                || (UINT64_C( 0x8000000000000000 ) <= sig + roundIncrement)
+        ) {
+            /*----------------------------------------------------------------
+            *----------------------------------------------------------------*/
+            ctx.raiseFlags(
+                softfloat_flag_overflow | softfloat_flag_inexact );
+            uZ.v = packToF64UI( sign, 0x7FF, 0 ) - ! roundIncrement;
+            return uZ;
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    sig = (sig + roundIncrement)>>10;
+    if ( roundBits ) {
+        ctx.raiseFlags( softfloat_flag_inexact );
+#ifdef SOFTFLOAT_ROUND_ODD
+        if ( roundingMode == softfloat_round_odd ) {
+            sig |= 1;
+            uZ.v = packToF64UI( sign, exp, sig );
+            return uZ;
+        }
+#endif
+    }
+    sig &= ~(uint_fast64_t) (! (roundBits ^ 0x200) & roundNearEven);
+    if ( ! sig ) exp = 0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uZ.v = packToF64UI( sign, exp, sig );
+    return uZ;
+
+}
+
+template <typename Ctx>
+constexpr float64_t
+ softfloat_normRoundPackToF64( bool sign, int_fast16_t exp, uint_fast64_t sig, Ctx& ctx )
+{
+    int_fast8_t shiftDist;
+    float64_t uZ;
+
+    shiftDist = softfloat_countLeadingZeros64( sig ) - 1;
+    exp -= shiftDist;
+    if ( (10 <= shiftDist) && ((unsigned int) exp < 0x7FD) ) {
+        uZ.v = packToF64UI( sign, sig ? exp : 0, sig<<(shiftDist - 10) );
+        return uZ;
+    } else {
+        return softfloat_roundPackToF64( sign, exp, sig<<shiftDist, ctx );
+    }
+
+}
+
+constexpr exp16_sig64 softfloat_normSubnormalF64Sig( uint_fast64_t sig )
+{
+    int_fast8_t shiftDist;
+    struct exp16_sig64 z;
+
+    shiftDist = softfloat_countLeadingZeros64( sig ) - 11;
+    z.exp = 1 - shiftDist;
+    z.sig = sig<<shiftDist;
+    return z;
+
+}
+
+#ifdef SOFTFLOAT_FAST_INT64
+
+/*----------------------------------------------------------------------------
+| Returns the 128-bit product of 'a' and 'b'.
+*----------------------------------------------------------------------------*/
+constexpr struct uint128 softfloat_mul64To128( uint64_t a, uint64_t b )
+{
+    uint32_t a32, a0, b32, b0;
+    struct uint128 z;
+    uint64_t mid1, mid;
+
+    a32 = a>>32;
+    a0 = a;
+    b32 = b>>32;
+    b0 = b;
+    z.v0 = (uint_fast64_t) a0 * b0;
+    mid1 = (uint_fast64_t) a32 * b0;
+    mid = mid1 + (uint_fast64_t) a0 * b32;
+    z.v64 = (uint_fast64_t) a32 * b32;
+    z.v64 += (uint_fast64_t) (mid < mid1)<<32 | mid>>32;
+    mid <<= 32;
+    z.v0 += mid;
+    z.v64 += (z.v0 < mid);
+    return z;
+
+}
+
+#else // non-SOFTFLOAT_FAST_INT64
+
+/*----------------------------------------------------------------------------
+| Multiplies 'a' and 'b' and stores the 128-bit product at the location
+| pointed to by 'zPtr'.  Argument 'zPtr' points to an array of four 32-bit
+| elements that concatenate in the platform's normal endian order to form a
+| 128-bit integer.
+*----------------------------------------------------------------------------*/
+constexpr void softfloat_mul64To128M( uint64_t a, uint64_t b, uint32_t *zPtr )
+{
+    uint32_t a32, a0, b32, b0;
+    uint64_t z0, mid1, z64, mid;
+
+    a32 = a>>32;
+    a0 = a;
+    b32 = b>>32;
+    b0 = b;
+    z0 = (uint64_t) a0 * b0;
+    mid1 = (uint64_t) a32 * b0;
+    mid = mid1 + (uint64_t) a0 * b32;
+    z64 = (uint64_t) a32 * b32;
+    z64 += (uint64_t) (mid < mid1)<<32 | mid>>32;
+    mid <<= 32;
+    z0 += mid;
+    zPtr[indexWord( 4, 1 )] = z0>>32;
+    zPtr[indexWord( 4, 0 )] = z0;
+    z64 += (z0 < mid);
+    zPtr[indexWord( 4, 3 )] = z64>>32;
+    zPtr[indexWord( 4, 2 )] = z64;
+
+}
+
+#endif // SOFTFLOAT_FAST_INT64
+
 } // namespace sixit::dmath::softfloat
 
 #endif // sixit_dmath_3rdparty_softfloat_inline_softfloat_functions_h_included
\ No newline at end of file
@@ -48,23 +48,44 @@ Contributors: Sherry Ignatchenko, Victor Istomin
 namespace sixit::dmath::softfloat
 {
 
-inline float32_t softfloat_subMagsF32(uint_fast32_t uiA, uint_fast32_t uiB);
-inline float32_t softfloat_addMagsF32(uint_fast32_t uiA, uint_fast32_t uiB);
-
-inline uint_fast8_t softfloat_countLeadingZeros32(uint32_t a);
-inline uint32_t softfloat_shiftRightJam32(uint32_t a, uint_fast16_t dist);
-inline uint64_t softfloat_shortShiftRightJam64(uint64_t a, uint_fast8_t dist);
-
-inline float32_t softfloat_roundPackToF32(bool sign, int_fast16_t exp, uint_fast32_t sig);
-inline float32_t softfloat_normRoundPackToF32(bool sign, int_fast16_t exp, uint_fast32_t sig);
-
-inline exp16_sig32 softfloat_normSubnormalF32Sig(uint_fast32_t);
+template <typename Ctx>
+constexpr float32_t softfloat_subMagsF32(uint_fast32_t uiA, uint_fast32_t uiB, Ctx& ctx);
+template <typename Ctx>
+constexpr float32_t softfloat_addMagsF32(uint_fast32_t uiA, uint_fast32_t uiB, Ctx& ctx);
+template <typename Ctx>
+constexpr float32_t softfloat_mulAddF32(uint_fast32_t uiA, uint_fast32_t uiB, uint_fast32_t uiC, uint_fast8_t op,
+                                        Ctx& ctx);
+template <typename Ctx>
+constexpr float64_t softfloat_subMagsF64(uint_fast64_t uiA, uint_fast64_t uiB, bool signZ, Ctx& ctx);
+template <typename Ctx>
+constexpr float64_t softfloat_addMagsF64(uint_fast64_t uiA, uint_fast64_t uiB, bool signZ, Ctx& ctx);
+
+constexpr uint_fast8_t softfloat_countLeadingZeros32(uint32_t a);
+constexpr uint_fast8_t softfloat_countLeadingZeros64(uint64_t a);
+constexpr uint32_t softfloat_shiftRightJam32(uint32_t a, uint_fast16_t dist);
+constexpr uint64_t softfloat_shortShiftRightJam64(uint64_t a, uint_fast8_t dist);
+constexpr uint64_t softfloat_shiftRightJam64(uint64_t a, uint_fast32_t dist);
+
+template <typename Ctx>
+constexpr float32_t softfloat_roundPackToF32(bool sign, int_fast16_t exp, uint_fast32_t sig, Ctx& ctx);
+template <typename Ctx>
+constexpr float32_t softfloat_normRoundPackToF32(bool sign, int_fast16_t exp, uint_fast32_t sig, Ctx& ctx);
+template <typename Ctx>
+constexpr float64_t softfloat_roundPackToF64(bool sign, int_fast16_t exp, uint_fast64_t sig, Ctx& ctx);
+template <typename Ctx>
+constexpr float64_t softfloat_normRoundPackToF64(bool sign, int_fast16_t exp, uint_fast64_t sig, Ctx& ctx);
+
+constexpr exp16_sig32 softfloat_normSubnormalF32Sig(uint_fast32_t);
+constexpr exp16_sig64 softfloat_normSubnormalF64Sig(uint_fast64_t);
 #ifndef softfloat_approxRecip32_1
-inline uint32_t softfloat_approxRecip32_1(uint32_t a);
+constexpr uint32_t softfloat_approxRecip32_1(uint32_t a);
 #endif
 
 // fwd for specializations:
-inline uint_fast32_t softfloat_propagateNaNF32UI(uint_fast32_t uiA, uint_fast32_t uiB);
+template <typename Ctx>
+constexpr uint_fast32_t softfloat_propagateNaNF32UI(uint_fast32_t uiA, uint_fast32_t uiB, Ctx& ctx);
+template <typename Ctx>
+constexpr uint_fast64_t softfloat_propagateNaNF64UI(uint_fast64_t uiA, uint_fast64_t uiB, Ctx& ctx);
 inline uint_fast16_t softfloat_propagateNaNF16UI(uint_fast16_t uiA, uint_fast16_t uiB);
 
 #ifndef softfloat_shiftRightJamM
@@ -81,25 +102,29 @@ inline uint_fast16_t softfloat_propagateNaNF16UI(uint_fast16_t uiA, uint_fast16_
 | is greater than N, the stored result will be either 0 or 1, depending on
 | whether the original N bits are all zeros.
 *----------------------------------------------------------------------------*/
-inline void softfloat_shiftRightJamM(uint_fast8_t size_words, const uint32_t* aPtr, uint32_t dist, uint32_t* zPtr);
+constexpr void softfloat_shiftRightJamM(uint_fast8_t size_words, const uint32_t* aPtr, uint32_t dist, uint32_t* zPtr);
 #endif // softfloat_shiftRightJamM
 
-inline void softfloat_shortShiftRightJamM(uint_fast8_t size_words, const uint32_t* aPtr, uint_fast8_t dist,
+constexpr void softfloat_shortShiftRightJamM(uint_fast8_t size_words, const uint32_t* aPtr, uint_fast8_t dist,
                                           uint32_t* zPtr);
 
-inline void softfloat_shortShiftRightJamM(uint_fast8_t size_words, const uint64_t* aPtr, uint_fast8_t dist,
+constexpr void softfloat_shortShiftRightJamM(uint_fast8_t size_words, const uint64_t* aPtr, uint_fast8_t dist,
                                           uint64_t* zPtr);
 
-inline void softfloat_shiftRightJam256M(const uint64_t* aPtr, uint_fast32_t dist, uint64_t* zPtr);
+constexpr void softfloat_shiftRightJam256M(const uint64_t* aPtr, uint_fast32_t dist, uint64_t* zPtr);
 
 #ifdef SOFTFLOAT_FAST_INT64
-inline uint64_extra softfloat_shiftRightJam64Extra(uint64_t a, uint64_t extra, uint_fast32_t dist);
-inline int_fast64_t softfloat_roundToI64(bool sign, uint_fast64_t sig, uint_fast64_t sigExtra,
-                                         uint_fast8_t roundingMode, bool exact);
+constexpr uint128 softfloat_mul64To128(uint64_t a, uint64_t b);
+constexpr uint64_extra softfloat_shiftRightJam64Extra(uint64_t a, uint64_t extra, uint_fast32_t dist);
+template <typename Ctx>
+constexpr int_fast64_t softfloat_roundToI64(bool sign, uint_fast64_t sig, uint_fast64_t sigExtra,
+                                         uint_fast8_t roundingMode, bool exact, Ctx& ctx);
 #else
-inline int_fast64_t
+constexpr void softfloat_mul64To128M(uint64_t a, uint64_t b, uint32_t* zPtr);
+template <typename Ctx>
+constexpr int_fast64_t
  softfloat_roundMToI64(
-     bool sign, uint32_t *extSigPtr, uint_fast8_t roundingMode, bool exact );
+     bool sign, uint32_t *extSigPtr, uint_fast8_t roundingMode, bool exact, Ctx& ctx );
 #endif
 
 } // namespace sixit::dmath::softfloat
@@ -52,18 +52,57 @@ Contributors: Sherry Ignatchenko, Victor Istomin
 namespace sixit::dmath::softfloat
 {
 
-inline float32_t f32_add( float32_t a, float32_t b );
-inline float32_t f32_sub( float32_t a, float32_t b );
-inline float32_t f32_mul( float32_t a, float32_t b );
-inline float32_t f32_div( float32_t a, float32_t b );
-
-inline bool f32_lt( float32_t a, float32_t b );
-inline bool f32_le( float32_t a, float32_t b );
-inline bool f32_eq( float32_t a, float32_t b );
-inline bool f32_isSignalingNaN( float32_t a );
-
-inline float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact );
-inline int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact );
+constexpr float32_t f32_add( float32_t a, float32_t b );
+constexpr float32_t f32_sub( float32_t a, float32_t b );
+constexpr float32_t f32_mul( float32_t a, float32_t b );
+constexpr float32_t f32_div( float32_t a, float32_t b );
+constexpr float32_t f32_mulAdd( float32_t a, float32_t b, float32_t c );
+
+constexpr bool f32_lt( float32_t a, float32_t b );
+constexpr bool f32_le( float32_t a, float32_t b );
+constexpr bool f32_eq( float32_t a, float32_t b );
+constexpr bool f32_isSignalingNaN( float32_t a );
+
+constexpr float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact );
+constexpr int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact );
+
+constexpr float64_t f64_add( float64_t a, float64_t b );
+constexpr float64_t f64_sub( float64_t a, float64_t b );
+constexpr float64_t f64_mul( float64_t a, float64_t b );
+constexpr float64_t f64_div( float64_t a, float64_t b );
+
+constexpr bool f64_lt( float64_t a, float64_t b );
+constexpr bool f64_le( float64_t a, float64_t b );
+constexpr bool f64_eq( float64_t a, float64_t b );
+constexpr bool f64_isSignalingNaN( float64_t a );
+
+constexpr float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact );
+constexpr int_fast64_t f64_to_i64( float64_t a, uint_fast8_t roundingMode, bool exact );
+
+// same as above, with rounding/exception context (see `tls_context', `static_context<>', `flags_context<>')
+template <typename Ctx> constexpr float32_t f32_add( float32_t a, float32_t b, Ctx& ctx );
+template <typename Ctx> constexpr float32_t f32_sub( float32_t a, float32_t b, Ctx& ctx );
+template <typename Ctx> constexpr float32_t f32_mul( float32_t a, float32_t b, Ctx& ctx );
+template <typename Ctx> constexpr float32_t f32_div( float32_t a, float32_t b, Ctx& ctx );
+
+template <typename Ctx> constexpr bool f32_lt( float32_t a, float32_t b, Ctx& ctx );
+template <typename Ctx> constexpr bool f32_le( float32_t a, float32_t b, Ctx& ctx );
+template <typename Ctx> constexpr bool f32_eq( float32_t a, float32_t b, Ctx& ctx );
+
+template <typename Ctx> constexpr float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx );
+template <typename Ctx> constexpr int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx );
+
+template <typename Ctx> constexpr float64_t f64_add( float64_t a, float64_t b, Ctx& ctx );
+template <typename Ctx> constexpr float64_t f64_sub( float64_t a, float64_t b, Ctx& ctx );
+template <typename Ctx> constexpr float64_t f64_mul( float64_t a, float64_t b, Ctx& ctx );
+template <typename Ctx> constexpr float64_t f64_div( float64_t a, float64_t b, Ctx& ctx );
+
+template <typename Ctx> constexpr bool f64_lt( float64_t a, float64_t b, Ctx& ctx );
+template <typename Ctx> constexpr bool f64_le( float64_t a, float64_t b, Ctx& ctx );
+template <typename Ctx> constexpr bool f64_eq( float64_t a, float64_t b, Ctx& ctx );
+
+template <typename Ctx> constexpr float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx );
+template <typename Ctx> constexpr int_fast64_t f64_to_i64( float64_t a, uint_fast8_t roundingMode, bool exact, Ctx& ctx );
 
 
 } // namespace sixit::dmath::softfloat
@@ -0,0 +1,638 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+
+/*
+* Lane-parallel versions of f32_add(), f32_sub(), f32_mul() and f32_div():
+*
+*     sixit::dmath::softfloat::f32_add_lanes<N>(const float32_t* a, const float32_t* b, float32_t* z);
+*     sixit::dmath::softfloat::f32_add_lanes<N>(const float32_t* a, const float32_t* b, float32_t* z, Ctx& ctx);
+*
+* z[i] is always bit-identical to the scalar f32_X(a[i], b[i]), and exception flags raised are the same
+* as if scalar functions were called for all the lanes.
+*
+* Helpers in the `lanes` namespace are branch-free rewrites of the respective softfloat_* functions
+* (every `if` became a select, every `goto` became a mask), operating on GCC/Clang generic vectors
+* of uint32_t's (`__attribute__((vector_size))`). No intrinsics and no floating-point instructions are
+* involved, so the results do not depend on anything but integer arithmetic.
+* A "mask" is a vector with all-ones or all-zeros in each lane.
+*
+* Branch-free code does 2-3x more work per lane than the scalar one (both paths of each `if` are calculated),
+* so it pays off only with at least 8 lanes per register; currently it means AVX2 and AVX-512 on x64.
+* Everywhere else (including MSVC, SSE2..SSE4.2 and 128-bit NEON), f32_X_lanes() just calls scalar f32_X()
+* lane by lane.
+*
+* Rounding mode and tininess detection mode are read from the context (see softfloat_types.h) once per call,
+* and flags are raised once per call.
+*
+* Lanes where any of the operands is Inf or NaN (and, for division, where divisor is zero) are rare,
+* and their handling (in particular, NaN propagation) is platform-specific, so such lanes are
+* re-calculated by the scalar functions after the main pass.
+*/
+
+#ifndef sixit_dmath_3rdparty_softfloat_inline_softfloat_lanes_h_included
+#define sixit_dmath_3rdparty_softfloat_inline_softfloat_lanes_h_included
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "softfloat_inline.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__AVX2__)
+#define SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#if defined(__AVX512F__)
+#define SIXIT_SOFTFLOAT_LANES_NATIVE_WIDTH 16
+#else
+#define SIXIT_SOFTFLOAT_LANES_NATIVE_WIDTH 8
+#endif
+#endif
+
+namespace sixit::dmath::softfloat
+{
+
+namespace lanes
+{
+
+#ifdef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+
+struct rounding
+{
+    uint_fast8_t mode;
+    bool roundNearEven;
+    uint32_t incrementPos; // roundIncrement for positive results
+    uint32_t incrementNeg; // roundIncrement for negative results
+    uint32_t tininessBeforeRounding; // mask
+
+    template <typename Ctx>
+    static rounding of(const Ctx& ctx)
+    {
+        rounding rv;
+        rv.mode = ctx.roundingMode();
+        rv.roundNearEven = rv.mode == softfloat_round_near_even;
+        bool roundNear = rv.roundNearEven || (rv.mode == softfloat_round_near_maxMag);
+        rv.incrementPos = roundNear ? 0x40 : (rv.mode == softfloat_round_max) ? 0x7F : 0;
+        rv.incrementNeg = roundNear ? 0x40 : (rv.mode == softfloat_round_min) ? 0x7F : 0;
+        rv.tininessBeforeRounding =
+            (ctx.detectTininess() == softfloat_tininess_beforeRounding) ? UINT32_C(0xFFFFFFFF) : 0;
+        return rv;
+    }
+};
+
+template <size_t N>
+struct vector_of
+{
+    // NB: alias templates lose vector_size attribute in GCC, hence the struct
+    typedef uint32_t type __attribute__((vector_size(N * sizeof(uint32_t))));
+};
+
+// masks
+
+template <typename V, typename B>
+inline V lt(V a, B b)
+{
+    return (V)(a < b);
+}
+
+template <typename V, typename B>
+inline V eq(V a, B b)
+{
+    return (V)(a == b);
+}
+
+template <typename V, typename B>
+inline V ne(V a, B b)
+{
+    return ~eq(a, b);
+}
+
+// signed comparison of lanes holding int32_t values
+template <typename V>
+inline V lts(V a, int32_t b)
+{
+    typedef int32_t S __attribute__((vector_size(sizeof(V))));
+    return (V)((S)a < b);
+}
+
+template <typename V>
+inline V lts(int32_t a, V b)
+{
+    typedef int32_t S __attribute__((vector_size(sizeof(V))));
+    return (V)(a < (S)b);
+}
+
+template <typename V, typename A, typename B>
+inline V select(V mask, A a, B b)
+{
+    return V((mask & a) | (~mask & b));
+}
+
+// arithmetic
+
+// high 32 bits of 64-bit product; low 32 bits are just a * b
+template <typename V>
+inline V mulHi(V a, V b)
+{
+    typedef uint64_t W __attribute__((vector_size(2 * sizeof(V))));
+    W p = __builtin_convertvector(a, W) * __builtin_convertvector(b, W);
+    return __builtin_convertvector(p >> 32, V);
+}
+
+template <typename V>
+inline V lookup(const uint16_t (&table)[16], V index)
+{
+    V rv;
+    for (size_t i = 0; i < sizeof(V) / sizeof(uint32_t); ++i)
+        rv[i] = table[index[i]];
+    return rv;
+}
+
+template <typename V>
+inline V packToF32(V sign, V exp, V sig)
+{
+    return (sign << 31) + (exp << 23) + sig;
+}
+
+template <typename V>
+inline V countLeadingZeros32(V a)
+{
+    V count = V{};
+    V m;
+    m = lt(a, 0x10000u);
+    count += m & 16u;
+    a = select(m, a << 16, a);
+    m = lt(a, 0x1000000u);
+    count += m & 8u;
+    a = select(m, a << 8, a);
+    m = lt(a, 0x10000000u);
+    count += m & 4u;
+    a = select(m, a << 4, a);
+    m = lt(a, 0x40000000u);
+    count += m & 2u;
+    a = select(m, a << 2, a);
+    m = lt(a, 0x80000000u);
+    count += m & 1u;
+    a = select(m, a << 1, a);
+    return count + (eq(a, 0u) & 1u);
+}
+
+// 'dist' MUST be non-zero; unlike softfloat_shiftRightJam32(), 'dist' is clamped here
+//   to avoid out-of-range shifts in lanes whose results are discarded
+template <typename V>
+inline V shiftRightJam32(V a, V dist)
+{
+    V big = ~lt(dist, 31u);
+    V d = select(big, 31u, dist);
+    V shifted = (a >> d) | (ne(a << ((32u - d) & 31u), 0u) & 1u);
+    return select(big, ne(a, 0u) & 1u, shifted);
+}
+
+// softfloat_approxRecip32_1(), always table-based, regardless of SOFTFLOAT_FAST_DIV64TO32
+//   (64-by-32 division is not available in SIMD registers)
+template <typename V>
+inline V approxRecip32_1(V a)
+{
+    static constexpr uint16_t approxRecip_1k0s[16] = {
+        0xFFC4, 0xF0BE, 0xE363, 0xD76F, 0xCCAD, 0xC2F0, 0xBA16, 0xB201,
+        0xAA97, 0xA3C6, 0x9D7A, 0x97A6, 0x923C, 0x8D32, 0x887E, 0x8417
+    };
+    static constexpr uint16_t approxRecip_1k1s[16] = {
+        0xF0F1, 0xD62C, 0xBFA1, 0xAC77, 0x9C0A, 0x8DDB, 0x8185, 0x76BA,
+        0x6D3B, 0x64D4, 0x5D5C, 0x56B1, 0x50B6, 0x4B55, 0x4679, 0x4211
+    };
+
+    V index = (a >> 27) & 0xFu;
+    V eps = (a >> 11) & 0xFFFFu;
+    V r0 = (lookup(approxRecip_1k0s, index) - ((lookup(approxRecip_1k1s, index) * eps) >> 20)) & 0xFFFFu;
+    V sigma0 = ~((mulHi(r0, a) << 25) | ((r0 * a) >> 7));
+    V r = (r0 << 16) + ((mulHi(r0, sigma0) << 8) | ((r0 * sigma0) >> 24));
+    V sqrSigma0 = mulHi(sigma0, sigma0);
+    r += mulHi(r, sqrSigma0) >> 16;
+    return r;
+}
+
+// softfloat_roundPackToF32(); 'sign' is 0 or 1, 'exp' holds int32_t values
+template <typename V>
+inline V roundPackToF32(V sign, V exp, V sig, const rounding& rnd, V& flags)
+{
+    V roundIncrement = select(V{} - sign, rnd.incrementNeg, rnd.incrementPos);
+
+    V tiny = lts(exp, 0);
+    V isTiny = rnd.tininessBeforeRounding | lts(exp, -1) | lt(sig + roundIncrement, 0x80000000u);
+    V sigTiny = shiftRightJam32(sig, (V{} - exp) | (~tiny & 1u));
+    sig = select(tiny, sigTiny, sig);
+    exp &= ~tiny;
+    V overflow = ~tiny & ~lts(exp, 0xFD) & (lts(0xFD, exp) | ~lt(sig + roundIncrement, 0x80000000u));
+
+    V roundBits = sig & 0x7Fu;
+    V inexact = ne(roundBits, 0u);
+    V sigZ = (sig + roundIncrement) >> 7;
+#ifdef SOFTFLOAT_ROUND_ODD
+    if (rnd.mode == softfloat_round_odd)
+        sigZ |= inexact & 1u;
+#endif
+    if (rnd.roundNearEven)
+        sigZ &= ~(eq(roundBits, 0x40u) & 1u);
+    exp &= ne(sigZ, 0u);
+
+    V laneFlags = (inexact & uint32_t(softfloat_flag_inexact)) |
+                  (tiny & isTiny & inexact & uint32_t(softfloat_flag_underflow));
+    flags |= select(overflow, uint32_t(softfloat_flag_overflow | softfloat_flag_inexact), laneFlags);
+    V uiOverflow = (sign << 31) + 0x7F800000u - (eq(roundIncrement, 0u) & 1u);
+    return select(overflow, uiOverflow, packToF32(sign, exp, sigZ));
+}
+
+// result of an operation before softfloat_roundPackToF32(); lanes in 'exact' mask are already final
+template <typename V>
+struct unrounded
+{
+    V sign; // 0 or 1
+    V exp;  // int32_t values
+    V sig;
+    V exact;
+    V uiExact;
+};
+
+// softfloat_roundPackToF32() for lanes which are not exact yet
+template <typename V>
+inline V roundPackToF32(const unrounded<V>& z, const rounding& rnd, V& flags)
+{
+    V roundFlags = V{};
+    V rounded = roundPackToF32(z.sign, z.exp, z.sig, rnd, roundFlags);
+    flags |= ~z.exact & roundFlags;
+    return select(z.exact, z.uiExact, rounded);
+}
+
+// softfloat_normRoundPackToF32(), without the final softfloat_roundPackToF32()
+template <typename V>
+inline unrounded<V> normRoundPackToF32(V sign, V exp, V sig)
+{
+    V shiftDist = countLeadingZeros32(sig) - 1u;
+    exp -= shiftDist;
+    V exact = ~lts(shiftDist, 7) & lt(exp, 0xFDu);
+    V uiExact = packToF32(sign, exp & ne(sig, 0u), sig << ((shiftDist - 7u) & 31u));
+    return {sign, exp, sig << (shiftDist & 31u), exact, uiExact};
+}
+
+// softfloat_normSubnormalF32Sig() applied to lanes with zero 'exp';
+//   results for lanes with zero 'sig' are meaningless and MUST be discarded by the caller
+template <typename V>
+inline void normSubnormalF32Sig(V& exp, V& sig)
+{
+    V shiftDist = (countLeadingZeros32(sig) - 8u) & 31u;
+    V subnormal = eq(exp, 0u);
+    exp = select(subnormal, 1u - shiftDist, exp);
+    sig = select(subnormal, sig << shiftDist, sig);
+}
+
+// softfloat_addMagsF32() for finite operands
+template <typename V>
+inline unrounded<V> addMagsF32(V uiA, V uiB)
+{
+    V expA = (uiA >> 23) & 0xFFu;
+    V sigA = uiA & 0x007FFFFFu;
+    V expB = (uiB >> 23) & 0xFFu;
+    V sigB = uiB & 0x007FFFFFu;
+    V signZ = uiA >> 31;
+    V expDiff = expA - expB;
+    V same = eq(expDiff, 0u);
+
+    // expDiff == 0: either exact, or rounded as usual
+    V sigSame = 0x01000000u + sigA + sigB;
+    V expAZero = eq(expA, 0u);
+    V sameExact = same & (expAZero | (eq(sigSame & 1u, 0u) & lts(expA, 0xFE)));
+    V uiSameExact = select(expAZero, uiA + sigB, packToF32(signZ, expA, sigSame >> 1));
+
+    // expDiff != 0: X is the operand with larger exponent
+    V bIsLarger = lts(expDiff, 0);
+    V expX = select(bIsLarger, expB, expA);
+    V expY = select(bIsLarger, expA, expB);
+    V sigX = select(bIsLarger, sigB, sigA) << 6;
+    V sigY = select(bIsLarger, sigA, sigB) << 6;
+    sigY += select(ne(expY, 0u), 0x20000000u, sigY);
+    sigY = shiftRightJam32(sigY, select(bIsLarger, V{} - expDiff, expDiff) | (same & 1u));
+    V sigZ = 0x20000000u + sigX + sigY;
+    V small = lt(sigZ, 0x40000000u);
+    V expZ = expX - (small & 1u);
+    sigZ = select(small, sigZ << 1, sigZ);
+
+    return {signZ, select(same, expA, expZ), select(same, sigSame << 6, sigZ), sameExact, uiSameExact};
+}
+
+// softfloat_subMagsF32() for finite operands
+template <typename V>
+inline unrounded<V> subMagsF32(V uiA, V uiB, const rounding& rnd)
+{
+    V expA = (uiA >> 23) & 0xFFu;
+    V sigA = uiA & 0x007FFFFFu;
+    V expB = (uiB >> 23) & 0xFFu;
+    V sigB = uiB & 0x007FFFFFu;
+    V expDiff = expA - expB;
+    V same = eq(expDiff, 0u);
+
+    // expDiff == 0: always exact
+    V sigDiff = sigA - sigB;
+    V negative = lts(sigDiff, 0);
+    V expSame = expA - (ne(expA, 0u) & 1u);
+    V signSame = (uiA >> 31) ^ (negative & 1u);
+    V sigAbs = select(negative, V{} - sigDiff, sigDiff);
+    V shiftDist = countLeadingZeros32(sigAbs) - 8u;
+    V expSameZ = expSame - shiftDist;
+    V denormal = lts(expSameZ, 0);
+    shiftDist = select(denormal, expSame, shiftDist);
+    expSameZ &= ~denormal;
+    uint32_t uiZero = (rnd.mode == softfloat_round_min) ? UINT32_C(0x80000000) : 0;
+    V uiSame = select(eq(sigDiff, 0u), uiZero, packToF32(signSame, expSameZ, sigAbs << (shiftDist & 31u)));
+
+    // expDiff != 0: X is the operand with larger exponent
+    V bIsLarger = lts(expDiff, 0);
+    V signZ = (uiA >> 31) ^ (bIsLarger & 1u);
+    V expX = select(bIsLarger, expB, expA);
+    V expY = select(bIsLarger, expA, expB);
+    V sigX = (select(bIsLarger, sigB, sigA) << 7) | 0x40000000u;
+    V sigY = select(bIsLarger, sigA, sigB) << 7;
+    sigY += select(ne(expY, 0u), 0x40000000u, sigY);
+    sigY = shiftRightJam32(sigY, select(bIsLarger, V{} - expDiff, expDiff) | (same & 1u));
+
+    unrounded<V> z = normRoundPackToF32(signZ, expX - 1u, sigX - sigY);
+    z.uiExact = select(same, uiSame, z.uiExact);
+    z.exact |= same;
+    return z;
+}
+
+// f32_add() for finite operands
+//   both addMags and subMags are calculated for all lanes, but rounding is done only once
+template <typename V>
+inline V addF32(V uiA, V uiB, const rounding& rnd, V& flags)
+{
+    V signsDiffer = V{} - ((uiA ^ uiB) >> 31);
+    unrounded<V> added = addMagsF32(uiA, uiB);
+    unrounded<V> subtracted = subMagsF32(uiA, uiB, rnd);
+    unrounded<V> z;
+    z.sign = select(signsDiffer, subtracted.sign, added.sign);
+    z.exp = select(signsDiffer, subtracted.exp, added.exp);
+    z.sig = select(signsDiffer, subtracted.sig, added.sig);
+    z.exact = select(signsDiffer, subtracted.exact, added.exact);
+    z.uiExact = select(signsDiffer, subtracted.uiExact, added.uiExact);
+    return roundPackToF32(z, rnd, flags);
+}
+
+// f32_mul() for finite operands
+template <typename V>
+inline V mulF32(V uiA, V uiB, const rounding& rnd, V& flags)
+{
+    V signZ = (uiA ^ uiB) >> 31;
+    V expA = (uiA >> 23) & 0xFFu;
+    V sigA = uiA & 0x007FFFFFu;
+    V expB = (uiB >> 23) & 0xFFu;
+    V sigB = uiB & 0x007FFFFFu;
+    V zero = eq(expA | sigA, 0u) | eq(expB | sigB, 0u);
+    normSubnormalF32Sig(expA, sigA);
+    normSubnormalF32Sig(expB, sigB);
+
+    V expZ = expA + expB - 0x7Fu;
+    sigA = (sigA | 0x00800000u) << 7;
+    sigB = (sigB | 0x00800000u) << 8;
+    V sigZ = mulHi(sigA, sigB) | (ne(sigA * sigB, 0u) & 1u);
+    V small = lt(sigZ, 0x40000000u);
+    expZ -= small & 1u;
+    sigZ = select(small, sigZ << 1, sigZ);
+
+    return roundPackToF32(unrounded<V>{signZ, expZ, sigZ, zero, signZ << 31}, rnd, flags);
+}
+
+// f32_div() for finite operands and non-zero divisor
+//   always uses approxRecip32_1() path of f32_div(); results are the same as with SOFTFLOAT_FAST_DIV64TO32
+template <typename V>
+inline V divF32(V uiA, V uiB, const rounding& rnd, V& flags)
+{
+    V signZ = (uiA ^ uiB) >> 31;
+    V expA = (uiA >> 23) & 0xFFu;
+    V sigA = uiA & 0x007FFFFFu;
+    V expB = (uiB >> 23) & 0xFFu;
+    V sigB = uiB & 0x007FFFFFu;
+    V zero = eq(expA | sigA, 0u);
+    normSubnormalF32Sig(expA, sigA);
+    normSubnormalF32Sig(expB, sigB);
+
+    V expZ = expA - expB + 0x7Eu;
+    sigA |= 0x00800000u;
+    sigB |= 0x00800000u;
+    V small = lt(sigA, sigB);
+    expZ -= small & 1u;
+    sigA = select(small, sigA << 8, sigA << 7);
+    sigB <<= 8;
+    V sigZ = mulHi(sigA, approxRecip32_1(sigB)) + 2u;
+
+    // rem = (sigA << 31) - sigTrunc * sigB, as a 64-bit remHi:remLo
+    V sigTrunc = sigZ & ~3u;
+    V productLo = sigTrunc * sigB;
+    V remLo = (sigA << 31) - productLo;
+    V remHi = (sigA >> 1) - mulHi(sigTrunc, sigB) - (lt(sigA << 31, productLo) & 1u);
+    V sigFixed = select(V{} - (remHi >> 31), sigTrunc - 4u, sigTrunc | (ne(remHi | remLo, 0u) & 1u));
+    sigZ = select(lt(sigZ & 0x3Fu, 2u), sigFixed, sigZ);
+
+    return roundPackToF32(unrounded<V>{signZ, expZ, sigZ, zero, signZ << 31}, rnd, flags);
+}
+
+template <typename V>
+inline V isInfOrNaN(V ui)
+{
+    return eq(ui & 0x7F800000u, 0x7F800000u);
+}
+
+template <size_t N>
+constexpr size_t chunk_width = N < SIXIT_SOFTFLOAT_LANES_NATIVE_WIDTH ? N : SIXIT_SOFTFLOAT_LANES_NATIVE_WIDTH;
+
+template <size_t N>
+constexpr bool is_vectorizable = chunk_width<N> >= 8 && N % chunk_width<N> == 0;
+
+// vectors wider than hardware registers are handled by compilers quite poorly, so N is split
+//   into chunks of native width
+template <size_t N, typename Ctx, typename IsSpecial, typename Kernel, typename ScalarOp>
+inline void apply(const float32_t* a, const float32_t* b, float32_t* z, Ctx& ctx, IsSpecial&& isSpecial,
+                  Kernel&& kernel, ScalarOp&& scalarOp)
+{
+    constexpr size_t W = chunk_width<N>;
+    using V = typename vector_of<W>::type;
+    static_assert(sizeof(V) == W * sizeof(float32_t));
+
+    rounding rnd = rounding::of(ctx);
+    V flags = V{};
+    V specials = V{};
+    uint32_t specialLanes[N];
+    for (size_t chunk = 0; chunk < N; chunk += W)
+    {
+        V uiA, uiB;
+        memcpy(&uiA, a + chunk, sizeof(V));
+        memcpy(&uiB, b + chunk, sizeof(V));
+        V special = isSpecial(uiA, uiB);
+        V laneFlags = V{};
+        V uiZ = kernel(uiA, uiB, rnd, laneFlags);
+        flags |= laneFlags & ~special;
+        specials |= special;
+        memcpy(z + chunk, &uiZ, sizeof(V));
+        memcpy(specialLanes + chunk, &special, sizeof(V));
+    }
+
+    uint32_t allFlags = 0;
+    uint32_t anySpecial = 0;
+    for (size_t i = 0; i < W; ++i)
+    {
+        allFlags |= flags[i];
+        anySpecial |= specials[i];
+    }
+    if (allFlags)
+        ctx.raiseFlags(uint_fast8_t(allFlags));
+    if (anySpecial)
+    {
+        for (size_t i = 0; i < N; ++i)
+            if (specialLanes[i])
+                z[i] = scalarOp(a[i], b[i]);
+    }
+}
+
+#endif // SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+
+} // namespace lanes
+
+template <size_t N, typename Ctx>
+inline void f32_add_lanes(const float32_t* a, const float32_t* b, float32_t* z, Ctx& ctx)
+{
+#ifdef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+    if constexpr (lanes::is_vectorizable<N>)
+        return lanes::apply<N>(
+            a, b, z, ctx, [](auto uiA, auto uiB) { return lanes::isInfOrNaN(uiA) | lanes::isInfOrNaN(uiB); },
+            [](auto uiA, auto uiB, const lanes::rounding& rnd, auto& flags) {
+                return lanes::addF32(uiA, uiB, rnd, flags);
+            },
+            [&ctx](float32_t x, float32_t y) { return f32_add(x, y, ctx); });
+#endif
+    for (size_t i = 0; i < N; ++i)
+        z[i] = f32_add(a[i], b[i], ctx);
+}
+
+template <size_t N>
+inline void f32_add_lanes(const float32_t* a, const float32_t* b, float32_t* z)
+{
+    tls_context ctx;
+    f32_add_lanes<N>(a, b, z, ctx);
+}
+
+template <size_t N, typename Ctx>
+inline void f32_sub_lanes(const float32_t* a, const float32_t* b, float32_t* z, Ctx& ctx)
+{
+#ifdef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+    // for finite operands, f32_sub(a, b) is exactly f32_add(a, -b)
+    if constexpr (lanes::is_vectorizable<N>)
+        return lanes::apply<N>(
+            a, b, z, ctx, [](auto uiA, auto uiB) { return lanes::isInfOrNaN(uiA) | lanes::isInfOrNaN(uiB); },
+            [](auto uiA, auto uiB, const lanes::rounding& rnd, auto& flags) {
+                return lanes::addF32(uiA, uiB ^ 0x80000000u, rnd, flags);
+            },
+            [&ctx](float32_t x, float32_t y) { return f32_sub(x, y, ctx); });
+#endif
+    for (size_t i = 0; i < N; ++i)
+        z[i] = f32_sub(a[i], b[i], ctx);
+}
+
+template <size_t N>
+inline void f32_sub_lanes(const float32_t* a, const float32_t* b, float32_t* z)
+{
+    tls_context ctx;
+    f32_sub_lanes<N>(a, b, z, ctx);
+}
+
+template <size_t N, typename Ctx>
+inline void f32_mul_lanes(const float32_t* a, const float32_t* b, float32_t* z, Ctx& ctx)
+{
+#ifdef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+    if constexpr (lanes::is_vectorizable<N>)
+        return lanes::apply<N>(
+            a, b, z, ctx, [](auto uiA, auto uiB) { return lanes::isInfOrNaN(uiA) | lanes::isInfOrNaN(uiB); },
+            [](auto uiA, auto uiB, const lanes::rounding& rnd, auto& flags) {
+                return lanes::mulF32(uiA, uiB, rnd, flags);
+            },
+            [&ctx](float32_t x, float32_t y) { return f32_mul(x, y, ctx); });
+#endif
+    for (size_t i = 0; i < N; ++i)
+        z[i] = f32_mul(a[i], b[i], ctx);
+}
+
+template <size_t N>
+inline void f32_mul_lanes(const float32_t* a, const float32_t* b, float32_t* z)
+{
+    tls_context ctx;
+    f32_mul_lanes<N>(a, b, z, ctx);
+}
+
+template <size_t N, typename Ctx>
+inline void f32_div_lanes(const float32_t* a, const float32_t* b, float32_t* z, Ctx& ctx)
+{
+#ifdef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+    if constexpr (lanes::is_vectorizable<N>)
+        return lanes::apply<N>(
+            a, b, z, ctx,
+            [](auto uiA, auto uiB) {
+                return lanes::isInfOrNaN(uiA) | lanes::isInfOrNaN(uiB) | lanes::eq(uiB & 0x7FFFFFFFu, 0u);
+            },
+            [](auto uiA, auto uiB, const lanes::rounding& rnd, auto& flags) {
+                return lanes::divF32(uiA, uiB, rnd, flags);
+            },
+            [&ctx](float32_t x, float32_t y) { return f32_div(x, y, ctx); });
+#endif
+    for (size_t i = 0; i < N; ++i)
+        z[i] = f32_div(a[i], b[i], ctx);
+}
+
+template <size_t N>
+inline void f32_div_lanes(const float32_t* a, const float32_t* b, float32_t* z)
+{
+    tls_context ctx;
+    f32_div_lanes<N>(a, b, z, ctx);
+}
+
+} // namespace sixit::dmath::softfloat
+
+#ifdef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+#pragma GCC diagnostic pop
+#undef SIXIT_SOFTFLOAT_LANES_VECTOR_EXTENSIONS
+#undef SIXIT_SOFTFLOAT_LANES_NATIVE_WIDTH
+#endif
+
+#endif // sixit_dmath_3rdparty_softfloat_inline_softfloat_lanes_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
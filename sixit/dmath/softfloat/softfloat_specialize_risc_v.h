@@ -174,10 +174,11 @@ inline uint_fast16_t
 | the combined NaN result.  If either 'uiA' or 'uiB' has the pattern of a
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
-inline uint_fast32_t softfloat_propagateNaNF32UI( uint_fast32_t uiA, uint_fast32_t uiB )
+template <typename Ctx>
+constexpr uint_fast32_t softfloat_propagateNaNF32UI( uint_fast32_t uiA, uint_fast32_t uiB, Ctx& ctx )
 {
     if ( softfloat_isSigNaNF32UI( uiA ) || softfloat_isSigNaNF32UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        ctx.raiseFlags( softfloat_flag_invalid );
     }
     return defaultNaNF32UI;
 }
@@ -214,8 +215,15 @@ inline uint_fast32_t softfloat_propagateNaNF32UI( uint_fast32_t uiA, uint_fast32
 | the combined NaN result.  If either 'uiA' or 'uiB' has the pattern of a
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
-inline uint_fast64_t
- softfloat_propagateNaNF64UI( uint_fast64_t uiA, uint_fast64_t uiB );
+template <typename Ctx>
+constexpr uint_fast64_t
+ softfloat_propagateNaNF64UI( uint_fast64_t uiA, uint_fast64_t uiB, Ctx& ctx )
+{
+    if ( softfloat_isSigNaNF64UI( uiA ) || softfloat_isSigNaNF64UI( uiB ) ) {
+        ctx.raiseFlags( softfloat_flag_invalid );
+    }
+    return defaultNaNF64UI;
+}
 
 /*----------------------------------------------------------------------------
 | The bit pattern for a default generated 80-bit extended floating-point NaN.
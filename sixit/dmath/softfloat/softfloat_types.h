@@ -42,6 +42,7 @@ Contributors: Sherry Ignatchenko, Victor Istomin
 #ifndef sixit_dmath_3rdparty_softfloat_inline_softfloat_types_h_included
 #define sixit_dmath_3rdparty_softfloat_inline_softfloat_types_h_included
 #include <stdint.h>
+#include <type_traits>
 #include "platform.h"
 
 namespace sixit::dmath::softfloat
@@ -87,11 +88,66 @@ enum {
 | to substitute a result value.  If traps are not implemented, this routine
 | should be simply `softfloat_exceptionFlags |= flags;'.
 *----------------------------------------------------------------------------*/
-inline void softfloat_raiseFlags( uint_fast8_t flags )
+constexpr void softfloat_raiseFlags( uint_fast8_t flags )
 {
-    softfloat_exceptionFlags |= flags;
+    if ( ! std::is_constant_evaluated() ) softfloat_exceptionFlags |= flags;
 }
 
+/*----------------------------------------------------------------------------
+| Current rounding mode and tininess-detection mode.  The thread-local state
+| above is not accessible during constant evaluation, so there these return
+| the defaults (round to nearest/even, tininess detected before rounding),
+| and exception flags raised at compile time are discarded.
+*----------------------------------------------------------------------------*/
+constexpr uint_fast8_t softfloat_getRoundingMode()
+{
+    return std::is_constant_evaluated() ? uint_fast8_t( softfloat_round_near_even ) : softfloat_roundingMode;
+}
+
+constexpr uint_fast8_t softfloat_getDetectTininess()
+{
+    return std::is_constant_evaluated() ? uint_fast8_t( softfloat_tininess_beforeRounding ) : softfloat_detectTininess;
+}
+
+/*----------------------------------------------------------------------------
+| Rounding/exception contexts.  Every function which depends on the rounding
+| mode or raises exceptions takes a context as its last parameter `Ctx& ctx',
+| and uses only `ctx.roundingMode()', `ctx.detectTininess()' and
+| `ctx.raiseFlags( flags )':
+|   - `tls_context': thread-local state above, as in the original SoftFloat
+|     (versions of public functions without `ctx' parameter use it);
+|   - `static_context<>': modes fixed at compile time, flags discarded; the
+|     cheapest one, as no thread-local storage is touched at all;
+|   - `flags_context<>': modes fixed at compile time, flags accumulated into
+|     its `exceptionFlags' member.
+*----------------------------------------------------------------------------*/
+struct tls_context
+{
+    static constexpr uint_fast8_t roundingMode() { return softfloat_getRoundingMode(); }
+    static constexpr uint_fast8_t detectTininess() { return softfloat_getDetectTininess(); }
+    static constexpr void raiseFlags( uint_fast8_t flags ) { softfloat_raiseFlags( flags ); }
+};
+
+template <uint_fast8_t RoundingMode = softfloat_round_near_even,
+          uint_fast8_t DetectTininess = softfloat_tininess_beforeRounding>
+struct static_context
+{
+    static constexpr uint_fast8_t roundingMode() { return RoundingMode; }
+    static constexpr uint_fast8_t detectTininess() { return DetectTininess; }
+    static constexpr void raiseFlags( uint_fast8_t ) {}
+};
+
+template <uint_fast8_t RoundingMode = softfloat_round_near_even,
+          uint_fast8_t DetectTininess = softfloat_tininess_beforeRounding>
+struct flags_context
+{
+    uint_fast8_t exceptionFlags = 0;
+
+    static constexpr uint_fast8_t roundingMode() { return RoundingMode; }
+    static constexpr uint_fast8_t detectTininess() { return DetectTininess; }
+    constexpr void raiseFlags( uint_fast8_t flags ) { exceptionFlags |= flags; }
+};
+
 /*----------------------------------------------------------------------------
 | Types used to pass 16-bit, 32-bit, 64-bit, and 128-bit floating-point
 | arguments and results to/from functions.  These types must be exactly
@@ -145,7 +201,6 @@ struct uint128_extra { struct uint128 v; uint64_t extra; };
 typedef struct extFloat80M extFloat80_t;
 
 union ui16_f16 { uint16_t ui; float16_t f; };
-union ui32_f32 { uint32_t ui; float32_t f; };
 union ui64_f64 { uint64_t ui; float64_t f; };
 
 enum {
@@ -154,6 +209,7 @@ enum {
 };
 
 struct exp16_sig32 { int_fast16_t exp; uint_fast32_t sig; };
+struct exp16_sig64 { int_fast16_t exp; uint_fast64_t sig; };
 
 
 } // namespace sixit::dmath::softfloat
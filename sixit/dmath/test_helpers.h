@@ -31,6 +31,9 @@ Contributors: Sherry Ignatchenko, Dmytro Ivanchykhin, Victor Istomin
 #include "sixit/dmath/gamefloat/ieee_float_inline_asm.h"
 #include "sixit/dmath/gamefloat/ieee_float_soft.h"
 #include "sixit/dmath/gamefloat/float_with_sixit.h"
+#include "sixit/dmath/fixedpoint/fixed_point.h"
+#include "sixit/dmath/mathf/abs.h"
+#include "sixit/dmath/mathf/sign.h"
 
 //#include "sixit/rw/memory_buffers/debug_memory_buffer.h"
 //#include "sixit/rw/comparsers/cpu_specific_comparser.h"
@@ -48,6 +51,15 @@ static_assert(sixit::dmath::fp_traits<sixit::dmath::ieee_float_inline_asm>::is_s
 static_assert(sixit::dmath::fp_traits<sixit::dmath::ieee_float_shared_lib>::is_supported);
 #endif
 
+// generic mathf:: functions which work on IEEE bits must still compile for types without them
+inline void check_mathf_without_ieee_bits()
+{
+    sixit::dmath::fx32_float fx(-0.5f);
+    [[maybe_unused]] sixit::dmath::fx32_float fx_abs = sixit::dmath::mathf::abs(fx);
+    [[maybe_unused]] int fx_sign = sixit::dmath::mathf::sign(fx);
+    [[maybe_unused]] int d_sign = sixit::dmath::mathf::sign(-0.5);
+}
+
 void report_fp_related_flags()
 {
     bool none = true;
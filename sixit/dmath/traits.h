@@ -50,7 +50,7 @@ namespace sixit::dmath
             return std::isfinite(val);
         }
 
-        static int32_t get_exp(float val)
+        static constexpr int32_t get_exp(float val)
         { 
             int32_t rv = (sixit::lwa::bit_cast<uint32_t>(val) >> 23) & 0xff;
             rv -= 0x7f;
@@ -63,11 +63,11 @@ namespace sixit::dmath
             return val >= 0.f ? rv : -rv;
         }
 
-        static int64_t fp2int64(float val) {
+        static constexpr int64_t fp2int64(float val) {
             return int64_t(val);
         }
 
-        static bool set_exp(float& val, int exp) 
+        static constexpr bool set_exp(float& val, int exp) 
         { 
             exp += 127;
             if (exp < 0 || exp >= 256)
@@ -79,26 +79,32 @@ namespace sixit::dmath
             return true;
         }
 
-        static uint32_t bit_cast_to_ieee_uint32(const float& val)
+        static constexpr uint32_t bit_cast_to_ieee_uint32(const float& val)
         {
             return sixit::lwa::bit_cast<uint32_t>(val);
         }
 
-        static bool get_sign(const float& val)
+        static constexpr bool get_sign(const float& val)
         {
             return sixit::lwa::bit_cast<uint32_t>(val) >> 31;
         }
 
-        static bool equal_to_zero(const float& val)
+        static constexpr bool equal_to_zero(const float& val)
         {
             return !(sixit::lwa::bit_cast<uint32_t>(val) << 1);
         }
 
-        static float bit_cast_from_ieee_uint32(uint32_t val)
+        static constexpr float bit_cast_from_ieee_uint32(uint32_t val)
         {
             return sixit::lwa::bit_cast<float>(val);
         }
 
+        // a*b+c with a single rounding (as opposed to a*b+c expression, which may or may not be contracted)
+        static float fma(float a, float b, float c)
+        {
+            return std::fma(a, b, c);
+        }
+
         using rw_alias_type = float;
         rw_alias_type to_rw_alias_type(const float& val) {
             return rw_alias_type(val);
@@ -107,7 +113,99 @@ namespace sixit::dmath
             return { val };
         }
 
-        static auto to_fallback(const float& val) { return val; }
+        static constexpr auto to_fallback(const float& val) { return val; }
+    };
+
+    template <>
+    struct fp_traits<double>
+    {
+        static constexpr bool is_valid_fp = true;
+        static constexpr bool is_deterministic = false;
+        static constexpr bool is_fixed_point = false;
+        /** whether the platform supports this kind of FP */
+        static constexpr bool is_supported = true;
+
+        static constexpr auto display_name = sixit::lwa::string_literal_helper("double");
+
+        using intermediate_type = double;
+        using fixed_point_type = void*;
+        static constexpr int significant_bit_count = 52;
+        static constexpr uint64_t significand_mask = UINT64_C(0x000fffffffffffff);
+
+        static bool isnan(const double& val)
+        {
+            return std::isnan(val);
+        }
+
+        static bool isinf(const double& val)
+        {
+            return std::isinf(val);
+        }
+
+        static bool isfinite(const double& val)
+        {
+            return std::isfinite(val);
+        }
+
+        static constexpr int32_t get_exp(double val)
+        { 
+            int32_t rv = (sixit::lwa::bit_cast<uint64_t>(val) >> 52) & 0x7ff;
+            rv -= 0x3ff;
+            return rv;
+        }
+
+        static constexpr int64_t get_mantissa(double val)
+        {
+            uint64_t bits = sixit::lwa::bit_cast<uint64_t>(val);
+            int64_t rv((bits & significand_mask) | uint64_t(get_exp(val) > -1023) << 52);
+            return (bits >> 63) ? -rv : rv;
+        }
+
+        static constexpr int64_t fp2int64(double val) {
+            return int64_t(val);
+        }
+
+        static constexpr bool set_exp(double& val, int exp) 
+        { 
+            exp += 1023;
+            if (exp < 0 || exp >= 2048)
+                return false;
+            uint64_t rv = sixit::lwa::bit_cast<uint64_t>(val);
+            rv &= UINT64_C(0x800fffffffffffff);
+            rv |= uint64_t(exp) << 52;
+            val = sixit::lwa::bit_cast<double>(rv);
+            return true;
+        }
+
+        static constexpr uint64_t bit_cast_to_ieee_uint64(const double& val)
+        {
+            return sixit::lwa::bit_cast<uint64_t>(val);
+        }
+
+        static constexpr bool get_sign(const double& val)
+        {
+            return sixit::lwa::bit_cast<uint64_t>(val) >> 63;
+        }
+
+        static constexpr bool equal_to_zero(const double& val)
+        {
+            return !(sixit::lwa::bit_cast<uint64_t>(val) << 1);
+        }
+
+        static constexpr double bit_cast_from_ieee_uint64(uint64_t val)
+        {
+            return sixit::lwa::bit_cast<double>(val);
+        }
+
+        using rw_alias_type = double;
+        rw_alias_type to_rw_alias_type(const double& val) {
+            return rw_alias_type(val);
+        }
+        double from_rw_alias_type(rw_alias_type val) {
+            return { val };
+        }
+
+        static constexpr auto to_fallback(const double& val) { return val; }
     };
 }
 
@@ -128,6 +226,23 @@ namespace sixit::units {
             return { value };
         }
     };
+
+    template<>
+    struct dimensional_scalar_rw_alias_helper<double>
+    {
+        using value_type = double;
+        using alias_type = double;
+
+        static alias_type value2alias(const value_type& value)
+        {
+            return value;
+        }
+
+        static value_type alias2value(alias_type value)
+        {
+            return { value };
+        }
+    };
 } // namespace sixit::units
 
 
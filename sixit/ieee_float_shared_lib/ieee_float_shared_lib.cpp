@@ -0,0 +1,368 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+
+// a*b + c must stay two separately rounded operations (as multiply() followed by add()) in every build
+//   of the array functions below, so contracting it into an FMA instruction is not allowed anywhere in this file.
+//   For GCC, the array loops are also explicitly allowed to be vectorized (with runtime aliasing checks) at -O2
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off", "tree-vectorize", "vect-cost-model=dynamic")
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
+#ifndef SIXIT_IEEE_FLOAT_SHARED_LIB_BUILD
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_BUILD
+#endif
+
+#include "sixit/core/lwa.h"
+#include "sixit/ieee_float_shared_lib/ieee_float_shared_lib.h"
+
+#include <cmath>
+
+using sixit::dmath::ieee_float_shared_lib_detail;
+
+float ieee_float_shared_lib_detail::add(float lhs, float rhs)
+{
+    return lhs + rhs;
+}
+
+float ieee_float_shared_lib_detail::subtract(float lhs, float rhs)
+{
+    return lhs - rhs;
+}
+
+float ieee_float_shared_lib_detail::multiply(float lhs, float rhs)
+{
+    return lhs * rhs;
+}
+
+float ieee_float_shared_lib_detail::divide(float lhs, float rhs)
+{
+    return lhs / rhs;
+}
+
+float ieee_float_shared_lib_detail::fma(float a, float b, float c)
+{
+    // std::fma() is correctly rounded by definition, whether it is a single instruction or a library call
+    return std::fma(a, b, c);
+}
+
+bool ieee_float_shared_lib_detail::compare_lt(float lhs, float rhs)
+{
+    return lhs < rhs;
+}
+
+bool ieee_float_shared_lib_detail::compare_gt(float lhs, float rhs)
+{
+    return lhs > rhs;
+}
+
+bool ieee_float_shared_lib_detail::compare_le(float lhs, float rhs)
+{
+    return lhs <= rhs;
+}
+
+bool ieee_float_shared_lib_detail::compare_ge(float lhs, float rhs)
+{
+    return lhs >= rhs;
+}
+
+bool ieee_float_shared_lib_detail::compare_eq(float lhs, float rhs)
+{
+    return lhs == rhs;
+}
+
+float ieee_float_shared_lib_detail::negate(float value)
+{
+    return -value;
+}
+
+int64_t ieee_float_shared_lib_detail::fp2int64(float val)
+{
+    return static_cast<int64_t>(val);
+}
+
+bool ieee_float_shared_lib_detail::set_exp(float& val, int exp)
+{
+    exp += 127;
+    if (exp < 0 || exp >= 256)
+        return false;
+    uint32_t rv = sixit::lwa::bit_cast<uint32_t>(val);
+    rv &= UINT32_C(0x807fffff);
+    rv |= exp << 23;
+    val = sixit::lwa::bit_cast<float>(rv);
+    return true;
+}
+
+int32_t ieee_float_shared_lib_detail::get_mantissa(float val)
+{
+    int32_t bits = sixit::lwa::bit_cast<int32_t>(val);
+    int32_t rv = bits & INT32_C(0x7fffff);
+    bool has_implicit_bit = get_exp(val) > -127;
+    rv |= uint32_t(has_implicit_bit) << 23;
+
+    bool is_negative = bits & INT32_C(0x8000'0000);
+    return is_negative ? -rv : rv;
+}
+
+int32_t ieee_float_shared_lib_detail::get_exp(float val)
+{
+    int32_t rv = (sixit::lwa::bit_cast<uint32_t>(val) >> 23) & 0xff;
+    rv -= 127;
+    return rv;
+}
+
+bool ieee_float_shared_lib_detail::isfinite(float val)
+{
+    static constexpr uint32_t all_but_sign = 0x7fff'ffff;
+    static constexpr uint32_t exponent_mask = 0x7f80'0000;
+
+    // `exp < all_ones`
+    return (bit_cast_to_ieee_uint32(val) & all_but_sign) < exponent_mask;
+}
+
+bool ieee_float_shared_lib_detail::isinf(float val)
+{
+    static constexpr uint32_t all_but_sign = 0x7fff'ffff;
+    static constexpr uint32_t exponent_mask = 0x7f80'0000;
+
+    // `exp == all_ones && mantissa == 0`
+    return (bit_cast_to_ieee_uint32(val) & all_but_sign) == exponent_mask;
+}
+
+bool ieee_float_shared_lib_detail::isnan(float val)
+{
+    static constexpr uint32_t all_but_sign = 0x7fff'ffff;
+    static constexpr uint32_t exponent_mask = 0x7f80'0000;
+
+    // `exp == all_ones && mantissa > 0`
+    return (bit_cast_to_ieee_uint32(val) & all_but_sign) > exponent_mask;
+}
+
+uint32_t ieee_float_shared_lib_detail::bit_cast_to_ieee_uint32(float val)
+{
+    return sixit::lwa::bit_cast<uint32_t>(val);
+}
+
+bool ieee_float_shared_lib_detail::get_sign(float val)
+{
+    return sixit::lwa::bit_cast<uint32_t>(val) >> 31;
+}
+
+bool ieee_float_shared_lib_detail::equal_to_zero(float val)
+{
+    return !(sixit::lwa::bit_cast<uint32_t>(val) << 1);
+}
+
+float ieee_float_shared_lib_detail::bit_cast_from_ieee_uint32(uint32_t val)
+{
+    return sixit::lwa::bit_cast<float>(val);
+}
+
+// array versions. The loops are written once, and compiled several times below with different target ISAs
+//   (only where the compiler allows per-function targets, i.e. GCC/Clang on x86/x64; elsewhere there is just
+//   the baseline build, which is SSE2 on x64 and NEON on ARM64 anyway). Vectorized or not, each element is
+//   computed by exactly one IEEE operation (SIMD add/sub/mul/div/fma are correctly rounded as well), so all
+//   the builds produce the same bits. Loops go strictly forward, so out == a (or b, or c) is fine
+
+#if (defined(SIXIT_CPU_X64) || defined(SIXIT_CPU_X86)) && defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_X86_DISPATCH
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE inline __attribute__((always_inline))
+#else
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE inline
+#endif
+
+namespace
+{
+
+using binary_kernel = void (*)(const float* a, const float* b, float* out, size_t n);
+using ternary_kernel = void (*)(const float* a, const float* b, const float* c, float* out, size_t n);
+
+struct kernels
+{
+    binary_kernel add_n;
+    binary_kernel subtract_n;
+    binary_kernel multiply_n;
+    binary_kernel divide_n;
+    ternary_kernel mul_add_n;
+    ternary_kernel fma_n;
+    const char* isa;
+};
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE void add_loop(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] + b[i];
+}
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE void subtract_loop(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] - b[i];
+}
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE void multiply_loop(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] * b[i];
+}
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE void divide_loop(const float* a, const float* b, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] / b[i];
+}
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE void mul_add_loop(const float* a, const float* b, const float* c, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] * b[i] + c[i];
+}
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_INLINE void fma_loop(const float* a, const float* b, const float* c, float* out, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = std::fma(a[i], b[i], c[i]);
+}
+
+void add_generic(const float* a, const float* b, float* out, size_t n) { add_loop(a, b, out, n); }
+void subtract_generic(const float* a, const float* b, float* out, size_t n) { subtract_loop(a, b, out, n); }
+void multiply_generic(const float* a, const float* b, float* out, size_t n) { multiply_loop(a, b, out, n); }
+void divide_generic(const float* a, const float* b, float* out, size_t n) { divide_loop(a, b, out, n); }
+void mul_add_generic(const float* a, const float* b, const float* c, float* out, size_t n) { mul_add_loop(a, b, c, out, n); }
+void fma_generic(const float* a, const float* b, const float* c, float* out, size_t n) { fma_loop(a, b, c, out, n); }
+
+#if defined(SIXIT_CPU_X64) || (defined(SIXIT_CPU_X86) && defined(__SSE2__))
+constexpr const char* generic_isa = "sse2";
+#elif defined(SIXIT_CPU_ARM64)
+constexpr const char* generic_isa = "neon";
+#else
+constexpr const char* generic_isa = "generic";
+#endif
+
+#ifdef SIXIT_IEEE_FLOAT_SHARED_LIB_X86_DISPATCH
+
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 __attribute__((target("avx2,fma")))
+#if defined(__clang__)
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 __attribute__((target("avx512f,avx512vl,fma"), min_vector_width(512)))
+#else
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 __attribute__((target("avx512f,avx512vl,fma,prefer-vector-width=512")))
+#endif
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 void add_avx2(const float* a, const float* b, float* out, size_t n) { add_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 void subtract_avx2(const float* a, const float* b, float* out, size_t n) { subtract_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 void multiply_avx2(const float* a, const float* b, float* out, size_t n) { multiply_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 void divide_avx2(const float* a, const float* b, float* out, size_t n) { divide_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 void mul_add_avx2(const float* a, const float* b, const float* c, float* out, size_t n) { mul_add_loop(a, b, c, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX2 void fma_avx2(const float* a, const float* b, const float* c, float* out, size_t n) { fma_loop(a, b, c, out, n); }
+
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 void add_avx512(const float* a, const float* b, float* out, size_t n) { add_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 void subtract_avx512(const float* a, const float* b, float* out, size_t n) { subtract_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 void multiply_avx512(const float* a, const float* b, float* out, size_t n) { multiply_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 void divide_avx512(const float* a, const float* b, float* out, size_t n) { divide_loop(a, b, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 void mul_add_avx512(const float* a, const float* b, const float* c, float* out, size_t n) { mul_add_loop(a, b, c, out, n); }
+SIXIT_IEEE_FLOAT_SHARED_LIB_AVX512 void fma_avx512(const float* a, const float* b, const float* c, float* out, size_t n) { fma_loop(a, b, c, out, n); }
+
+#endif // SIXIT_IEEE_FLOAT_SHARED_LIB_X86_DISPATCH
+
+kernels select_kernels()
+{
+#ifdef SIXIT_IEEE_FLOAT_SHARED_LIB_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl"))
+        return {add_avx512, subtract_avx512, multiply_avx512, divide_avx512, mul_add_avx512, fma_avx512, "avx512"};
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return {add_avx2, subtract_avx2, multiply_avx2, divide_avx2, mul_add_avx2, fma_avx2, "avx2"};
+#endif
+    return {add_generic, subtract_generic, multiply_generic, divide_generic, mul_add_generic, fma_generic, generic_isa};
+}
+
+// starts as the baseline build (so that calls made before the library is fully initialized are still fine),
+//   and gets replaced with the best one for the CPU while the library is being loaded
+kernels active_kernels = {add_generic, subtract_generic, multiply_generic, divide_generic, mul_add_generic, fma_generic, generic_isa};
+const bool kernels_selected = (active_kernels = select_kernels(), true);
+
+} // namespace
+
+void ieee_float_shared_lib_detail::add_n(const float* a, const float* b, float* out, size_t n)
+{
+    active_kernels.add_n(a, b, out, n);
+}
+
+void ieee_float_shared_lib_detail::subtract_n(const float* a, const float* b, float* out, size_t n)
+{
+    active_kernels.subtract_n(a, b, out, n);
+}
+
+void ieee_float_shared_lib_detail::multiply_n(const float* a, const float* b, float* out, size_t n)
+{
+    active_kernels.multiply_n(a, b, out, n);
+}
+
+void ieee_float_shared_lib_detail::divide_n(const float* a, const float* b, float* out, size_t n)
+{
+    active_kernels.divide_n(a, b, out, n);
+}
+
+void ieee_float_shared_lib_detail::mul_add_n(const float* a, const float* b, const float* c, float* out, size_t n)
+{
+    active_kernels.mul_add_n(a, b, c, out, n);
+}
+
+void ieee_float_shared_lib_detail::fma_n(const float* a, const float* b, const float* c, float* out, size_t n)
+{
+    active_kernels.fma_n(a, b, c, out, n);
+}
+
+float ieee_float_shared_lib_detail::dot_n(const float* a, const float* b, size_t n)
+{
+    // single accumulator on purpose, so there is nothing to vectorize here: splitting the sum into several
+    //   partial ones would be faster, but it would change the order of additions, and so the result
+    float acc = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+        acc = acc + a[i] * b[i];
+    return acc;
+}
+
+const char* ieee_float_shared_lib_detail::kernels_isa()
+{
+    return active_kernels.isa;
+}
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file
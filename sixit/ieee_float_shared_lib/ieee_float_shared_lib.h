@@ -0,0 +1,394 @@
+/*
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+This file is licensed under The 3-Clause BSD License, with full text available at the end of the file.
+Contributors: Sherry Ignatchenko, Victor Istomin
+*/
+#ifndef sixit_ieee_float_shared_lib_ieee_float_shared_lib_h_included
+#define sixit_ieee_float_shared_lib_ieee_float_shared_lib_h_included
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sixit/core/core.h"
+#include "sixit/dmath/traits.h"
+
+namespace sixit::rw
+{
+// forward declaration to avoid sixit::rw dependency
+template <typename T>
+struct member_type_alias;
+} // namespace sixit::rw
+
+namespace sixit::units
+{
+// forward declatation of helper for sixit::units library
+template <typename Fp>
+struct dimensional_scalar_rw_alias_helper;
+} // namespace sixit::units
+
+/**
+ * ieee_float_shared_lib.cpp is to be built as a shared library (.so/.dylib/.dll) with
+ * SIXIT_IEEE_FLOAT_SHARED_LIB_BUILD defined; users of the header link against that library.
+ */
+#if defined(SIXIT_OS_WINDOWS) || defined(SIXIT_OS_LINUX) || defined(SIXIT_OS_MAC)
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_SUPPORTED
+#endif
+
+#if defined(SIXIT_OS_WINDOWS)
+#ifdef SIXIT_IEEE_FLOAT_SHARED_LIB_BUILD
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_API __declspec(dllexport)
+#else
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_API __declspec(dllimport)
+#endif
+#elif defined(SIXIT_COMPILER_ANY_GCC_OR_CLANG)
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_API __attribute__((visibility("default")))
+#else
+#define SIXIT_IEEE_FLOAT_SHARED_LIB_API
+#endif
+
+namespace sixit::dmath
+{
+
+class ieee_float_shared_lib;
+
+/**
+ * All-private internal implementations that should never be called directly.
+ * Please use `ieee_float_shared_lib` instead
+ *
+ * @see ieee_float_shared_lib
+ */
+class SIXIT_IEEE_FLOAT_SHARED_LIB_API ieee_float_shared_lib_detail
+{
+    // all-private
+    static float add(float lhs, float rhs);
+    static float subtract(float lhs, float rhs);
+    static float multiply(float lhs, float rhs);
+    static float divide(float lhs, float rhs);
+    static float fma(float a, float b, float c);
+    static bool compare_lt(float lhs, float rhs);
+    static bool compare_gt(float lhs, float rhs);
+    static bool compare_le(float lhs, float rhs);
+    static bool compare_ge(float lhs, float rhs);
+    static bool compare_eq(float lhs, float rhs);
+    static float negate(float value);
+
+    static int64_t fp2int64(float val);
+    static bool set_exp(float& val, int exp);
+    static int32_t get_mantissa(float val);
+    static int32_t get_exp(float val);
+    static bool isfinite(float val);
+    static bool isinf(float val);
+    static bool isnan(float val);
+    static uint32_t bit_cast_to_ieee_uint32(float val);
+    static bool get_sign(float val);
+    static bool equal_to_zero(float val);
+    static float bit_cast_from_ieee_uint32(uint32_t val);
+
+    // array versions, so that one opaque call covers the whole loop: out[i] = a[i] op b[i],
+    //   bit-identical to the scalar operations above (out may alias a, b or c)
+    //   the library carries several builds of these loops (SSE2, AVX2, AVX-512 on x86/x64; NEON on ARM64 is just
+    //   the baseline), and picks the best one for the CPU when it is loaded; as every element is computed by exactly
+    //   one IEEE operation in all of them, the choice never affects the results
+    static void add_n(const float* a, const float* b, float* out, size_t n);
+    static void subtract_n(const float* a, const float* b, float* out, size_t n);
+    static void multiply_n(const float* a, const float* b, float* out, size_t n);
+    static void divide_n(const float* a, const float* b, float* out, size_t n);
+    // out[i] = a[i]*b[i] + c[i], rounded twice (as multiply() followed by add())
+    static void mul_add_n(const float* a, const float* b, const float* c, float* out, size_t n);
+    // out[i] = fma(a[i], b[i], c[i]), rounded once
+    static void fma_n(const float* a, const float* b, const float* c, float* out, size_t n);
+    // ((0 + a[0]*b[0]) + a[1]*b[1]) + ..., each operation rounded separately, strictly in this order
+    static float dot_n(const float* a, const float* b, size_t n);
+    // name of the instruction set picked for the array versions ("sse2", "avx2", "avx512", "neon", or "generic")
+    static const char* kernels_isa();
+
+    friend sixit::dmath::ieee_float_shared_lib;
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+};
+
+#ifdef SIXIT_IEEE_FLOAT_SHARED_LIB_SUPPORTED
+
+/**
+ * Shared library based deterministic float.
+ *
+ * Same as `ieee_float_static_lib`, but operations are hidden inside a shared library, so
+ * unlike `ieee_float_static_lib`, it stays deterministic with LTO/LTCG and unity builds:
+ * no compiler or linker can inline calls across the shared library boundary.
+ */
+class ieee_float_shared_lib
+{
+  public:
+    float to_float() const
+    {
+        return static_cast<float>(*this);
+    }
+
+    constexpr ieee_float_shared_lib() noexcept = default;
+    ieee_float_shared_lib(const ieee_float_shared_lib& other) noexcept = default;
+    ieee_float_shared_lib(ieee_float_shared_lib&& other) noexcept = default;
+    constexpr ieee_float_shared_lib(const float& other) : data(other){};
+
+    ieee_float_shared_lib& operator=(const ieee_float_shared_lib& other) = default;
+
+    ieee_float_shared_lib operator+(ieee_float_shared_lib other) const
+    {
+        return ieee_float_shared_lib_detail::add(data, other.data);
+    }
+
+    ieee_float_shared_lib operator-(ieee_float_shared_lib other) const
+    {
+        return ieee_float_shared_lib_detail::subtract(data, other.data);
+    }
+
+    ieee_float_shared_lib operator*(ieee_float_shared_lib other) const
+    {
+        return ieee_float_shared_lib_detail::multiply(data, other.data);
+    }
+
+    ieee_float_shared_lib operator/(ieee_float_shared_lib other) const
+    {
+        return ieee_float_shared_lib_detail::divide(data, other.data);
+    }
+
+    bool operator<(const ieee_float_shared_lib& other) const
+    {
+        return ieee_float_shared_lib_detail::compare_lt(data, other.data);
+    }
+
+    bool operator>(const ieee_float_shared_lib& other) const
+    {
+        return ieee_float_shared_lib_detail::compare_gt(data, other.data);
+    }
+
+    bool operator<=(const ieee_float_shared_lib& other) const
+    {
+        return ieee_float_shared_lib_detail::compare_le(data, other.data);
+    }
+
+    bool operator>=(const ieee_float_shared_lib& other) const
+    {
+        return ieee_float_shared_lib_detail::compare_ge(data, other.data);
+    }
+
+    bool operator==(const ieee_float_shared_lib& other) const
+    {
+        return ieee_float_shared_lib_detail::compare_eq(data, other.data);
+    }
+
+    ieee_float_shared_lib operator-() const
+    {
+        return ieee_float_shared_lib_detail::negate(data);
+    }
+
+  private:
+    float data = {};
+
+    operator float() const
+    {
+        return data;
+    }
+
+    struct rw_alias
+    {
+        using value_type = ieee_float_shared_lib;
+        using alias_type = float;
+        using type = float; // todo: ask DI for rw refactoring to use alias_type instead?
+
+        static alias_type value2alias(const value_type& value)
+        {
+            return value.to_float();
+        }
+
+        static value_type alias2value(alias_type value)
+        {
+            return {value};
+        }
+    };
+
+    friend struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_float_shared_lib>;
+    friend struct sixit::rw::member_type_alias<ieee_float_shared_lib>;
+
+    template <typename fp>
+    friend struct sixit::dmath::fp_traits;
+};
+
+template <>
+struct fp_traits<ieee_float_shared_lib>
+{
+    static constexpr bool is_valid_fp = true;
+    static constexpr bool is_deterministic = true;
+    static constexpr bool is_fixed_point = false;
+    static constexpr bool is_supported = true;
+
+    static constexpr auto display_name = sixit::lwa::string_literal_helper("ieee_float_shared_lib");
+
+    using intermediate_type = float;
+    using fixed_point_type = void*;
+
+    static int64_t fp2int64(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::fp2int64(val.data);
+    }
+
+    static bool set_exp(ieee_float_shared_lib& val, int exp)
+    {
+        return ieee_float_shared_lib_detail::set_exp(val.data, exp);
+    }
+
+    static int32_t get_mantissa(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::get_mantissa(val.data);
+    }
+
+    static int32_t get_exp(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::get_exp(val.data);
+    }
+
+    static bool isfinite(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::isfinite(val.data);
+    }
+
+    static bool isinf(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::isinf(val.data);
+    }
+
+    static bool isnan(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::isnan(val.data);
+    }
+
+    static uint32_t bit_cast_to_ieee_uint32(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::bit_cast_to_ieee_uint32(val.data);
+    }
+
+    static bool get_sign(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::get_sign(val.data);
+    }
+
+    static bool equal_to_zero(ieee_float_shared_lib val)
+    {
+        return ieee_float_shared_lib_detail::equal_to_zero(val.data);
+    }
+
+    static ieee_float_shared_lib bit_cast_from_ieee_uint32(uint32_t val)
+    {
+        return ieee_float_shared_lib(ieee_float_shared_lib_detail::bit_cast_from_ieee_uint32(val));
+    }
+
+    // a*b+c with a single rounding
+    static ieee_float_shared_lib fma(ieee_float_shared_lib a, ieee_float_shared_lib b, ieee_float_shared_lib c)
+    {
+        return ieee_float_shared_lib(ieee_float_shared_lib_detail::fma(a.data, b.data, c.data));
+    }
+
+    static auto to_fallback(ieee_float_shared_lib val) { return val; }
+
+    // array entry points (see ieee_float_shared_lib_detail); used by sixit::dmath::mathf::batch:: arithmetic,
+    //   run by the best instruction set available on the CPU, with the same results on all of them
+    static const char* kernels_isa()
+    {
+        return ieee_float_shared_lib_detail::kernels_isa();
+    }
+    static void add_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, ieee_float_shared_lib* out, size_t n)
+    {
+        ieee_float_shared_lib_detail::add_n(&a->data, &b->data, &out->data, n);
+    }
+    static void subtract_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, ieee_float_shared_lib* out, size_t n)
+    {
+        ieee_float_shared_lib_detail::subtract_n(&a->data, &b->data, &out->data, n);
+    }
+    static void multiply_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, ieee_float_shared_lib* out, size_t n)
+    {
+        ieee_float_shared_lib_detail::multiply_n(&a->data, &b->data, &out->data, n);
+    }
+    static void divide_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, ieee_float_shared_lib* out, size_t n)
+    {
+        ieee_float_shared_lib_detail::divide_n(&a->data, &b->data, &out->data, n);
+    }
+    static void mul_add_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, const ieee_float_shared_lib* c, ieee_float_shared_lib* out, size_t n)
+    {
+        ieee_float_shared_lib_detail::mul_add_n(&a->data, &b->data, &c->data, &out->data, n);
+    }
+    static void fma_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, const ieee_float_shared_lib* c, ieee_float_shared_lib* out, size_t n)
+    {
+        ieee_float_shared_lib_detail::fma_n(&a->data, &b->data, &c->data, &out->data, n);
+    }
+    static ieee_float_shared_lib dot_n(const ieee_float_shared_lib* a, const ieee_float_shared_lib* b, size_t n)
+    {
+        return ieee_float_shared_lib(ieee_float_shared_lib_detail::dot_n(&a->data, &b->data, n));
+    }
+};
+// array entry points above treat arrays of ieee_float_shared_lib as arrays of float
+static_assert(sizeof(ieee_float_shared_lib) == sizeof(float));
+
+#else  // SIXIT_IEEE_FLOAT_SHARED_LIB_SUPPORTED
+// a stub as the ieee_float_shared_lib is not supported on this platform
+class ieee_float_shared_lib
+{
+  public:
+    struct rw_alias
+    {
+    };
+};
+
+template <>
+struct fp_traits<ieee_float_shared_lib>
+{
+    // not implemented for this platform
+    static constexpr bool is_supported = false;
+};
+#endif // SIXIT_IEEE_FLOAT_SHARED_LIB_SUPPORTED
+
+} // namespace sixit::dmath
+
+template <>
+struct sixit::units::dimensional_scalar_rw_alias_helper<sixit::dmath::ieee_float_shared_lib>
+    : sixit::dmath::ieee_float_shared_lib::rw_alias
+{
+};
+
+template <>
+struct sixit::rw::member_type_alias<sixit::dmath::ieee_float_shared_lib> : sixit::dmath::ieee_float_shared_lib::rw_alias
+{
+};
+
+#endif // sixit_ieee_float_shared_lib_ieee_float_shared_lib_h_included
+
+/*
+The 3-Clause BSD License
+
+Copyright (C) 2023-2024 Six Impossible Things Before Breakfast Limited.
+
+Contributors: Sherry Ignatchenko, Victor Istomin
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+3. Neither the name of the copyright holder nor the names of its contributors
+may be used to endorse or promote products derived from this software
+without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
\ No newline at end of file